@@ -0,0 +1,300 @@
+../build/compiler/codegen/Analyser.o: ../compiler/codegen/Analyser.cpp \
+ ../compiler/codegen/Analyser.hpp ../compiler/compile/Compilation.hpp \
+ ../compiler/compile/OMRCompilation.hpp ../compiler/codegen/FrontEnd.hpp \
+ ../compiler/infra/List.hpp ../compiler/env/TRMemory.hpp \
+ ../compiler/cs2/allocator.h ../compiler/cs2/cs2.h \
+ ../compiler/env/TypedAllocator.hpp ../compiler/cs2/bitvectr.h \
+ ../compiler/cs2/bitmanip.h ../compiler/cs2/sparsrbit.h \
+ ../compiler/cs2/timer.h ../compiler/cs2/listof.h \
+ ../compiler/cs2/arrayof.h ../compiler/cs2/hashtab.h \
+ ../compiler/env/FilePointerDecl.hpp \
+ ../compiler/env/PersistentAllocator.hpp ../compiler/env/RawAllocator.hpp \
+ ../compiler/env/PersistentAllocatorKit.hpp \
+ ../compiler/env/PersistentInfo.hpp ../compiler/env/OMRPersistentInfo.hpp \
+ ../compiler/codegen/TableOfConstants.hpp ../compiler/env/defines.h \
+ ../compiler/infra/Assert.hpp ../compiler/infra/Annotations.hpp \
+ ../compiler/compile/CompilationException.hpp \
+ ../compiler/infra/ReferenceWrapper.hpp ../compiler/env/Region.hpp \
+ ../compiler/env/MemorySegment.hpp ../compiler/cs2/llistof.h \
+ ../compiler/env/jittypes.h ../compiler/infra/Random.hpp \
+ ../compiler/codegen/CodeGenPhase.hpp \
+ ../compiler/codegen/OMRCodeGenPhase.hpp \
+ ../compiler/codegen/CodeGenPhaseEnum.hpp \
+ ../compiler/codegen/OMRCodeGenPhaseEnum.hpp \
+ ../compiler/env/KnownObjectTable.hpp \
+ ../compiler/env/OMRKnownObjectTable.hpp ../compiler/codegen/Snippet.hpp \
+ ../compiler/x/codegen/OMRSnippet.hpp ../compiler/codegen/OMRSnippet.hpp \
+ ../compiler/infra/Flags.hpp ../compiler/codegen/SnippetGCMap.hpp \
+ ../compiler/codegen/OMRSnippetGCMap.hpp ../compiler/env/CompilerEnv.hpp \
+ ../compiler/env/OMRCompilerEnv.hpp ../compiler/env/Environment.hpp \
+ ../compiler/env/OMREnvironment.hpp ../compiler/env/CPU.hpp \
+ ../compiler/x/env/OMRCPU.hpp ../compiler/env/OMRCPU.hpp \
+ ../compiler/env/Processors.hpp ../compiler/arm/env/ARMProcessorEnum.hpp \
+ ../compiler/p/env/PPCProcessorEnum.hpp \
+ ../compiler/z/env/S390ProcessorEnum.hpp \
+ ../compiler/x/env/X86ProcessorEnum.hpp ../compiler/env/DebugEnv.hpp \
+ ../compiler/x/env/OMRDebugEnv.hpp ../compiler/env/OMRDebugEnv.hpp \
+ ../compiler/env/ClassEnv.hpp ../compiler/env/OMRClassEnv.hpp \
+ ../jitbuilder/env/ObjectModel.hpp ../jitbuilder/env/JBObjectModel.hpp \
+ ../compiler/env/OMRObjectModel.hpp ../compiler/env/ArithEnv.hpp \
+ ../compiler/env/OMRArithEnv.hpp ../compiler/env/VMEnv.hpp \
+ ../compiler/env/OMRVMEnv.hpp ../compiler/compile/CompilationTypes.hpp \
+ ../compiler/infra/Link.hpp ../compiler/infra/Stack.hpp \
+ ../compiler/infra/Array.hpp ../compiler/optimizer/Optimizations.hpp \
+ ../compiler/optimizer/Optimizations.enum \
+ ../compiler/optimizer/OptimizationGroups.enum \
+ ../compiler/env/ProcessorInfo.hpp ../compiler/il/DataTypes.hpp \
+ ../compiler/il/OMRDataTypes.hpp ../compiler/il/ILOpCodes.hpp \
+ ../compiler/il/ILOpCodesEnum.hpp ../compiler/il/OMRILOpCodesEnum.hpp \
+ ../compiler/il/DataTypesEnum.hpp ../compiler/il/ILOps.hpp \
+ ../compiler/il/OMRILOps.hpp ../compiler/il/ILHelpers.hpp \
+ ../compiler/il/ILProps.hpp \
+ ../compiler/optimizer/OptimizationStrategies.hpp \
+ ../compiler/runtime/Runtime.hpp \
+ ../compiler/codegen/LinkageConventionsEnum.hpp \
+ ../compiler/codegen/LinkageConventions.enum \
+ ../compiler/runtime/Helpers.inc ../compiler/env/VerboseLog.hpp \
+ ../compiler/codegen/RecognizedMethods.hpp \
+ ../compiler/codegen/OMRRecognizedMethodsEnum.hpp \
+ ../compiler/compile/OSRData.hpp ../jitbuilder/compile/Method.hpp \
+ ../compiler/compile/OMRMethod.hpp ../compiler/compile/InlineBlock.hpp \
+ ../compiler/il/Node.hpp ../compiler/il/OMRNode.hpp \
+ ../compiler/codegen/RegisterConstants.hpp ../compiler/il/NodeUnions.hpp \
+ ../compiler/il/NodeUtils.hpp ../compiler/il/NodeExtension.hpp \
+ ../compiler/compile/ResolvedMethod.hpp \
+ ../compiler/compile/TLSCompilationManager.hpp \
+ ../compiler/control/OptimizationPlan.hpp \
+ ../jitbuilder/optimizer/Optimizer.hpp \
+ ../jitbuilder/optimizer/JBOptimizer.hpp \
+ ../compiler/optimizer/OMROptimizer.hpp ../compiler/il/TreeTop.hpp \
+ ../compiler/il/OMRTreeTop.hpp ../compiler/il/TreeTop_inlines.hpp \
+ ../compiler/il/OMRTreeTop_inlines.hpp ../compiler/control/Options.hpp \
+ ../compiler/control/OMROptions.hpp ../compiler/control/OptionsUtil.hpp \
+ ../compiler/infra/SimpleRegex.hpp ../compiler/ras/DebugCounter.hpp \
+ ../compiler/ras/Debug.hpp ../compiler/codegen/Machine.hpp \
+ ../compiler/x/amd64/codegen/OMRMachine.hpp \
+ ../compiler/x/codegen/OMRMachine.hpp ../compiler/codegen/OMRMachine.hpp \
+ ../compiler/x/codegen/RealRegister.hpp \
+ ../compiler/x/amd64/codegen/OMRRealRegister.hpp \
+ ../compiler/x/codegen/OMRRealRegister.hpp \
+ ../compiler/codegen/OMRRealRegister.hpp ../compiler/codegen/Register.hpp \
+ ../compiler/x/codegen/OMRRegister.hpp \
+ ../compiler/codegen/OMRRegister.hpp \
+ ../compiler/x/amd64/codegen/RealRegisterEnum.hpp \
+ ../compiler/x/amd64/codegen/RealRegisterMaskEnum.hpp \
+ ../compiler/x/codegen/X86Ops.hpp ../compiler/x/codegen/X86Ops.ins \
+ ../compiler/x/codegen/X86Register.hpp ../compiler/infra/TRlist.hpp \
+ ../compiler/compile/VirtualGuard.hpp ../compiler/infra/BitVector.hpp \
+ ../compiler/infra/TRCfgNode.hpp ../compiler/infra/TRCfgEdge.hpp \
+ ../compiler/codegen/RegisterRematerializationInfo.hpp \
+ ../compiler/infra/Monitor.hpp ../compiler/infra/OMRMonitor.hpp \
+ ../include_core/omrmutex.h ../include_core/omrcomp.h \
+ ../include_core/omrcfg.h ../include_core/unix/omrmutex.h \
+ ../compiler/control/Options_inlines.hpp \
+ ../compiler/control/OMROptions_inlines.hpp ../compiler/il/IL.hpp \
+ ../compiler/il/OMRIL.hpp ../compiler/infra/ThreadLocal.h \
+ ../include_core/omr.h ../include_core/omrport.h \
+ ../include_core/omrthread.h ../include_core/omrthread_generated.h \
+ ../include_core/thread_api.h ../include_core/omrmemcategories.h \
+ ../include_core/omrporterror.h \
+ ../compiler/il/symbol/ResolvedMethodSymbol.hpp \
+ ../compiler/il/symbol/OMRResolvedMethodSymbol.hpp \
+ ../compiler/il/symbol/MethodSymbol.hpp \
+ ../compiler/il/symbol/OMRMethodSymbol.hpp ../compiler/il/Symbol.hpp \
+ ../compiler/il/symbol/OMRSymbol.hpp \
+ ../compiler/compile/SymbolReferenceTable.hpp \
+ ../compiler/compile/OMRSymbolReferenceTable.hpp \
+ ../compiler/infra/HashTab.hpp ../compiler/infra/Bit.hpp \
+ ../compiler/compile/AliasBuilder.hpp \
+ ../compiler/compile/OMRAliasBuilder.hpp \
+ ../compiler/il/symbol/RegisterMappedSymbol.hpp \
+ ../compiler/il/symbol/OMRRegisterMappedSymbol.hpp \
+ ../compiler/il/Node_inlines.hpp ../compiler/il/OMRNode_inlines.hpp \
+ ../compiler/env/IO.hpp ../compiler/env/OMRIO.hpp \
+ ../compiler/env/FilePointer.hpp ../compiler/il/AliasSetInterface.hpp \
+ ../compiler/env/StackMemoryRegion.hpp ../compiler/il/SymbolReference.hpp \
+ ../compiler/il/OMRSymbolReference.hpp
+../compiler/codegen/Analyser.hpp:
+../compiler/compile/Compilation.hpp:
+../compiler/compile/OMRCompilation.hpp:
+../compiler/codegen/FrontEnd.hpp:
+../compiler/infra/List.hpp:
+../compiler/env/TRMemory.hpp:
+../compiler/cs2/allocator.h:
+../compiler/cs2/cs2.h:
+../compiler/env/TypedAllocator.hpp:
+../compiler/cs2/bitvectr.h:
+../compiler/cs2/bitmanip.h:
+../compiler/cs2/sparsrbit.h:
+../compiler/cs2/timer.h:
+../compiler/cs2/listof.h:
+../compiler/cs2/arrayof.h:
+../compiler/cs2/hashtab.h:
+../compiler/env/FilePointerDecl.hpp:
+../compiler/env/PersistentAllocator.hpp:
+../compiler/env/RawAllocator.hpp:
+../compiler/env/PersistentAllocatorKit.hpp:
+../compiler/env/PersistentInfo.hpp:
+../compiler/env/OMRPersistentInfo.hpp:
+../compiler/codegen/TableOfConstants.hpp:
+../compiler/env/defines.h:
+../compiler/infra/Assert.hpp:
+../compiler/infra/Annotations.hpp:
+../compiler/compile/CompilationException.hpp:
+../compiler/infra/ReferenceWrapper.hpp:
+../compiler/env/Region.hpp:
+../compiler/env/MemorySegment.hpp:
+../compiler/cs2/llistof.h:
+../compiler/env/jittypes.h:
+../compiler/infra/Random.hpp:
+../compiler/codegen/CodeGenPhase.hpp:
+../compiler/codegen/OMRCodeGenPhase.hpp:
+../compiler/codegen/CodeGenPhaseEnum.hpp:
+../compiler/codegen/OMRCodeGenPhaseEnum.hpp:
+../compiler/env/KnownObjectTable.hpp:
+../compiler/env/OMRKnownObjectTable.hpp:
+../compiler/codegen/Snippet.hpp:
+../compiler/x/codegen/OMRSnippet.hpp:
+../compiler/codegen/OMRSnippet.hpp:
+../compiler/infra/Flags.hpp:
+../compiler/codegen/SnippetGCMap.hpp:
+../compiler/codegen/OMRSnippetGCMap.hpp:
+../compiler/env/CompilerEnv.hpp:
+../compiler/env/OMRCompilerEnv.hpp:
+../compiler/env/Environment.hpp:
+../compiler/env/OMREnvironment.hpp:
+../compiler/env/CPU.hpp:
+../compiler/x/env/OMRCPU.hpp:
+../compiler/env/OMRCPU.hpp:
+../compiler/env/Processors.hpp:
+../compiler/arm/env/ARMProcessorEnum.hpp:
+../compiler/p/env/PPCProcessorEnum.hpp:
+../compiler/z/env/S390ProcessorEnum.hpp:
+../compiler/x/env/X86ProcessorEnum.hpp:
+../compiler/env/DebugEnv.hpp:
+../compiler/x/env/OMRDebugEnv.hpp:
+../compiler/env/OMRDebugEnv.hpp:
+../compiler/env/ClassEnv.hpp:
+../compiler/env/OMRClassEnv.hpp:
+../jitbuilder/env/ObjectModel.hpp:
+../jitbuilder/env/JBObjectModel.hpp:
+../compiler/env/OMRObjectModel.hpp:
+../compiler/env/ArithEnv.hpp:
+../compiler/env/OMRArithEnv.hpp:
+../compiler/env/VMEnv.hpp:
+../compiler/env/OMRVMEnv.hpp:
+../compiler/compile/CompilationTypes.hpp:
+../compiler/infra/Link.hpp:
+../compiler/infra/Stack.hpp:
+../compiler/infra/Array.hpp:
+../compiler/optimizer/Optimizations.hpp:
+../compiler/optimizer/Optimizations.enum:
+../compiler/optimizer/OptimizationGroups.enum:
+../compiler/env/ProcessorInfo.hpp:
+../compiler/il/DataTypes.hpp:
+../compiler/il/OMRDataTypes.hpp:
+../compiler/il/ILOpCodes.hpp:
+../compiler/il/ILOpCodesEnum.hpp:
+../compiler/il/OMRILOpCodesEnum.hpp:
+../compiler/il/DataTypesEnum.hpp:
+../compiler/il/ILOps.hpp:
+../compiler/il/OMRILOps.hpp:
+../compiler/il/ILHelpers.hpp:
+../compiler/il/ILProps.hpp:
+../compiler/optimizer/OptimizationStrategies.hpp:
+../compiler/runtime/Runtime.hpp:
+../compiler/codegen/LinkageConventionsEnum.hpp:
+../compiler/codegen/LinkageConventions.enum:
+../compiler/runtime/Helpers.inc:
+../compiler/env/VerboseLog.hpp:
+../compiler/codegen/RecognizedMethods.hpp:
+../compiler/codegen/OMRRecognizedMethodsEnum.hpp:
+../compiler/compile/OSRData.hpp:
+../jitbuilder/compile/Method.hpp:
+../compiler/compile/OMRMethod.hpp:
+../compiler/compile/InlineBlock.hpp:
+../compiler/il/Node.hpp:
+../compiler/il/OMRNode.hpp:
+../compiler/codegen/RegisterConstants.hpp:
+../compiler/il/NodeUnions.hpp:
+../compiler/il/NodeUtils.hpp:
+../compiler/il/NodeExtension.hpp:
+../compiler/compile/ResolvedMethod.hpp:
+../compiler/compile/TLSCompilationManager.hpp:
+../compiler/control/OptimizationPlan.hpp:
+../jitbuilder/optimizer/Optimizer.hpp:
+../jitbuilder/optimizer/JBOptimizer.hpp:
+../compiler/optimizer/OMROptimizer.hpp:
+../compiler/il/TreeTop.hpp:
+../compiler/il/OMRTreeTop.hpp:
+../compiler/il/TreeTop_inlines.hpp:
+../compiler/il/OMRTreeTop_inlines.hpp:
+../compiler/control/Options.hpp:
+../compiler/control/OMROptions.hpp:
+../compiler/control/OptionsUtil.hpp:
+../compiler/infra/SimpleRegex.hpp:
+../compiler/ras/DebugCounter.hpp:
+../compiler/ras/Debug.hpp:
+../compiler/codegen/Machine.hpp:
+../compiler/x/amd64/codegen/OMRMachine.hpp:
+../compiler/x/codegen/OMRMachine.hpp:
+../compiler/codegen/OMRMachine.hpp:
+../compiler/x/codegen/RealRegister.hpp:
+../compiler/x/amd64/codegen/OMRRealRegister.hpp:
+../compiler/x/codegen/OMRRealRegister.hpp:
+../compiler/codegen/OMRRealRegister.hpp:
+../compiler/codegen/Register.hpp:
+../compiler/x/codegen/OMRRegister.hpp:
+../compiler/codegen/OMRRegister.hpp:
+../compiler/x/amd64/codegen/RealRegisterEnum.hpp:
+../compiler/x/amd64/codegen/RealRegisterMaskEnum.hpp:
+../compiler/x/codegen/X86Ops.hpp:
+../compiler/x/codegen/X86Ops.ins:
+../compiler/x/codegen/X86Register.hpp:
+../compiler/infra/TRlist.hpp:
+../compiler/compile/VirtualGuard.hpp:
+../compiler/infra/BitVector.hpp:
+../compiler/infra/TRCfgNode.hpp:
+../compiler/infra/TRCfgEdge.hpp:
+../compiler/codegen/RegisterRematerializationInfo.hpp:
+../compiler/infra/Monitor.hpp:
+../compiler/infra/OMRMonitor.hpp:
+../include_core/omrmutex.h:
+../include_core/omrcomp.h:
+../include_core/omrcfg.h:
+../include_core/unix/omrmutex.h:
+../compiler/control/Options_inlines.hpp:
+../compiler/control/OMROptions_inlines.hpp:
+../compiler/il/IL.hpp:
+../compiler/il/OMRIL.hpp:
+../compiler/infra/ThreadLocal.h:
+../include_core/omr.h:
+../include_core/omrport.h:
+../include_core/omrthread.h:
+../include_core/omrthread_generated.h:
+../include_core/thread_api.h:
+../include_core/omrmemcategories.h:
+../include_core/omrporterror.h:
+../compiler/il/symbol/ResolvedMethodSymbol.hpp:
+../compiler/il/symbol/OMRResolvedMethodSymbol.hpp:
+../compiler/il/symbol/MethodSymbol.hpp:
+../compiler/il/symbol/OMRMethodSymbol.hpp:
+../compiler/il/Symbol.hpp:
+../compiler/il/symbol/OMRSymbol.hpp:
+../compiler/compile/SymbolReferenceTable.hpp:
+../compiler/compile/OMRSymbolReferenceTable.hpp:
+../compiler/infra/HashTab.hpp:
+../compiler/infra/Bit.hpp:
+../compiler/compile/AliasBuilder.hpp:
+../compiler/compile/OMRAliasBuilder.hpp:
+../compiler/il/symbol/RegisterMappedSymbol.hpp:
+../compiler/il/symbol/OMRRegisterMappedSymbol.hpp:
+../compiler/il/Node_inlines.hpp:
+../compiler/il/OMRNode_inlines.hpp:
+../compiler/env/IO.hpp:
+../compiler/env/OMRIO.hpp:
+../compiler/env/FilePointer.hpp:
+../compiler/il/AliasSetInterface.hpp:
+../compiler/env/StackMemoryRegion.hpp:
+../compiler/il/SymbolReference.hpp:
+../compiler/il/OMRSymbolReference.hpp:
@@ -0,0 +1,50 @@
+../build/compiler/env/OMRClassEnv.o: ../compiler/env/OMRClassEnv.cpp \
+ ../compiler/env/CompilerEnv.hpp ../compiler/env/OMRCompilerEnv.hpp \
+ ../compiler/infra/Annotations.hpp ../compiler/env/RawAllocator.hpp \
+ ../compiler/env/Environment.hpp ../compiler/env/OMREnvironment.hpp \
+ ../compiler/env/CPU.hpp ../compiler/x/env/OMRCPU.hpp \
+ ../compiler/env/OMRCPU.hpp ../compiler/env/Processors.hpp \
+ ../compiler/arm/env/ARMProcessorEnum.hpp \
+ ../compiler/p/env/PPCProcessorEnum.hpp \
+ ../compiler/z/env/S390ProcessorEnum.hpp \
+ ../compiler/x/env/X86ProcessorEnum.hpp ../compiler/env/DebugEnv.hpp \
+ ../compiler/x/env/OMRDebugEnv.hpp ../compiler/env/OMRDebugEnv.hpp \
+ ../compiler/env/jittypes.h ../compiler/env/PersistentAllocator.hpp \
+ ../compiler/env/PersistentAllocatorKit.hpp ../compiler/env/ClassEnv.hpp \
+ ../compiler/env/OMRClassEnv.hpp ../jitbuilder/env/ObjectModel.hpp \
+ ../jitbuilder/env/JBObjectModel.hpp ../compiler/env/OMRObjectModel.hpp \
+ ../compiler/env/ArithEnv.hpp ../compiler/env/OMRArithEnv.hpp \
+ ../compiler/env/VMEnv.hpp ../compiler/env/OMRVMEnv.hpp \
+ ../compiler/infra/Assert.hpp \
+ ../compiler/compile/CompilationException.hpp
+../compiler/env/CompilerEnv.hpp:
+../compiler/env/OMRCompilerEnv.hpp:
+../compiler/infra/Annotations.hpp:
+../compiler/env/RawAllocator.hpp:
+../compiler/env/Environment.hpp:
+../compiler/env/OMREnvironment.hpp:
+../compiler/env/CPU.hpp:
+../compiler/x/env/OMRCPU.hpp:
+../compiler/env/OMRCPU.hpp:
+../compiler/env/Processors.hpp:
+../compiler/arm/env/ARMProcessorEnum.hpp:
+../compiler/p/env/PPCProcessorEnum.hpp:
+../compiler/z/env/S390ProcessorEnum.hpp:
+../compiler/x/env/X86ProcessorEnum.hpp:
+../compiler/env/DebugEnv.hpp:
+../compiler/x/env/OMRDebugEnv.hpp:
+../compiler/env/OMRDebugEnv.hpp:
+../compiler/env/jittypes.h:
+../compiler/env/PersistentAllocator.hpp:
+../compiler/env/PersistentAllocatorKit.hpp:
+../compiler/env/ClassEnv.hpp:
+../compiler/env/OMRClassEnv.hpp:
+../jitbuilder/env/ObjectModel.hpp:
+../jitbuilder/env/JBObjectModel.hpp:
+../compiler/env/OMRObjectModel.hpp:
+../compiler/env/ArithEnv.hpp:
+../compiler/env/OMRArithEnv.hpp:
+../compiler/env/VMEnv.hpp:
+../compiler/env/OMRVMEnv.hpp:
+../compiler/infra/Assert.hpp:
+../compiler/compile/CompilationException.hpp:
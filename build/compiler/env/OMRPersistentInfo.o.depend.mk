@@ -0,0 +1,7 @@
+../build/compiler/env/OMRPersistentInfo.o: \
+ ../compiler/env/OMRPersistentInfo.cpp ../compiler/env/PersistentInfo.hpp \
+ ../compiler/env/OMRPersistentInfo.hpp \
+ ../compiler/codegen/TableOfConstants.hpp
+../compiler/env/PersistentInfo.hpp:
+../compiler/env/OMRPersistentInfo.hpp:
+../compiler/codegen/TableOfConstants.hpp:
@@ -0,0 +1,7 @@
+../build/compiler/env/PersistentAllocator.o: \
+ ../compiler/env/PersistentAllocator.cpp \
+ ../compiler/env/PersistentAllocator.hpp ../compiler/env/RawAllocator.hpp \
+ ../compiler/env/PersistentAllocatorKit.hpp
+../compiler/env/PersistentAllocator.hpp:
+../compiler/env/RawAllocator.hpp:
+../compiler/env/PersistentAllocatorKit.hpp:
@@ -0,0 +1,3 @@
+../build/compiler/env/SegmentProvider.o: \
+ ../compiler/env/SegmentProvider.cpp ../compiler/env/SegmentProvider.hpp
+../compiler/env/SegmentProvider.hpp:
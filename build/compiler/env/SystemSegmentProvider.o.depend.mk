@@ -0,0 +1,18 @@
+../build/compiler/env/SystemSegmentProvider.o: \
+ ../compiler/env/SystemSegmentProvider.cpp \
+ ../compiler/env/SystemSegmentProvider.hpp \
+ ../compiler/env/TypedAllocator.hpp \
+ ../compiler/infra/ReferenceWrapper.hpp \
+ ../compiler/env/SegmentProvider.hpp ../compiler/env/RawAllocator.hpp \
+ ../compiler/env/MemorySegment.hpp ../compiler/infra/Assert.hpp \
+ ../compiler/infra/Annotations.hpp \
+ ../compiler/compile/CompilationException.hpp
+../compiler/env/SystemSegmentProvider.hpp:
+../compiler/env/TypedAllocator.hpp:
+../compiler/infra/ReferenceWrapper.hpp:
+../compiler/env/SegmentProvider.hpp:
+../compiler/env/RawAllocator.hpp:
+../compiler/env/MemorySegment.hpp:
+../compiler/infra/Assert.hpp:
+../compiler/infra/Annotations.hpp:
+../compiler/compile/CompilationException.hpp:
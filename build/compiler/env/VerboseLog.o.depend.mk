@@ -0,0 +1,8 @@
+../build/compiler/env/VerboseLog.o: ../compiler/env/VerboseLog.cpp \
+ ../compiler/env/VerboseLog.hpp ../compiler/infra/Assert.hpp \
+ ../compiler/infra/Annotations.hpp \
+ ../compiler/compile/CompilationException.hpp
+../compiler/env/VerboseLog.hpp:
+../compiler/infra/Assert.hpp:
+../compiler/infra/Annotations.hpp:
+../compiler/compile/CompilationException.hpp:
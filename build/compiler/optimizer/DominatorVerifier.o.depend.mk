@@ -0,0 +1,2 @@
+../build/compiler/optimizer/DominatorVerifier.o: \
+ ../compiler/optimizer/DominatorVerifier.cpp
@@ -0,0 +1,2 @@
+../build/compiler/optimizer/DominatorsChk.o: \
+ ../compiler/optimizer/DominatorsChk.cpp
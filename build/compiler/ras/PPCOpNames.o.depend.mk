@@ -0,0 +1 @@
+../build/compiler/ras/PPCOpNames.o: ../compiler/ras/PPCOpNames.cpp
@@ -0,0 +1 @@
+../build/compiler/runtime/Alignment.o: ../compiler/runtime/Alignment.cpp
@@ -0,0 +1,8 @@
+../build/compiler/runtime/OMRCodeCacheConfig.o: \
+ ../compiler/runtime/OMRCodeCacheConfig.cpp \
+ ../compiler/runtime/CodeCacheConfig.hpp \
+ ../compiler/runtime/OMRCodeCacheConfig.hpp \
+ ../compiler/infra/Annotations.hpp
+../compiler/runtime/CodeCacheConfig.hpp:
+../compiler/runtime/OMRCodeCacheConfig.hpp:
+../compiler/infra/Annotations.hpp:
@@ -0,0 +1 @@
+../build/compiler/x/codegen/OpNames.o: ../compiler/x/codegen/OpNames.cpp
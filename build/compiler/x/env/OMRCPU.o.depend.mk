@@ -0,0 +1,27 @@
+../build/compiler/x/env/OMRCPU.o: ../compiler/x/env/OMRCPU.cpp \
+ ../compiler/env/CPU.hpp ../compiler/x/env/OMRCPU.hpp \
+ ../compiler/env/OMRCPU.hpp ../compiler/env/Processors.hpp \
+ ../compiler/arm/env/ARMProcessorEnum.hpp \
+ ../compiler/p/env/PPCProcessorEnum.hpp \
+ ../compiler/z/env/S390ProcessorEnum.hpp \
+ ../compiler/x/env/X86ProcessorEnum.hpp ../compiler/env/JitConfig.hpp \
+ ../compiler/env/IO.hpp ../compiler/env/OMRIO.hpp \
+ ../compiler/env/FilePointerDecl.hpp ../compiler/infra/Annotations.hpp \
+ ../compiler/env/FilePointer.hpp ../compiler/env/ProcessorInfo.hpp \
+ ../compiler/x/runtime/X86Runtime.hpp
+../compiler/env/CPU.hpp:
+../compiler/x/env/OMRCPU.hpp:
+../compiler/env/OMRCPU.hpp:
+../compiler/env/Processors.hpp:
+../compiler/arm/env/ARMProcessorEnum.hpp:
+../compiler/p/env/PPCProcessorEnum.hpp:
+../compiler/z/env/S390ProcessorEnum.hpp:
+../compiler/x/env/X86ProcessorEnum.hpp:
+../compiler/env/JitConfig.hpp:
+../compiler/env/IO.hpp:
+../compiler/env/OMRIO.hpp:
+../compiler/env/FilePointerDecl.hpp:
+../compiler/infra/Annotations.hpp:
+../compiler/env/FilePointer.hpp:
+../compiler/env/ProcessorInfo.hpp:
+../compiler/x/runtime/X86Runtime.hpp:
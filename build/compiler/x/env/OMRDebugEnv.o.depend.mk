@@ -0,0 +1,9 @@
+../build/compiler/x/env/OMRDebugEnv.o: ../compiler/x/env/OMRDebugEnv.cpp \
+ ../compiler/env/DebugEnv.hpp ../compiler/x/env/OMRDebugEnv.hpp \
+ ../compiler/env/OMRDebugEnv.hpp ../compiler/infra/Annotations.hpp \
+ ../compiler/env/jittypes.h
+../compiler/env/DebugEnv.hpp:
+../compiler/x/env/OMRDebugEnv.hpp:
+../compiler/env/OMRDebugEnv.hpp:
+../compiler/infra/Annotations.hpp:
+../compiler/env/jittypes.h:
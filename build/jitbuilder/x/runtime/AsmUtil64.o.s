@@ -0,0 +1,212 @@
+.intel_syntax noprefix
+
+
+/*  (c) Copyright IBM Corp. 2000, 2016 */
+
+/*   This program and the accompanying materials are made available */
+/*   under the terms of the Eclipse Public License v1.0 and */
+/*   Apache License v2.0 which accompanies this distribution. */
+
+/*       The Eclipse Public License is available at */
+/*       http://www.eclipse.org/legal/epl-v10.html */
+
+/*       The Apache License v2.0 is available at */
+/*       http://www.opensource.org/licenses/apache2.0.php */
+
+/*  Contributors: */
+/*     Multiple authors (IBM Corp.) - initial implementation and documentation */
+
+
+/*  VM should define this at some point */
+.equ OFFSETOF_CPU_CYCLE_COUNT,  0
+
+.ifdef TR_HOST_64BIT
+
+
+
+/*  (c) Copyright IBM Corp. 2000, 2016 */
+
+/*   This program and the accompanying materials are made available */
+/*   under the terms of the Eclipse Public License v1.0 and */
+/*   Apache License v2.0 which accompanies this distribution. */
+
+/*       The Eclipse Public License is available at */
+/*       http://www.eclipse.org/legal/epl-v10.html */
+
+/*       The Apache License v2.0 is available at */
+/*       http://www.opensource.org/licenses/apache2.0.php */
+
+/*  Contributors: */
+/*     Multiple authors (IBM Corp.) - initial implementation and documentation */
+
+
+.text
+
+.global compareAndExchange1
+.global compareAndExchange2
+.global compareAndExchange4
+.global compareAndExchange8
+.global _patchingFence16
+.global _patchingFence24
+.global _patchingFenceCPUID
+.global atomicIncrement4
+
+.macro Align16
+/*  TODO:AMD64: Find a way not to get 16 bytes of padding when we are already aligned! */
+.align 16
+.endm
+
+/*  Atomically Compare And Exchange the value contained data pointed to by ptr */
+/*  with oldValue, and if equal, replace by newValue */
+/*  Return zero on failure. Nonzero otherwise. */
+
+/*  prototype: int32_t compareAndExchange1(uint8_t *ptr, uint8_t oldValue, uint8_t newValue) */
+
+
+.macro prepareCompareAndExchangeArguments
+        	/*  TODO: this generates Rex prefixes that are only needed for the 8-byte case */
+.ifdef WINDOWS
+        	/*  rcx=address, rdx=old, r8=new */
+        mov     rax, rdx
+        mov     rdx, r8
+.else
+        	/*  rdi=address, rsi=old, rdx=new */
+        mov     rcx, rdi
+        mov     rax, rsi
+.endif
+        	/*  rcx=address, rax=old, rdx=new */
+.endm
+
+        Align16
+compareAndExchange1:
+        prepareCompareAndExchangeArguments
+        lock cmpxchg byte ptr [rcx], dl
+        jnz     failedCMPXCHG
+passedCMPXCHG: 	/*  Placed here to enhance branch prediction */
+        mov     eax, 1
+        ret
+
+
+        Align16
+compareAndExchange2:
+        prepareCompareAndExchangeArguments
+        lock cmpxchg word ptr [rcx], dx
+        jz      passedCMPXCHG
+failedCMPXCHG: 	/*  Placed here to enhance branch prediction */
+        xor     eax, eax
+        ret
+
+
+        Align16
+compareAndExchange4:
+        prepareCompareAndExchangeArguments
+        lock cmpxchg dword ptr [rcx], edx
+        jz      passedCMPXCHG
+        jmp     failedCMPXCHG
+
+
+        Align16
+compareAndExchange8:
+        prepareCompareAndExchangeArguments
+        lock cmpxchg qword ptr [rcx], rdx
+        jz      passedCMPXCHG
+        jmp     failedCMPXCHG
+
+
+        Align16
+_patchingFence16:
+        mfence
+.ifdef WINDOWS
+        clflush [rcx]
+        clflush [rcx+8]
+.else
+        clflush [rdi]
+        clflush [rdi+8]
+.endif
+        mfence
+        ret
+
+
+        Align16
+_patchingFence24:
+        mfence
+.ifdef WINDOWS
+        clflush [rcx]
+        clflush [rcx+8]
+        clflush [rcx+16]
+.else
+        clflush [rdi]
+        clflush [rdi+8]
+        clflush [rdi+16]
+.endif
+        mfence
+        ret
+
+
+
+/*  void _patchingFenceCPUID(); */
+
+_patchingFenceCPUID:
+         pushfq
+         push       rbx
+         cpuid
+         pop        rbx
+         popfq
+         ret
+
+
+/*  prototype: int32_t atomicIncrement4(int32_t *value) */
+atomicIncrement4:
+   mov   eax, [rdi]        	/*  load original value */
+LtryNextValue:
+   mov   ecx, eax
+   add   ecx, 1
+   lock cmpxchg dword ptr [rdi], ecx
+   jnz   LtryNextValue
+   mov   eax, ecx
+   ret
+
+
+
+
+
+.global initCycleCounter
+.global incrementCycleCounter
+.global getCycles
+
+.macro GetCycles
+        rdtsc
+        shl    rdx,32
+        or     rax,rdx
+.endm
+
+/*  void initCycleCounter() */
+initCycleCounter:
+	GetCycles
+        mov    qword ptr [rbp + OFFSETOF_CPU_CYCLE_COUNT], rax
+        ret
+
+
+/*  void incrementCycleCounter(intptr_t cycleCounterPointer) */
+incrementCycleCounter:
+	GetCycles
+        sub    rax, qword ptr [rbp + OFFSETOF_CPU_CYCLE_COUNT]
+        add    qword ptr [rdi], rax
+        ret
+
+
+getCycles:
+	GetCycles
+	ret
+
+
+.else
+.arch pentiumpro
+
+.data
+AMD64AsmUtil:
+.byte 0x00
+
+
+.endif
+
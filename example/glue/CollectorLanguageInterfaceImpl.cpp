@@ -46,6 +46,11 @@
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
 #include "SublistFragment.hpp"
+#if defined(OMR_GC_MODRON_COMPACTION)
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#endif /* OMR_GC_MODRON_COMPACTION */
 
 /* This enum extends ConcurrentStatus with values > CONCURRENT_ROOT_TRACING. Values from this
  * and from ConcurrentStatus are treated as uintptr_t values everywhere except when used as
@@ -385,31 +390,100 @@ MM_CollectorLanguageInterfaceImpl::scavenger_fixupDestroyedSlot(MM_EnvironmentBa
 	}
 }
 #endif /* OMR_INTERP_COMPRESSED_OBJECT_HEADER */
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+omrobjectptr_t
+MM_CollectorLanguageInterfaceImpl::scavenger_loadBarrier(MM_EnvironmentBase *env, GC_SlotObject *slotObject)
+{
+	omrobjectptr_t objectPtr = slotObject->readReferenceFromSlot();
+	if (NULL == _extensions->objectModel.healForwardedSlot(slotObject, objectPtr)) {
+		/* Not copied yet, so the mutator copies it. The slot is healed atomically, in case another thread beat us to it */
+		_extensions->scavenger->copyObjectSlot(MM_EnvironmentStandard::getEnvironment(env), slotObject);
+	}
+	return slotObject->readReferenceFromSlot();
+}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap)
 {
-	Assert_MM_unimplemented();
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
 {
-	Assert_MM_unimplemented();
+	OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		J9HashTableState state;
+		if (NULL != omrVM->rootTable) {
+			RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+			while (NULL != rootEntry) {
+				if (NULL != rootEntry->rootPtr) {
+					rootEntry->rootPtr = compactScheme->getForwardingPtr(rootEntry->rootPtr);
+				}
+				rootEntry = (RootEntry *)hashTableNextDo(&state);
+			}
+		}
+		/* Dead entries were removed from the object table when marking completed */
+		if (NULL != omrVM->objectTable) {
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+			while (NULL != objectEntry) {
+				objectEntry->objPtr = compactScheme->getForwardingPtr(objectEntry->objPtr);
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+		}
+		OMR_VMThread *walkThread;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+			if (NULL != walkThread->_savedObject1) {
+				walkThread->_savedObject1 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject1);
+			}
+			if (NULL != walkThread->_savedObject2) {
+				walkThread->_savedObject2 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject2);
+			}
+		}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		/* Dead objects were cleared from the remembered set before anything moved (see compactScheme_languageMasterSetupForGC()) */
+		GC_SublistIterator remSetIterator(&_extensions->rememberedSet);
+		MM_SublistPuddle *puddle = NULL;
+		while (NULL != (puddle = remSetIterator.nextList())) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				if (NULL != *slotPtr) {
+					*slotPtr = compactScheme->getForwardingPtr(*slotPtr);
+				}
+			}
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_workerCleanupAfterGC(MM_EnvironmentBase *env)
 {
-	Assert_MM_unimplemented();
 }
 
 void
 MM_CollectorLanguageInterfaceImpl::compactScheme_languageMasterSetupForGC(MM_EnvironmentBase *env)
 {
-	Assert_MM_unimplemented();
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* Forwarding pointers can only be found for live objects, and the mark bits are overwritten once objects move */
+	GC_SublistIterator remSetIterator(&_extensions->rememberedSet);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			if ((NULL != *slotPtr) && !_markingScheme->isMarked(*slotPtr)) {
+				*slotPtr = NULL;
+			}
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
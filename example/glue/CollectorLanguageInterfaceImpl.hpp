@@ -164,6 +164,10 @@ public:
 #if defined (OMR_INTERP_COMPRESSED_OBJECT_HEADER)
 	virtual void scavenger_fixupDestroyedSlot(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, MM_MemorySubSpaceSemiSpace *subSpaceNew);
 #endif /* OMR_INTERP_COMPRESSED_OBJECT_HEADER */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	virtual void scavenger_switchConcurrentForThread(MM_EnvironmentBase *env) {}
+	virtual omrobjectptr_t scavenger_loadBarrier(MM_EnvironmentBase *env, GC_SlotObject *slotObject);
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -24,12 +24,23 @@
 #include "EnvironmentBase.hpp"
 #include "EnvironmentDelegate.hpp"
 #include "GCExtensionsBase.hpp"
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#include "Scavenger.hpp"
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 void
 MM_EnvironmentDelegate::acquireVMAccess(bool exclusiveAccessForGCObtainedAfterBeatenByOtherThread)
 {
 	OMR_VM_Example *exampleVM = (OMR_VM_Example *)_env->getOmrVM()->_language_vm;
 	omrthread_rwmutex_enter_read(exampleVM->_vmAccessMutex);
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* Acquiring VM access is the safe point at which a mutator joins the start or end of a Concurrent Scavenger cycle */
+	MM_GCExtensionsBase *extensions = _env->getExtensions();
+	if (extensions->concurrentScavenger && (NULL != extensions->scavenger) && (MUTATOR_THREAD == _env->getThreadType())) {
+		extensions->scavenger->switchConcurrentForThread(_env);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 }
 
 /**
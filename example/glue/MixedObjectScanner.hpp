@@ -70,6 +70,9 @@ protected:
 			_scanMap = ~((uintptr_t)0);
 			_flags = setNoMoreSlots(_flags, slotCount == _bitsPerScanMap);
 		}
+
+		/* Example objects carry no field metadata, so only the first slot is described as hot */
+		_hotFieldsDescriptor = (0 < slotCount) ? 1 : 0;
 	}
 
 public:
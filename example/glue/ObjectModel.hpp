@@ -26,6 +26,7 @@
 #include "Bits.hpp"
 #include "ObjectModelBase.hpp"
 #include "ObjectModelDelegate.hpp"
+#include "SlotObject.hpp"
 
 class MM_GCExtensionsBase;
 
@@ -88,6 +89,39 @@ public:
 		setObjectSizeAndFlags(objectPtr, size, getObjectFlags(objectPtr));
 	}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * Get the size an object consumed before it was copied. Objects in this object model do not change
+	 * shape when they are moved, so this is the consumed size of the copy.
+	 * @param objectPtr Pointer to the copy of an object
+	 * @return consumed size in bytes of the original object
+	 */
+	MMINLINE uintptr_t
+	getConsumedSizeInBytesWithHeaderBeforeMove(omrobjectptr_t objectPtr)
+	{
+		return getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+
+	/**
+	 * Load barrier fast path for Concurrent Scavenger. If the object referenced from a slot has already been
+	 * copied, the slot is healed to refer to the copy. The slot is left as it is if another thread changed
+	 * it in the meantime.
+	 * @param slotObject the slot that was loaded
+	 * @param objectPtr the reference that was loaded from the slot
+	 * @return the copy of the object, or NULL if it has not been copied yet
+	 */
+	MMINLINE omrobjectptr_t
+	healForwardedSlot(GC_SlotObject *slotObject, omrobjectptr_t objectPtr)
+	{
+		MM_ForwardedHeader forwardedHeader(objectPtr);
+		omrobjectptr_t forwardedPtr = forwardedHeader.getForwardedObject();
+		if (NULL != forwardedPtr) {
+			slotObject->atomicWriteReferenceToSlot(objectPtr, forwardedPtr);
+		}
+		return forwardedPtr;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	/**
 	 * Constructor.
 	 */
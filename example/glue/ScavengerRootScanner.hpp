@@ -84,19 +84,36 @@ public:
 					rootEntry = (RootEntry *)hashTableNextDo(&state);
 				}
 			}
-			OMR_VMThread *walkThread;
-			GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
-			while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
-				if (NULL != walkThread->_savedObject1) {
-					_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject1);
-				}
-				if (NULL != walkThread->_savedObject2) {
-					_scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t *) &walkThread->_savedObject2);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+			/* Concurrent Scavenger leaves thread roots to the threads themselves (see MM_Scavenger::switchConcurrentForThread()) */
+			if (!_scavenger->isConcurrentInProgress())
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+			{
+				OMR_VMThread *walkThread;
+				GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+				while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+					scanThreadRoots(envStd, walkThread);
 				}
 			}
 			env->_currentTask->releaseSynchronizedGCThreads(env);
 		}
 	}
+
+	/**
+	 * Copy the objects referenced from the roots held by a single thread.
+	 * @param[in] env the scanning thread
+	 * @param[in] walkThread the thread owning the roots, which must not be mutating them
+	 */
+	void
+	scanThreadRoots(MM_EnvironmentStandard *env, OMR_VMThread *walkThread)
+	{
+		if (NULL != walkThread->_savedObject1) {
+			_scavenger->copyObjectSlot(env, (volatile omrobjectptr_t *) &walkThread->_savedObject1);
+		}
+		if (NULL != walkThread->_savedObject2) {
+			_scavenger->copyObjectSlot(env, (volatile omrobjectptr_t *) &walkThread->_savedObject2);
+		}
+	}
 	
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 	void rescanThreadSlots(MM_EnvironmentStandard *env) { }
@@ -120,8 +137,8 @@ public:
 					}
 					objectEntry = (ObjectEntry *)hashTableNextDo(&state);
 				}
+				env->_currentTask->releaseSynchronizedGCThreads(env);
 			}
-			env->_currentTask->releaseSynchronizedGCThreads(env);
 		}
 	}
 
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "gcTestHelpers.hpp"
+
+/**
+ * A forge separate from the one of the collector, so that its thread caches and
+ * native memory can be observed on their own.
+ */
+class TestForge : public MM_Forge
+{
+public:
+	bool initialize(MM_EnvironmentBase *env) { return MM_Forge::initialize(env); }
+	void tearDown(MM_EnvironmentBase *env) { MM_Forge::tearDown(env); }
+	uintptr_t getThreadCacheCount() { return _threadCacheCount; }
+};
+
+typedef struct ForgeThreadData {
+	TestForge *forge;
+	omrthread_monitor_t monitor;
+	bool cached; /**< set by the thread once its block is in its cache */
+	bool release; /**< set by the test to let the thread exit */
+} ForgeThreadData;
+
+static uintptr_t
+countLiveAllocations(uint32_t categoryCode, const char *categoryName, uintptr_t liveBytes, uintptr_t liveAllocations, BOOLEAN isRoot, uint32_t parentCategoryCode, OMRMemCategoryWalkState *state)
+{
+	if (OMRMEM_CATEGORY_MM == categoryCode) {
+		*(uintptr_t *)state->userData1 = liveAllocations;
+		return J9MEM_CATEGORIES_STOP_ITERATING;
+	}
+	return J9MEM_CATEGORIES_KEEP_ITERATING;
+}
+
+static uintptr_t
+getLiveAllocations(OMRPortLibrary *portLib)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLib);
+	uintptr_t liveAllocations = 0;
+	OMRMemCategoryWalkState walkState;
+	memset(&walkState, 0, sizeof(walkState));
+	walkState.walkFunction = countLiveAllocations;
+	walkState.userData1 = &liveAllocations;
+	omrmem_walk_categories(&walkState);
+	return liveAllocations;
+}
+
+/**
+ * Allocate and free a small block, leaving it in the thread's cache, then wait until released.
+ */
+static int J9THREAD_PROC
+allocateAndFree(void *entryArg)
+{
+	ForgeThreadData *data = (ForgeThreadData *)entryArg;
+	data->forge->free(data->forge->allocate(100, MM_AllocationCategory::OTHER, OMR_GET_CALLSITE()));
+
+	omrthread_monitor_enter(data->monitor);
+	data->cached = true;
+	omrthread_monitor_notify_all(data->monitor);
+	while (!data->release) {
+		omrthread_monitor_wait(data->monitor);
+	}
+	omrthread_monitor_exit(data->monitor);
+	return 0;
+}
+
+class ForgeTest : public ::testing::Test
+{
+protected:
+	omrthread_monitor_t monitor;
+
+	virtual void
+	SetUp()
+	{
+		ASSERT_EQ(0, omrthread_monitor_init_with_name(&monitor, 0, "ForgeTest"));
+	}
+
+	virtual void
+	TearDown()
+	{
+		omrthread_monitor_destroy(monitor);
+	}
+
+	/**
+	 * Start a thread that leaves a block in its cache, and wait until it has done so.
+	 */
+	void
+	startThread(omrthread_t *thread, ForgeThreadData *data, TestForge *forge)
+	{
+		data->forge = forge;
+		data->monitor = monitor;
+		data->cached = false;
+		data->release = false;
+
+		omrthread_attr_t attr = NULL;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(thread, &attr, 0, allocateAndFree, data));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+
+		omrthread_monitor_enter(monitor);
+		while (!data->cached) {
+			omrthread_monitor_wait(monitor);
+		}
+		omrthread_monitor_exit(monitor);
+	}
+
+	/**
+	 * Let a thread started by startThread() exit, and wait until it has.
+	 */
+	void
+	stopThread(omrthread_t thread, ForgeThreadData *data)
+	{
+		omrthread_monitor_enter(monitor);
+		data->release = true;
+		omrthread_monitor_notify_all(monitor);
+		omrthread_monitor_exit(monitor);
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(thread));
+	}
+};
+
+TEST_F(ForgeTest, reuseThreadCacheAfterDetach)
+{
+	MM_EnvironmentBase env(gcTestEnv->exampleVM._omrVM);
+	TestForge forge;
+	ASSERT_TRUE(forge.initialize(&env));
+	uintptr_t liveAllocations = getLiveAllocations(gcTestEnv->portLib);
+
+	omrthread_t thread = NULL;
+	ForgeThreadData data;
+	ASSERT_NO_FATAL_FAILURE(startThread(&thread, &data, &forge));
+	ASSERT_EQ((uintptr_t)1, forge.getThreadCacheCount());
+	ASSERT_NO_FATAL_FAILURE(stopThread(thread, &data));
+
+	/* the cache of the exited thread keeps no blocks, and is the one given to the next thread */
+	EXPECT_EQ(liveAllocations + 1, getLiveAllocations(gcTestEnv->portLib)) << "only the cache itself should remain";
+	ASSERT_NO_FATAL_FAILURE(startThread(&thread, &data, &forge));
+	EXPECT_EQ((uintptr_t)1, forge.getThreadCacheCount());
+	ASSERT_NO_FATAL_FAILURE(stopThread(thread, &data));
+
+	forge.tearDown(&env);
+	EXPECT_EQ(liveAllocations, getLiveAllocations(gcTestEnv->portLib));
+}
+
+TEST_F(ForgeTest, tearDownReleasesThreadCaches)
+{
+	uintptr_t liveAllocations = getLiveAllocations(gcTestEnv->portLib);
+	MM_EnvironmentBase env(gcTestEnv->exampleVM._omrVM);
+	TestForge forge;
+	ASSERT_TRUE(forge.initialize(&env));
+
+	/* leave blocks in the caches of this thread and of a thread that is still running at tear down */
+	forge.free(forge.allocate(100, MM_AllocationCategory::OTHER, OMR_GET_CALLSITE()));
+	omrthread_t thread = NULL;
+	ForgeThreadData data;
+	ASSERT_NO_FATAL_FAILURE(startThread(&thread, &data, &forge));
+	ASSERT_EQ((uintptr_t)2, forge.getThreadCacheCount());
+
+	forge.tearDown(&env);
+	EXPECT_EQ(liveAllocations, getLiveAllocations(gcTestEnv->portLib));
+
+	/* the finalizer of the forgotten cache must not run when the thread exits */
+	ASSERT_NO_FATAL_FAILURE(stopThread(thread, &data));
+	EXPECT_EQ(liveAllocations, getLiveAllocations(gcTestEnv->portLib));
+}
+
+TEST_F(ForgeTest, highwaterTracksEveryAllocation)
+{
+	MM_EnvironmentBase env(gcTestEnv->exampleVM._omrVM);
+	TestForge forge;
+	ASSERT_TRUE(forge.initialize(&env));
+
+	void *small = forge.allocate(100, MM_AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	void *large = forge.allocate(10000, MM_AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	ASSERT_TRUE((NULL != small) && (NULL != large));
+	forge.free(large);
+	forge.free(small);
+
+	MM_MemoryStatistics *statistics = forge.getCurrentStatistics();
+	EXPECT_EQ((uintptr_t)0, statistics[MM_AllocationCategory::OTHER].allocated);
+	EXPECT_EQ((uintptr_t)10100, statistics[MM_AllocationCategory::OTHER].highwater);
+
+	/* a lower peak since the last report does not lower the highwater */
+	small = forge.allocate(100, MM_AllocationCategory::OTHER, OMR_GET_CALLSITE());
+	ASSERT_TRUE(NULL != small);
+	statistics = forge.getCurrentStatistics();
+	EXPECT_EQ((uintptr_t)100, statistics[MM_AllocationCategory::OTHER].allocated);
+	EXPECT_EQ((uintptr_t)10100, statistics[MM_AllocationCategory::OTHER].highwater);
+	forge.free(small);
+
+	forge.tearDown(&env);
+}
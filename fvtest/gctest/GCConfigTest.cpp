@@ -16,15 +16,22 @@
  *    Multiple authors (IBM Corp.) - initial implementation and documentation
  *******************************************************************************/
 
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "HeapWalker.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
 #include "SlotObject.hpp"
+#include "VerboseGCDecoder.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseWriterHook.hpp"
 
 //#define OMRGCTEST_PRINTFILE
 
@@ -36,6 +43,63 @@
 #define STRINGFY(str) DO_STRINGFY(str)
 #define DO_STRINGFY(str) #str
 
+static bool
+appendVerboseLogText(void *userData, const char *text, size_t length)
+{
+	VerboseLogText *log = (VerboseLogText *)userData;
+	OMRPORT_ACCESS_FROM_OMRPORT(log->portLib);
+
+	if ((log->capacity - log->length) < length) {
+		uintptr_t newCapacity = (log->length + length) * 2;
+		char *newText = (char *)omrmem_reallocate_memory(log->text, newCapacity, OMRMEM_CATEGORY_MM);
+		if (NULL == newText) {
+			return false;
+		}
+		log->text = newText;
+		log->capacity = newCapacity;
+	}
+	memcpy(log->text + log->length, text, length);
+	log->length += length;
+	return true;
+}
+
+static void
+captureVerboseText(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_VerboseGCOutputEvent *event = (MM_VerboseGCOutputEvent *)eventData;
+	appendVerboseLogText(userData, event->string, strlen(event->string));
+}
+
+/**
+ * Two elements are the same if they have the same name, the same attributes in the same order
+ * and the same child elements.
+ */
+static bool
+isSameElement(pugi::xml_node left, pugi::xml_node right)
+{
+	if (0 != strcmp(left.name(), right.name())) {
+		return false;
+	}
+	pugi::xml_attribute leftAttr = left.first_attribute();
+	pugi::xml_attribute rightAttr = right.first_attribute();
+	for (; leftAttr && rightAttr; leftAttr = leftAttr.next_attribute(), rightAttr = rightAttr.next_attribute()) {
+		if ((0 != strcmp(leftAttr.name(), rightAttr.name())) || (0 != strcmp(leftAttr.value(), rightAttr.value()))) {
+			return false;
+		}
+	}
+	if (leftAttr || rightAttr) {
+		return false;
+	}
+	pugi::xml_node leftChild = left.first_child();
+	pugi::xml_node rightChild = right.first_child();
+	for (; leftChild && rightChild; leftChild = leftChild.next_sibling(), rightChild = rightChild.next_sibling()) {
+		if (!isSameElement(leftChild, rightChild)) {
+			return false;
+		}
+	}
+	return !(leftChild || rightChild);
+}
+
 void
 GCConfigTest::SetUp()
 {
@@ -50,6 +114,15 @@ GCConfigTest::SetUp()
 	omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
 	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
 
+#if defined(OMR_GC_COMPRESSED_POINTERS)
+	/* a forced shift must be the one references are encoded with, rather than one derived from where the heap landed */
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(exampleVM->_omrVM);
+	if (extensions->shouldForceSpecifiedShiftingCompression) {
+		ASSERT_EQ(extensions->forcedShiftingCompressionAmount, exampleVM->_omrVM->_compressedPointersShift) << "Setup(): the forced compressed references shift is not in use";
+		gcTestEnv->log("Compressed references shift: %zu, object alignment: %zu\n", exampleVM->_omrVM->_compressedPointersShift, extensions->getObjectAlignmentInBytes());
+	}
+#endif /* defined(OMR_GC_COMPRESSED_POINTERS) */
+
 	/* Attach calling thread to the VM */
 	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
 	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
@@ -89,6 +162,17 @@ GCConfigTest::SetUp()
 	omrstr_printf(verboseFile, MAX_NAME_LENGTH, "%s_%d_%lld.xml", verboseFileNamePrefix, omrsysinfo_get_pid(), omrtime_current_time_millis());
 	verboseManager = MM_VerboseManager::newInstance(env, exampleVM->_omrVM);
 	verboseManager->configureVerboseGC(exampleVM->_omrVM, verboseFile, numOfFiles, numOfCycles);
+	if (env->getExtensions()->verboseBinaryFormat) {
+		/* capture the text of the same output through the verbose hook, to check what the binary log decodes to */
+		MM_VerboseWriterHook *textWriter = MM_VerboseWriterHook::newInstance(env);
+		if (NULL == textWriter) {
+			FAIL() << "Failed to create verbose hook writer.";
+		}
+		textWriter->isActive(true);
+		verboseManager->getWriterChain()->addWriter(textWriter);
+		J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(env->getExtensions()->omrHookInterface);
+		(*mmOmrHooks)->J9HookRegister(mmOmrHooks, J9HOOK_MM_OMR_VERBOSE_GC_OUTPUT, captureVerboseText, (void *)&verboseText);
+	}
 	gcTestEnv->log("Verbose File: %s\n", verboseFile);
 	gcTestEnv->log(LEVEL_VERBOSE, "Verbose GC log name: %s; numOfFiles: %d; numOfCycles: %d.\n", verboseFile, numOfFiles, numOfCycles);
 	verboseManager->enableVerboseGC();
@@ -130,6 +214,12 @@ GCConfigTest::TearDown()
 		verboseManager->kill(env);
 		verboseManager = NULL;
 	}
+	if ((NULL != env) && env->getExtensions()->verboseBinaryFormat) {
+		J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(env->getExtensions()->omrHookInterface);
+		(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_VERBOSE_GC_OUTPUT, captureVerboseText, (void *)&verboseText);
+	}
+	omrmem_free_memory((void *)verboseText.text);
+	verboseText.text = NULL;
 	if ((NULL != verboseFile) && (false == gcTestEnv->keepLog)) {
 		if (0 == numOfFiles) {
 			J9FileStat buf;
@@ -286,6 +376,10 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
 			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+	/* All references of the test thread are held in the root table, so it is at a safe point even when it may not collect.
+	 * Concurrent mark relies on this to get past kickoff, as the example VM takes no safe point callbacks.
+	 */
+	noGc->getAllocateDescription()->setThreadIsAtSafePoint(true);
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
 
 	if (NULL == objEntry.objPtr) {
@@ -587,6 +681,8 @@ GCConfigTest::attachChildEntry(ObjectEntry *parentEntry, ObjectEntry *childEntry
 {
 	int32_t rc = 0;
 	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	cli->readBarrierLoadRoot(exampleVM->_omrVMThread, &parentEntry->objPtr);
+	cli->readBarrierLoadRoot(exampleVM->_omrVMThread, &childEntry->objPtr);
 	uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentEntry->objPtr);
 	fomrobject_t *firstSlot = (fomrobject_t *)parentEntry->objPtr + 1;
 	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentEntry->objPtr + size);
@@ -665,7 +761,7 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 
 	while (currentSlot < endSlot) {
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
-		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
+		if (objEntry->objPtr == cli->readBarrierLoad(exampleVM->_omrVMThread, currentSlot)) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, *(objEntry->objPtr), parentEntry->name, parentEntry->objPtr, *(parentEntry->objPtr), slotObject.readAddressFromSlot());
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
@@ -786,6 +882,88 @@ printFile(const char *name)
 }
 #endif
 
+pugi::xml_parse_result
+GCConfigTest::loadVerboseLog(pugi::xml_document *verboseDoc, const char *name)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+
+	if (!extensions->verboseBinaryFormat) {
+		return verboseDoc->load_file(name);
+	}
+
+	/* binary logs are decoded to XML in memory before they are parsed */
+	pugi::xml_parse_result result;
+	intptr_t fileDescriptor = omrfile_open(name, EsOpenRead, 0444);
+	if (-1 == fileDescriptor) {
+		result.status = pugi::status_file_not_found;
+		return result;
+	}
+
+	VerboseLogText log = { gcTestEnv->portLib, NULL, 0, 0 };
+	VerboseGCDecoder decoder(VerboseGCDecoder::OUTPUT_XML, appendVerboseLogText, &log);
+	VerboseGCDecoder::Result decodeResult = VerboseGCDecoder::RESULT_OK;
+	uint8_t readBuf[2048];
+	intptr_t bytesRead = 0;
+	while ((VerboseGCDecoder::RESULT_OK == decodeResult) && (0 < (bytesRead = omrfile_read(fileDescriptor, readBuf, sizeof(readBuf))))) {
+		decodeResult = decoder.decode(readBuf, (size_t)bytesRead);
+	}
+	omrfile_close(fileDescriptor);
+	if (VerboseGCDecoder::RESULT_OK == decodeResult) {
+		decodeResult = decoder.finish();
+	}
+
+	if (VerboseGCDecoder::RESULT_OK == decodeResult) {
+		result = verboseDoc->load_buffer(log.text, log.length);
+	} else {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode binary verbose log %s: %s.\n", __FILE__, __LINE__, name, VerboseGCDecoder::describe(decodeResult));
+		result.status = pugi::status_io_error;
+	}
+	omrmem_free_memory(log.text);
+	return result;
+}
+
+int32_t
+GCConfigTest::verifyDecodedVerboseLog(pugi::xml_document *verboseDoc)
+{
+	/* the captured text has no header, so its records are wrapped in a root element of their own */
+	const char *rootStart = "<verbosegc>";
+	const char *rootEnd = "</verbosegc>";
+	VerboseLogText wrapped = { gcTestEnv->portLib, NULL, 0, 0 };
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	int32_t rt = 0;
+
+	pugi::xml_document textDoc;
+	if (!appendVerboseLogText(&wrapped, rootStart, strlen(rootStart))
+		|| !appendVerboseLogText(&wrapped, verboseText.text, verboseText.length)
+		|| !appendVerboseLogText(&wrapped, rootEnd, strlen(rootEnd))
+		|| !textDoc.load_buffer(wrapped.text, wrapped.length)
+	) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to parse the text captured alongside the binary verbose log.\n", __FILE__, __LINE__);
+		rt = 1;
+	} else {
+		/* a rotated log holds a run of consecutive records; find where its first record was written and match the rest from there */
+		pugi::xml_node decoded = verboseDoc->document_element().first_child();
+		pugi::xml_node text = textDoc.document_element().first_child();
+		if (!decoded) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Binary verbose log decodes to no records.\n", __FILE__, __LINE__);
+			rt = 1;
+		}
+		while (text && decoded && !isSameElement(decoded, text)) {
+			text = text.next_sibling();
+		}
+		for (; decoded && (0 == rt); decoded = decoded.next_sibling(), text = text.next_sibling()) {
+			if (!text || !isSameElement(decoded, text)) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Decoded record <%s id=\"%s\"> does not match the text verbose output.\n", __FILE__, __LINE__, decoded.name(), decoded.attribute("id").value());
+				rt = 1;
+			}
+		}
+	}
+
+	omrmem_free_memory((void *)wrapped.text);
+	return rt;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -806,8 +984,9 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
+		pugi::xml_parse_result result;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			result = loadVerboseLog(&verboseDoc, verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -815,7 +994,7 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
+			result = loadVerboseLog(&verboseDoc, currentVerboseFile);
 			if (pugi::status_file_not_found == result.status) {
 				break;
 			}
@@ -825,6 +1004,17 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 #endif
 		}
 
+		/* a binary log must decode to the same records as the text written alongside it */
+		if (env->getExtensions()->verboseBinaryFormat && (0 != verifyDecodedVerboseLog(&verboseDoc))) {
+			rt = 1;
+		}
+
+		/* a closed log must be complete, up to and including its footer */
+		if (verboseLogClosed && (pugi::status_ok != result.status)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Closed verbose log is not well formed: %s.\n", __FILE__, __LINE__, result.description());
+		}
+
 		/* verify each xquery criteria */
 		int32_t i = 0;
 		for (pugi::xpath_node_set::const_iterator it = verboseGCs.begin(); it != verboseGCs.end(); ++it) {
@@ -930,6 +1120,159 @@ done:
 	return rt;
 }
 
+static void
+heapWalkCountObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	HeapWalkCounts *counts = (HeapWalkCounts *)userData;
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(omrVMThread->_vm);
+	counts->objectCount += 1;
+	counts->objectBytes += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	if (0 != ((uintptr_t)object & (extensions->getObjectAlignmentInBytes() - 1))) {
+		counts->misalignedCount += 1;
+	}
+}
+
+static void *
+heapWalkThreadStart(OMR_VMThread *omrVMThread, void *userData)
+{
+	OMRPORT_ACCESS_FROM_OMRVMTHREAD(omrVMThread);
+	HeapWalkCounts *threadCounts = (HeapWalkCounts *)omrmem_allocate_memory(sizeof(HeapWalkCounts), OMRMEM_CATEGORY_MM);
+	if (NULL != threadCounts) {
+		threadCounts->objectCount = 0;
+		threadCounts->objectBytes = 0;
+		threadCounts->misalignedCount = 0;
+	}
+	return threadCounts;
+}
+
+static void
+heapWalkThreadEnd(OMR_VMThread *omrVMThread, void *userData, void *threadUserData)
+{
+	OMRPORT_ACCESS_FROM_OMRVMTHREAD(omrVMThread);
+	HeapWalkCounts *counts = (HeapWalkCounts *)userData;
+	HeapWalkCounts *threadCounts = (HeapWalkCounts *)threadUserData;
+	MM_AtomicOperations::add(&counts->objectCount, threadCounts->objectCount);
+	MM_AtomicOperations::add(&counts->objectBytes, threadCounts->objectBytes);
+	MM_AtomicOperations::add(&counts->misalignedCount, threadCounts->misalignedCount);
+	omrmem_free_memory(threadCounts);
+}
+
+static void
+heapWalkAddObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	hashTableAdd((J9HashTable *)userData, &object);
+}
+
+static uintptr_t
+heapObjectHashFn(void *entry, void *userData)
+{
+	return (uintptr_t)*(omrobjectptr_t *)entry;
+}
+
+static uintptr_t
+heapObjectHashEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return *(omrobjectptr_t *)leftEntry == *(omrobjectptr_t *)rightEntry;
+}
+
+uintptr_t
+GCConfigTest::countReferencesToNonObjects(J9HashTable *heapObjects)
+{
+	uintptr_t count = 0;
+	J9HashTableState state;
+	RootEntry *rootEntry = (RootEntry *)hashTableStartDo(exampleVM->rootTable, &state);
+	while (NULL != rootEntry) {
+		if ((NULL != rootEntry->rootPtr) && (NULL == hashTableFind(heapObjects, &rootEntry->rootPtr))) {
+			gcTestEnv->log(LEVEL_ERROR, "Root %s refers to %p, which is not an object of the heap.\n", rootEntry->name, rootEntry->rootPtr);
+			count += 1;
+		}
+		rootEntry = (RootEntry *)hashTableNextDo(&state);
+	}
+
+	/* After a collection, the object table only holds live objects, which only refer to live objects */
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(exampleVM->objectTable, &state);
+	while (NULL != objectEntry) {
+		if (NULL == hashTableFind(heapObjects, &objectEntry->objPtr)) {
+			gcTestEnv->log(LEVEL_ERROR, "Object %s is at %p, which is not an object of the heap.\n", objectEntry->name, objectEntry->objPtr);
+			count += 1;
+		} else {
+			uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(objectEntry->objPtr);
+			fomrobject_t *currentSlot = (fomrobject_t *)objectEntry->objPtr + 1;
+			fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)objectEntry->objPtr + size);
+			while (currentSlot < endSlot) {
+				GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
+				omrobjectptr_t referent = slotObject.readReferenceFromSlot();
+				if ((NULL != referent) && (NULL == hashTableFind(heapObjects, &referent))) {
+					gcTestEnv->log(LEVEL_ERROR, "Object %s refers to %p, which is not an object of the heap.\n", objectEntry->name, referent);
+					count += 1;
+				}
+				currentSlot += 1;
+			}
+		}
+		objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+	}
+	return count;
+}
+
+int32_t
+GCConfigTest::walkHeap(bool expectChunks)
+{
+	int32_t rt = 0;
+	HeapWalkCounts serialCounts = {0, 0, 0};
+	HeapWalkCounts parallelCounts = {0, 0, 0};
+	MM_HeapWalker *heapWalker = MM_HeapWalker::newInstance(env);
+	if (NULL == heapWalker) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create heap walker.\n", __FILE__, __LINE__);
+		return 1;
+	}
+
+	J9HashTable *heapObjects = hashTableNew(
+			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(omrobjectptr_t), 0, 0, OMRMEM_CATEGORY_MM,
+			heapObjectHashFn, heapObjectHashEqualFn, NULL, NULL);
+	if (NULL == heapObjects) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create heap object table.\n", __FILE__, __LINE__);
+		heapWalker->kill(env);
+		return 1;
+	}
+
+	uintptr_t regionCount = 0;
+	GC_HeapRegionIterator regionIterator(env->getExtensions()->heap->getHeapRegionManager());
+	while (NULL != regionIterator.nextRegion()) {
+		regionCount += 1;
+	}
+
+	env->acquireExclusiveVMAccess();
+	heapWalker->allObjectsDo(env, heapWalkCountObject, &serialCounts, 0, false, false);
+	uintptr_t workUnitCount = heapWalker->parallelObjectsDo(env, heapWalkCountObject, heapWalkThreadStart, heapWalkThreadEnd, &parallelCounts, 0);
+	heapWalker->allObjectsDo(env, heapWalkAddObject, heapObjects, 0, false, false);
+	uintptr_t badReferenceCount = countReferencesToNonObjects(heapObjects);
+	env->releaseExclusiveVMAccess();
+	hashTableFree(heapObjects);
+	heapWalker->kill(env);
+
+	gcTestEnv->log("Heap walk found %zu objects (%zu bytes), parallel heap walk found %zu objects (%zu bytes) in %zu work units over %zu regions\n",
+			serialCounts.objectCount, serialCounts.objectBytes, parallelCounts.objectCount, parallelCounts.objectBytes, workUnitCount, regionCount);
+	if ((serialCounts.objectCount != parallelCounts.objectCount) || (serialCounts.objectBytes != parallelCounts.objectBytes)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk does not match heap walk.\n", __FILE__, __LINE__);
+		rt = 1;
+	}
+	if (expectChunks && (workUnitCount <= regionCount)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Parallel heap walk did not divide any region into chunks.\n", __FILE__, __LINE__);
+		rt = 1;
+	}
+	if ((0 != serialCounts.misalignedCount) || (0 != parallelCounts.misalignedCount)) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walk found %zu objects not aligned to %zu bytes.\n",
+				__FILE__, __LINE__, OMR_MAX(serialCounts.misalignedCount, parallelCounts.misalignedCount), env->getExtensions()->getObjectAlignmentInBytes());
+		rt = 1;
+	}
+	if (0 != badReferenceCount) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walk found %zu references to addresses that are not objects of the heap.\n", __FILE__, __LINE__, badReferenceCount);
+		rt = 1;
+	}
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -950,6 +1293,14 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "heapWalk")) {
+			gcTestEnv->log("Invoking heap walk...\n");
+			rt = walkHeap(0 == strcmp(node.attribute("expectChunks").value(), "true"));
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "sleep")) {
+			int64_t millis = (int64_t)atoi(node.attribute("ms").value());
+			gcTestEnv->log("Sleeping for %lld ms...\n", millis);
+			omrthread_sleep(millis);
 		}
 	}
 done:
@@ -1021,6 +1372,13 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
+			if (configChild.attribute("closeVerboseLog").as_bool()) {
+				/* verify the log as it is left at shutdown rather than while it is still being written */
+				verboseManager->closeStreams(env);
+				verboseLogClosed = true;
+			} else {
+				verboseManager->waitForOutput(env);
+			}
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
@@ -53,6 +53,19 @@ typedef struct GarbagePolicy {
 	uintptr_t accumulatedSize;
 } GarbagePolicy;
 
+typedef struct HeapWalkCounts {
+	uintptr_t objectCount;
+	uintptr_t objectBytes;
+	uintptr_t misalignedCount; /**< objects not aligned to the object alignment, which is 1 << shift with compressed references */
+} HeapWalkCounts;
+
+typedef struct VerboseLogText {
+	OMRPortLibrary *portLib;
+	char *text;
+	uintptr_t length;
+	uintptr_t capacity;
+} VerboseLogText;
+
 typedef struct XmlStr {
 	const char *object;
 	const char *namePrefix;
@@ -83,6 +96,8 @@ protected:
 	MM_VerboseManager *verboseManager;
 	char *verboseFile;
 	uintptr_t numOfFiles;
+	bool verboseLogClosed; /**< set once the verbose log is closed for verification, after which it must be well formed */
+	VerboseLogText verboseText; /**< text of the verbose output, captured alongside a binary log to check what the log decodes to */
 
 	/*
 	 * Function members
@@ -104,9 +119,13 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_result loadVerboseLog(pugi::xml_document *verboseDoc, const char *name);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+	int32_t verifyDecodedVerboseLog(pugi::xml_document *verboseDoc);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	uintptr_t countReferencesToNonObjects(J9HashTable *heapObjects);
+	int32_t walkHeap(bool expectChunks);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -123,6 +142,9 @@ protected:
 	 *
 	 * Also, for these reasons, use of GC_ObjectIterator in mutator (GCConfigTest) code is strongly
 	 * discouraged.
+	 *
+	 * The object of a found entry is loaded through the read barrier, so that it is never used from
+	 * evacuate space while a concurrent scavenge is in progress.
 	 */
 
 	ObjectEntry *
@@ -130,7 +152,11 @@ protected:
 	{
 		ObjectEntry searchEntry;
 		searchEntry.name = name;
-		return (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		ObjectEntry *foundEntry = (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		if (NULL != foundEntry) {
+			cli->readBarrierLoadRoot(exampleVM->_omrVMThread, &foundEntry->objPtr);
+		}
+		return foundEntry;
 	}
 
 	ObjectEntry *
@@ -156,7 +182,13 @@ public:
 		, verboseManager(NULL)
 		, verboseFile(NULL)
 		, numOfFiles(0)
+		, verboseLogClosed(false)
 	{
+		verboseText.portLib = gcTestEnv->portLib;
+		verboseText.text = NULL;
+		verboseText.length = 0;
+		verboseText.capacity = 0;
+
 		gp.namePrefix = NULL;
 		gp.percentage = 0.0f;
 		gp.frequency = "none";
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "HeapMapWordScan.hpp"
+#include "gcTestHelpers.hpp"
+
+#define MAX_RANGE_WORDS 72 /**< covers several blocks of the widest scan, plus partial blocks either side */
+#define MAX_START_OFFSET 8 /**< starts the range at every word within the widest block */
+#define GUARD_WORDS 8 /**< non-zero words either side of the range, which a scan must not report */
+
+static const char *implementationNames[] = { "scalar", "SSE2", "AVX2" };
+
+/**
+ * The word-at-a-time scan every implementation must agree with.
+ */
+static uintptr_t *
+referenceSkipEmptyWords(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+class HeapMapWordScanTest : public ::testing::Test
+{
+protected:
+	uintptr_t words[GUARD_WORDS + MAX_START_OFFSET + MAX_RANGE_WORDS + GUARD_WORDS];
+
+	/**
+	 * Zero the words the range may cover, and make every word outside them non-zero.
+	 */
+	void
+	clearWords()
+	{
+		for (uintptr_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+			words[i] = ((i < GUARD_WORDS) || (i >= (GUARD_WORDS + MAX_START_OFFSET + MAX_RANGE_WORDS))) ? UDATA_MAX : 0;
+		}
+	}
+
+	/**
+	 * Scan every range with a non-zero word at each position (or none), and compare against the reference scan.
+	 */
+	void
+	compareWithReference(MM_HeapMapWordScan::SkipEmptyWordsFunction skipEmptyWords, uintptr_t liveWord)
+	{
+		for (uintptr_t offset = 0; offset < MAX_START_OFFSET; offset++) {
+			for (uintptr_t length = 0; length <= MAX_RANGE_WORDS; length++) {
+				uintptr_t *current = &words[GUARD_WORDS + offset];
+				uintptr_t *top = current + length;
+				/* words just outside the range are non-zero, and must not be reported */
+				uintptr_t before = current[-1];
+				uintptr_t after = *top;
+				current[-1] = UDATA_MAX;
+				*top = UDATA_MAX;
+				for (uintptr_t live = 0; live <= length; live++) {
+					if (live < length) {
+						current[live] = liveWord;
+					}
+					ASSERT_EQ(referenceSkipEmptyWords(current, top), skipEmptyWords(current, top))
+						<< "offset " << offset << " length " << length << " live word " << live;
+					if (live < length) {
+						current[live] = 0;
+					}
+				}
+				current[-1] = before;
+				*top = after;
+			}
+		}
+	}
+};
+
+TEST_F(HeapMapWordScanTest, implementationsMatchScalarScan)
+{
+	for (uintptr_t implementation = 0; implementation < MM_HeapMapWordScan::IMPLEMENTATION_COUNT; implementation++) {
+		MM_HeapMapWordScan::SkipEmptyWordsFunction skipEmptyWords = MM_HeapMapWordScan::getImplementation((MM_HeapMapWordScan::Implementation)implementation);
+		if (NULL == skipEmptyWords) {
+			gcTestEnv->log(LEVEL_VERBOSE, "%s scan is not supported\n", implementationNames[implementation]);
+			continue;
+		}
+		gcTestEnv->log(LEVEL_VERBOSE, "Testing %s scan\n", implementationNames[implementation]);
+		clearWords();
+		compareWithReference(skipEmptyWords, UDATA_MAX);
+		/* a single bit in each byte of a word, since the vector scans compare bytes or lanes */
+		for (uintptr_t bit = 0; bit < (sizeof(uintptr_t) * 8); bit += 7) {
+			clearWords();
+			compareWithReference(skipEmptyWords, ((uintptr_t)1) << bit);
+		}
+	}
+}
+
+TEST_F(HeapMapWordScanTest, skipEmptyWordsMatchesScalarScan)
+{
+	gcTestEnv->log(LEVEL_VERBOSE, "Selected %s scan\n", implementationNames[MM_HeapMapWordScan::getBestImplementation()]);
+#if defined(__x86_64__) || defined(_M_X64)
+	/* every x86-64 processor supports SSE2 */
+	ASSERT_LE(MM_HeapMapWordScan::SSE2, MM_HeapMapWordScan::getBestImplementation());
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+	clearWords();
+	compareWithReference(MM_HeapMapWordScan::skipEmptyWords, ((uintptr_t)1) << 3);
+}
@@ -0,0 +1,238 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#include "omrgcstartup.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+#include "RegionPoolSegregated.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#define REGION_COUNT 16 /**< regions shared by the threads, fewer than the threads can hold so that they keep running dry */
+#define THREAD_COUNT 4
+#define ITERATIONS 20000 /**< operations done by each thread */
+#define BATCH_SIZE 3 /**< regions a thread moves at once with detach() and enqueue(front, back, count) */
+
+/* the options of this config give a small segregated heap; its allocation and verification are not used */
+#define SEGREGATED_CONFIG "fvtest/gctest/configuration/segregatedLazySweep_GC_config.xml"
+
+typedef struct QueueThreadData {
+	MM_LockFreeHeapRegionQueue *queue;
+	MM_HeapRegionManager *regionManager;
+	volatile uintptr_t *owners; /**< per region table index, 1 while a thread holds the region */
+	uintptr_t seed;
+	uintptr_t duplicates; /**< regions this thread was given while another thread held them */
+	uintptr_t badChains; /**< detached chains whose length or prev pointers were wrong */
+} QueueThreadData;
+
+/**
+ * Claim a region taken from the queue, counting it if another thread already holds it.
+ */
+static void
+claim(QueueThreadData *data, MM_HeapRegionDescriptorSegregated *region)
+{
+	uintptr_t index = data->regionManager->physicalTableDescriptorIndexForAddress(region->getLowAddress());
+	if (0 != MM_AtomicOperations::lockCompareExchange(&data->owners[index], 0, 1)) {
+		data->duplicates += 1;
+	}
+}
+
+static void
+release(QueueThreadData *data, MM_HeapRegionDescriptorSegregated *region)
+{
+	uintptr_t index = data->regionManager->physicalTableDescriptorIndexForAddress(region->getLowAddress());
+	MM_AtomicOperations::set(&data->owners[index], 0);
+}
+
+/**
+ * Repeatedly take regions from the shared queue, one at a time or in a batch, and give them back.
+ */
+static int J9THREAD_PROC
+pushAndPop(void *entryArg)
+{
+	QueueThreadData *data = (QueueThreadData *)entryArg;
+	for (uintptr_t i = 0; i < ITERATIONS; i++) {
+		data->seed = (data->seed * 1103515245) + 12345;
+		if (0 == ((data->seed >> 16) % 4)) {
+			MM_HeapRegionDescriptorSegregated *front = NULL;
+			MM_HeapRegionDescriptorSegregated *back = NULL;
+			uintptr_t count = data->queue->detach(&front, &back, BATCH_SIZE);
+			uintptr_t length = 0;
+			MM_HeapRegionDescriptorSegregated *prev = NULL;
+			for (MM_HeapRegionDescriptorSegregated *region = front; NULL != region; region = region->getNext()) {
+				if (prev != region->getPrev()) {
+					data->badChains += 1;
+				}
+				claim(data, region);
+				prev = region;
+				length += 1;
+			}
+			if ((length != count) || (prev != back)) {
+				data->badChains += 1;
+			}
+			omrthread_yield();
+			for (MM_HeapRegionDescriptorSegregated *region = front; NULL != region; region = region->getNext()) {
+				release(data, region);
+			}
+			if (0 != count) {
+				data->queue->enqueue(front, back, count);
+			}
+		} else {
+			MM_HeapRegionDescriptorSegregated *region = data->queue->dequeue();
+			if (NULL != region) {
+				claim(data, region);
+				if (0 == ((data->seed >> 16) % 7)) {
+					omrthread_yield();
+				}
+				release(data, region);
+				data->queue->enqueue(region);
+			}
+		}
+	}
+	return 0;
+}
+
+class LockFreeHeapRegionQueueTest : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+	MM_RegionPoolSegregated *regionPool;
+	MM_HeapRegionDescriptorSegregated *regions[REGION_COUNT]; /**< taken from the free regions of the heap for the test */
+
+	virtual void
+	SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, SEGREGATED_CONFIG);
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread"));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread));
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		ASSERT_TRUE(extensions->isSegregatedHeap()) << SEGREGATED_CONFIG << " must select the segregated heap";
+		regionPool = ((MM_GlobalAllocationManagerSegregated *)extensions->globalAllocationManager)->getRegionPool();
+		for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+			regions[i] = regionPool->allocateFromRegionPool(env, 1, OMR_SIZECLASSES_LARGE, UDATA_MAX);
+			ASSERT_TRUE(NULL != regions[i]) << "the heap must have " << REGION_COUNT << " free regions";
+		}
+	}
+
+	virtual void
+	TearDown()
+	{
+		for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+			if (NULL != regions[i]) {
+				regions[i]->setNext(NULL);
+				regions[i]->setPrev(NULL);
+				regions[i]->emptyRegionReturned(env);
+				regionPool->addFreeRegion(env, regions[i]);
+			}
+		}
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownDispatcherThreads(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownCollector(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_Thread_Free(exampleVM->_omrVMThread));
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeap(exampleVM->_omrVM));
+		exampleVM->_omrVMThread = NULL;
+	}
+};
+
+TEST_F(LockFreeHeapRegionQueueTest, dequeueReturnsMostRecentlyEnqueued)
+{
+	MM_LockFreeHeapRegionQueue *queue = MM_LockFreeHeapRegionQueue::newInstance(env, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	ASSERT_TRUE(NULL != queue);
+
+	for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+		queue->enqueue(regions[i]);
+	}
+	EXPECT_EQ((uintptr_t)REGION_COUNT, queue->length());
+	for (uintptr_t i = REGION_COUNT; i > 0; i--) {
+		EXPECT_EQ(regions[i - 1], queue->dequeue());
+	}
+	EXPECT_TRUE(queue->isEmpty());
+	EXPECT_TRUE(NULL == queue->dequeue());
+
+	queue->kill(env);
+}
+
+TEST_F(LockFreeHeapRegionQueueTest, concurrentPushAndPopKeepEveryRegion)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heapRegionManager;
+	MM_LockFreeHeapRegionQueue *queue = MM_LockFreeHeapRegionQueue::newInstance(env, MM_HeapRegionList::HRL_KIND_AVAILABLE);
+	ASSERT_TRUE(NULL != queue);
+	uintptr_t ownersSize = sizeof(uintptr_t) * regionManager->getTableRegionCount();
+	volatile uintptr_t *owners = (volatile uintptr_t *)omrmem_allocate_memory(ownersSize, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != owners);
+	memset((void *)owners, 0, ownersSize);
+
+	for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+		queue->enqueue(regions[i]);
+	}
+
+	omrthread_t threads[THREAD_COUNT];
+	QueueThreadData data[THREAD_COUNT];
+	for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+		data[i].queue = queue;
+		data[i].regionManager = regionManager;
+		data[i].owners = owners;
+		data[i].seed = i + 1;
+		data[i].duplicates = 0;
+		data[i].badChains = 0;
+		omrthread_attr_t attr = NULL;
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, pushAndPop, &data[i]));
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+	}
+	for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+		ASSERT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+		EXPECT_EQ((uintptr_t)0, data[i].duplicates) << "thread " << i << " was given a region another thread held";
+		EXPECT_EQ((uintptr_t)0, data[i].badChains) << "thread " << i << " detached a malformed chain";
+	}
+
+	/* every region is back on the queue exactly once */
+	EXPECT_EQ((uintptr_t)REGION_COUNT, queue->length());
+	MM_HeapRegionDescriptorSegregated *front = NULL;
+	MM_HeapRegionDescriptorSegregated *back = NULL;
+	EXPECT_EQ((uintptr_t)REGION_COUNT, queue->detach(&front, &back, UDATA_MAX));
+	for (MM_HeapRegionDescriptorSegregated *region = front; NULL != region; region = region->getNext()) {
+		uintptr_t index = regionManager->physicalTableDescriptorIndexForAddress(region->getLowAddress());
+		EXPECT_EQ((uintptr_t)0, owners[index]) << "region " << index << " was detached twice";
+		owners[index] = 1;
+	}
+	for (uintptr_t i = 0; i < REGION_COUNT; i++) {
+		EXPECT_EQ((uintptr_t)1, owners[regionManager->physicalTableDescriptorIndexForAddress(regions[i]->getLowAddress())]) << "region " << i << " was lost";
+	}
+	EXPECT_TRUE(queue->isEmpty());
+
+	omrmem_free_memory((void *)owners);
+	queue->kill(env);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
@@ -80,8 +80,66 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDistance")) {
+					extensions->markingPrefetchDistance = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "workStealingPackets")) {
+					extensions->workStealingPackets = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "parallelSweepConnect")) {
+					extensions->parallelSweepConnect = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verifyParallelSweepConnect")) {
+					extensions->fvtest_verifyParallelSweepConnect = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveMaximumSize")) {
+					extensions->tlhAdaptiveMaximumSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveRefreshInterval")) {
+					extensions->tlhAdaptiveRefreshInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldCopyDepth")) {
+					extensions->scavengerHotFieldCopyDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "asynchronousLogging")) {
+					extensions->asynchronousLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "asynchronousLoggingBufferSize")) {
+					extensions->asynchronousLoggingBufferSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "verboseBinaryFormat")) {
+					extensions->verboseBinaryFormat = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreadingWorkPerThread")) {
+					extensions->adaptiveGCThreadingWorkPerThread = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "largeObjectArea")) {
+					extensions->largeObjectArea = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+				} else if (0 == strcmp(attr.name(), "largeObjectMinimumSize")) {
+					extensions->largeObjectMinimumSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "largeObjectPageAlignedMinimumSize")) {
+					extensions->largeObjectPageAlignedMinimumSize = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+				} else if (0 == strcmp(attr.name(), "backgroundDecommit")) {
+					extensions->backgroundDecommit = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "backgroundDecommitDelay")) {
+					extensions->backgroundDecommitDelay = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "transparentHugePages")) {
+					extensions->transparentHugePages = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "compressedRefsShift")) {
+#if defined(OMR_GC_COMPRESSED_POINTERS)
+					extensions->shouldForceSpecifiedShiftingCompression = true;
+					extensions->forcedShiftingCompressionAmount = atoi(attr.value());
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compressedRefsShift ignored, requires OMR_GC_COMPRESSED_POINTERS (e.g., SPEC=linux_x86-64_cmprssptrs)\n");
+#endif /* defined(OMR_GC_COMPRESSED_POINTERS) */
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					bool compact = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->compactOnGlobalGC = compact;
+					extensions->noCompactOnGlobalGC = !compact;
+				} else if (0 == strcmp(attr.name(), "partialCompactSize")) {
+					extensions->partialCompactSize = atoi(attr.value()) * unitSize;
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -89,8 +147,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -98,13 +162,63 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 					extensions->concurrentMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentBackgroundMark")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentBackgroundMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentBackgroundMark ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentCardCleaningMaxCards")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->fvtest_concurrentCardCleaningMaxCards = atoi(attr.value());
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentCardCleaningMaxCards ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentBackground")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentBackground = atoi(attr.value());
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentBackground ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerNUMALocal")) {
+					extensions->scavengerNUMALocal = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetRangeSlots")) {
+					extensions->scavengerRememberedSetRangeSlots = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetOverflowCards")) {
+					extensions->scavengerRememberedSetOverflowCards = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tiltedScavengeRegionSizing")) {
+					extensions->tiltedScavengeRegionSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "rememberedSetMaxSize")) {
+					extensions->rememberedSet.setMaxSize(atoi(attr.value()) * unitSize);
+				} else if (0 == strcmp(attr.name(), "scavengerTenureAge")) {
+					extensions->scvTenureStrategyFixed = true;
+					extensions->scvTenureStrategyAdaptive = false;
+					extensions->scvTenureFixedTenureAge = atoi(attr.value());
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+				} else if (0 == strcmp(attr.name(), "lazySweep")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					extensions->segregatedLazySweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: lazySweep ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					extensions->segregatedConcurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+				} else if (0 == strcmp(attr.name(), "concurrentScavenger")) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					extensions->concurrentScavenger = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentScavenger ignored, requires OMR_GC_CONCURRENT_SCAVENGER (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -43,6 +43,9 @@ omr_algotest:
 	
 omr_gctest:
 	./omrgctest -configListFile=fvtest/gctest/configuration/fvConfigListFile.txt
+ifeq (1,$(OMR_GC_CONCURRENT_SCAVENGER))
+	./omrgctest -configListFile=fvtest/gctest/configuration/concurrentScavengerConfigListFile.txt
+endif
 
 omr_jitbuilderexamples:
 	make -C jitbuilder/release test
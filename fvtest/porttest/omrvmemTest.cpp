@@ -40,6 +40,10 @@
 #include <sys/vminfo.h>
 #endif /* defined(AIXPPC) */
 
+#if defined(LINUX)
+#include <sys/resource.h>
+#endif /* defined(LINUX) */
+
 #define TWO_GIG_BAR 0x7FFFFFFF
 #define ONE_MB (1*1024*1024)
 #define FOUR_KB (4*1024)
@@ -3720,6 +3724,205 @@ TEST(PortVmemTest, vmem_testGetProcessMemorySize)
 	EXPECT_TRUE(0 == size) << "value updated when query invalid";
 }
 
+/**
+ * Moves committed pages to another part of their reservation and verifies that the contents moved with them,
+ * and that the source pages are left committed and zeroed.
+ *
+ * @ref omrvmem.c
+ */
+TEST(PortVmemTest, vmem_testRemapMemory)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testRemapMemory";
+	J9PortVmemIdentifier vmemID;
+	J9PortVmemParams params;
+	uintptr_t pageSize = omrvmem_supported_page_sizes()[0];
+	uintptr_t moveSize = 2 * pageSize;
+	uint8_t *memPtr = NULL;
+	intptr_t rc = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrvmem_vmem_params_init(&params);
+	params.byteAmount = 2 * moveSize;
+	params.mode |= OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+	params.pageSize = pageSize;
+	params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+	memPtr = (uint8_t *)omrvmem_reserve_memory_ex(&vmemID, &params);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve and commit 0x%zx bytes\n", params.byteAmount);
+		goto exit;
+	}
+
+	for (i = 0; i < moveSize; i++) {
+		memPtr[i] = (uint8_t)(i % 251);
+	}
+
+	rc = omrvmem_remap_memory(memPtr, memPtr + pageSize, moveSize, &vmemID);
+	EXPECT_TRUE(0 > rc) << "overlapping ranges were not rejected";
+
+	rc = omrvmem_remap_memory(memPtr, memPtr + moveSize, moveSize, &vmemID);
+#if defined(LINUX)
+	EXPECT_TRUE(0 == rc) << "omrvmem_remap_memory failed";
+#endif /* defined(LINUX) */
+	if (0 == rc) {
+		for (i = 0; i < moveSize; i++) {
+			if ((uint8_t)(i % 251) != memPtr[moveSize + i]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "moved byte at offset 0x%zx does not match\n", i);
+				break;
+			}
+			if (0 != memPtr[i]) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "source byte at offset 0x%zx was not cleared\n", i);
+				break;
+			}
+		}
+		/* the source must still be committed */
+		memset(memPtr, 'c', moveSize);
+	} else {
+		EXPECT_TRUE(OMRPORT_ERROR_VMEM_NOT_SUPPORTED == rc) << "omrvmem_remap_memory failed";
+	}
+
+	omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+
+#if defined(LINUX)
+/**
+ * Verify that a move whose source range can not be mapped again is reported as a move, not as a failure
+ * the caller should fall back to copying from. The address space limit is lowered so that only the move
+ * itself, which needs no more address space, still succeeds.
+ */
+TEST(PortVmemTest, vmem_testRemapMemorySourceUnmapped)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testRemapMemorySourceUnmapped";
+	J9PortVmemIdentifier vmemID;
+	J9PortVmemParams params;
+	uintptr_t pageSize = omrvmem_supported_page_sizes()[0];
+	uintptr_t moveSize = 2 * pageSize;
+	uint8_t *memPtr = NULL;
+	uint64_t virtualSize = 0;
+	struct rlimit oldLimit;
+	struct rlimit newLimit;
+	intptr_t rc = 0;
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	omrvmem_vmem_params_init(&params);
+	params.byteAmount = 2 * moveSize;
+	params.mode |= OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+	params.pageSize = pageSize;
+	params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+	memPtr = (uint8_t *)omrvmem_reserve_memory_ex(&vmemID, &params);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve and commit 0x%zx bytes\n", params.byteAmount);
+		goto exit;
+	}
+
+	for (i = 0; i < moveSize; i++) {
+		memPtr[i] = (uint8_t)(i % 251);
+	}
+
+	if ((0 != getrlimit(RLIMIT_AS, &oldLimit))
+		|| (0 != omrvmem_get_process_memory_size(OMRPORT_VMEM_PROCESS_VIRTUAL, &virtualSize))
+	) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to query the address space limit and size\n");
+	} else {
+		newLimit = oldLimit;
+		newLimit.rlim_cur = (rlim_t)(virtualSize - pageSize);
+		if (0 != setrlimit(RLIMIT_AS, &newLimit)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to lower the address space limit, errno %d\n", errno);
+		} else {
+			rc = omrvmem_remap_memory(memPtr, memPtr + moveSize, moveSize, &vmemID);
+			setrlimit(RLIMIT_AS, &oldLimit);
+
+			EXPECT_TRUE(OMRPORT_ERROR_VMEM_REMAP_SOURCE_UNMAPPED == rc) << "unexpected result " << rc;
+			if (OMRPORT_ERROR_VMEM_REMAP_SOURCE_UNMAPPED == rc) {
+				/* the source range is no longer mapped, but the contents must have arrived */
+				for (i = 0; i < moveSize; i++) {
+					if ((uint8_t)(i % 251) != memPtr[moveSize + i]) {
+						outputErrorMessage(PORTTEST_ERROR_ARGS, "moved byte at offset 0x%zx does not match\n", i);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+#endif /* defined(LINUX) */
+
+TEST(PortVmemTest, vmem_testTransparentHugePages)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "vmem_testTransparentHugePages";
+	J9PortVmemIdentifier vmemID;
+	J9PortVmemParams params;
+	uintptr_t pageSize = omrvmem_supported_page_sizes()[0];
+	uintptr_t hugePageSize = omrvmem_get_transparent_huge_page_size();
+	uint8_t *memPtr = NULL;
+	uint8_t *hugePage = NULL;
+	intptr_t rc = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	if (0 == hugePageSize) {
+		portTestEnv->log("transparent huge pages are not available\n");
+		goto exit;
+	}
+	EXPECT_TRUE((hugePageSize > pageSize) && (0 == (hugePageSize & (hugePageSize - 1)))) << "bad transparent huge page size";
+
+	omrvmem_vmem_params_init(&params);
+	params.byteAmount = 3 * hugePageSize;
+	params.mode |= OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES;
+	params.pageSize = pageSize;
+	params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+	memPtr = (uint8_t *)omrvmem_reserve_memory_ex(&vmemID, &params);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve 0x%zx bytes\n", params.byteAmount);
+		goto exit;
+	}
+
+	/* commit the two whole huge pages in the reservation */
+	hugePage = (uint8_t *)(((uintptr_t)memPtr + hugePageSize - 1) & ~(hugePageSize - 1));
+	if (NULL == omrvmem_commit_memory(hugePage, 2 * hugePageSize, &vmemID)) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to commit 0x%zx bytes at %p\n", 2 * hugePageSize, hugePage);
+	} else {
+		memset(hugePage, 'a', 2 * hugePageSize);
+		EXPECT_TRUE(0 != (vmemID.mode & OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES)) << "the transparent huge page advice was not taken";
+
+		/* decommitting part of a huge page succeeds, but must leave it committed */
+		rc = omrvmem_decommit_memory(hugePage + pageSize, hugePageSize - pageSize, &vmemID);
+		EXPECT_TRUE(0 == rc) << "omrvmem_decommit_memory of part of a huge page failed";
+		if (('a' != hugePage[pageSize]) || ('a' != hugePage[hugePageSize - 1])) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "part of a huge page was decommitted\n");
+		}
+
+		/* decommitting a range covering a whole huge page releases just that page */
+		rc = omrvmem_decommit_memory(hugePage + pageSize, 2 * hugePageSize - pageSize, &vmemID);
+		EXPECT_TRUE(0 == rc) << "omrvmem_decommit_memory failed";
+		if ('a' != hugePage[pageSize]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "the partially covered huge page was decommitted\n");
+		}
+		if (0 != hugePage[hugePageSize]) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "the covered huge page was not decommitted\n");
+		}
+	}
+
+	omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+
+exit:
+	reportTestExit(OMRPORTLIB, testName);
+}
+
 /* This function is used by omrvmem_test_reserveExecutableMemory */
 int
 myFunction1()
@@ -53,6 +53,16 @@ public:
 		VM_AtomicSupport::nop();
 	}
 
+	/**
+	 * Hint to the processor that the cache line containing the given address will be read soon.
+	 * @param address The memory location to prefetch
+	 */
+	MMINLINE_DEBUG static void
+	prefetch(const void *address)
+	{
+		VM_AtomicSupport::prefetch(address);
+	}
+
 	/**
 	 * @Deprecated use the readWriteBarrier
 	 */
@@ -66,3 +66,38 @@ MM_CollectorLanguageInterface::writeBarrierUpdate(OMR_VMThread *omrThread, omrob
 {
 	writeBarrier(omrThread, parentObject, childObject);
 }
+
+omrobjectptr_t
+MM_CollectorLanguageInterface::readBarrierLoad(OMR_VMThread *omrThread, fomrobject_t *srcSlot)
+{
+	GC_SlotObject slotObject(omrThread->_vm, srcSlot);
+	omrobjectptr_t object = slotObject.readReferenceFromSlot();
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->concurrentScavenger && extensions->scavengerEnabled) {
+		MM_Scavenger *scavenger = extensions->scavenger;
+		if (scavenger->isConcurrentInProgress() && scavenger->isObjectInEvacuateMemory(object)) {
+			object = scavenger_loadBarrier(env, &slotObject);
+		}
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+	return object;
+}
+
+omrobjectptr_t
+MM_CollectorLanguageInterface::readBarrierLoadRoot(OMR_VMThread *omrThread, omrobjectptr_t *srcSlot)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->concurrentScavenger && extensions->scavengerEnabled) {
+		MM_Scavenger *scavenger = extensions->scavenger;
+		if (scavenger->isConcurrentInProgress() && scavenger->isObjectInEvacuateMemory(*srcSlot)) {
+			/* only the calling thread updates the reference, so it can be healed without atomics */
+			scavenger->copyObjectSlot(env, (volatile omrobjectptr_t *)srcSlot);
+		}
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+	return *srcSlot;
+}
@@ -326,6 +326,18 @@ public:
 	 * @param[in] env The environment for the calling thread.
 	 */	 
 	virtual void scavenger_switchConcurrentForThread(MM_EnvironmentBase *env) = 0;
+
+	/**
+	 * Load barrier for Concurrent Scavenger, called by readBarrierLoad() while a cycle is in progress and
+	 * the slot refers to an object in evacuate space. The implementation must make the slot refer to the
+	 * copy of the object (copying the object if no other thread has done so yet) so that later loads from
+	 * the slot take the fast path, and return the healed reference.
+	 *
+	 * @param[in] env The environment for the calling thread.
+	 * @param[in] slotObject The slot being loaded
+	 * @return the reference held by the slot once it has been healed
+	 */
+	virtual omrobjectptr_t scavenger_loadBarrier(MM_EnvironmentBase *env, GC_SlotObject *slotObject) = 0;
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
@@ -579,6 +591,21 @@ public:
 	 */
 	void writeBarrierUpdate(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject);
 
+	/**
+	 * In the absence of other (equivalent) read barrier, this method must be called to load a reference
+	 * from an object slot.
+	 *
+	 * To support OMR concurrent scavenging, this method heals slots referring to objects that are being
+	 * evacuated, so that the mutator never sees the evacuated copy of an object.
+	 */
+	omrobjectptr_t readBarrierLoad(OMR_VMThread *omrThread, fomrobject_t *srcSlot);
+
+	/**
+	 * As readBarrierLoad(), for a reference held outside the heap (e.g. in a VM table) by the calling thread.
+	 * The reference is updated in place.
+	 */
+	omrobjectptr_t readBarrierLoadRoot(OMR_VMThread *omrThread, omrobjectptr_t *srcSlot);
+
 	MM_CollectorLanguageInterface()
 		: MM_BaseVirtual()
 	{
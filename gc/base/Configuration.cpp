@@ -32,6 +32,7 @@
 #include "GlobalAllocationManager.hpp"
 #include "GlobalCollector.hpp"
 #include "Heap.hpp"
+#include "HeapDecommitter.hpp"
 #include "HeapRegionManager.hpp"
 #include "OMR_VM.hpp"
 #include "OMR_VMThread.hpp"
@@ -66,6 +67,7 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 			}
 			if (initializeNUMAManager(env)) {
 				initializeGCThreadCount(env);
+				initializeTransparentHugePages(env);
 				initializeGCParameters(env);
 				extensions->_lightweightNonReentrantLockPool = pool_new(sizeof(J9ThreadMonitorTracing), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(env->getPortLibrary()));
 				result = (NULL != extensions->_lightweightNonReentrantLockPool);
@@ -106,6 +108,11 @@ MM_Configuration::tearDown(MM_EnvironmentBase* env)
 		extensions->globalAllocationManager = NULL;
 	}
 
+	if (NULL != extensions->heapDecommitter) {
+		extensions->heapDecommitter->kill(env);
+		extensions->heapDecommitter = NULL;
+	}
+
 	if (NULL != extensions->heap) {
 		extensions->heap->kill(env);
 		extensions->heap = NULL;
@@ -246,6 +253,11 @@ MM_Configuration::createHeap(MM_EnvironmentBase* env, uintptr_t heapBytesRequest
 		}
 	}
 
+	if ((NULL != heap) && extensions->backgroundDecommit) {
+		/* if the thread can not be started contracted memory is released synchronously */
+		extensions->heapDecommitter = MM_HeapDecommitter::newInstance(env);
+	}
+
 	return heap;
 }
 
@@ -424,6 +436,25 @@ MM_Configuration::initializeGCThreadCount(MM_EnvironmentBase* env)
 	}
 }
 
+void
+MM_Configuration::initializeTransparentHugePages(MM_EnvironmentBase* env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	if (extensions->transparentHugePages) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uintptr_t hugePageSize = omrvmem_get_transparent_huge_page_size();
+
+		/* transparent huge pages only back memory reserved in default pages */
+		if ((0 == hugePageSize) || (extensions->requestedPageSize != omrvmem_supported_page_sizes()[0])) {
+			extensions->transparentHugePages = false;
+		} else {
+			extensions->transparentHugePageSize = hugePageSize;
+			extensions->heapAlignment = OMR_MAX(extensions->heapAlignment, hugePageSize);
+		}
+	}
+}
+
 void
 MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 {
@@ -465,6 +496,11 @@ MM_Configuration::initializeGCParameters(MM_EnvironmentBase* env)
 			extensions->splitFreeListSplitAmount = (omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE) - 1) / 8  +  1;
 		}
 	}
+
+	/* adaptive TLH sizing may hand out TLHs up to its own maximum, which the TLH size statistics of the pools must cover */
+	if (extensions->tlhAdaptiveSizing && (extensions->tlhMaximumSize < extensions->tlhAdaptiveMaximumSize)) {
+		extensions->tlhMaximumSize = extensions->tlhAdaptiveMaximumSize;
+	}
 }
 
 bool
@@ -139,6 +139,13 @@ private:
 	 */
 	void initializeGCThreadCount(MM_EnvironmentBase* env);
 
+	/**
+	 * If transparent huge pages were requested, disable them if the OS does not provide them, otherwise
+	 * raise the heap alignment to the huge page size so that the heap only grows and shrinks by whole huge pages.
+	 * @param env[in] - the current environment
+	 */
+	void initializeTransparentHugePages(MM_EnvironmentBase* env);
+
 	/**
 	 * Sets GC parameters that are dependent on the number of gc threads (if not previously initialized):
 	 *
@@ -19,11 +19,18 @@
 #include "Forge.hpp"
 
 #include "omrcomp.h"
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 
+#define MM_FORGE_CACHE_SMALLEST_BLOCK_SIZE 64
+#define MM_FORGE_CACHE_SIZE_CLASSES 7 /* blocks of 64 bytes up to 4KB */
+#define MM_FORGE_CACHE_BLOCKS_PER_SIZE_CLASS 8
+#define MM_FORGE_UNCACHED_SIZE_CLASS MM_FORGE_CACHE_SIZE_CLASSES
+
 typedef struct MM_MemoryHeader {
 	uintptr_t allocatedBytes;
 	MM_AllocationCategory::Enum category;
+	uint32_t sizeClass;
 } MM_MemoryHeader;
 
 typedef union MM_AlignedMemoryHeader {
@@ -31,10 +38,37 @@ typedef union MM_AlignedMemoryHeader {
 	MM_MemoryHeader header;
 } MM_AlignedMemoryHeader;
 
+struct MM_ForgeThreadCache {
+	MM_ForgeThreadCache *next; /**< next cache created by the forge */
+	MM_Forge *forge; /**< the forge owning the cache */
+	volatile uintptr_t inUse; /**< non-zero while the cache is owned by a thread */
+	uintptr_t stripe; /**< index of the statistics stripe updated by the owning thread */
+	MM_AlignedMemoryHeader *freeBlocks[MM_FORGE_CACHE_SIZE_CLASSES]; /**< free blocks of each size, linked through their first slot */
+	uintptr_t freeBlockCount[MM_FORGE_CACHE_SIZE_CLASSES];
+};
+
+/**
+ * Find the size class of a request.
+ * @return the index of the smallest class holding bytesRequested, or MM_FORGE_UNCACHED_SIZE_CLASS if the request is too large to be cached
+ */
+static MMINLINE uint32_t
+sizeClassForRequest(uintptr_t bytesRequested)
+{
+	uint32_t sizeClass = 0;
+	uintptr_t blockSize = MM_FORGE_CACHE_SMALLEST_BLOCK_SIZE;
+	while ((blockSize < bytesRequested) && (sizeClass < MM_FORGE_UNCACHED_SIZE_CLASS)) {
+		blockSize <<= 1;
+		sizeClass += 1;
+	}
+	return sizeClass;
+}
+
 bool
 MM_Forge::initialize(MM_EnvironmentBase* env)
 {
 	_portLibrary = env->getPortLibrary();
+	_threadCaches = NULL;
+	_threadCacheCount = 0;
 
 	if (0 != omrthread_monitor_init_with_name(&_mutex, 0, "MM_Forge")) {
 		return false;
@@ -42,6 +76,14 @@ MM_Forge::initialize(MM_EnvironmentBase* env)
 
 	for (uintptr_t i = 0; i < MM_AllocationCategory::CATEGORY_COUNT; i++) {
 		_statistics[i].category = (MM_AllocationCategory::Enum) i;
+		_statistics[i].allocated = 0;
+		_statistics[i].highwater = 0;
+	}
+	memset(_stripes, 0, sizeof(_stripes));
+
+	/* Run without thread caches if all of the thread local storage keys are taken */
+	if (0 != omrthread_tls_alloc_with_finalizer(&_threadCacheKey, threadCacheFinalizer)) {
+		_threadCacheKey = 0;
 	}
 	
 	return true;
@@ -50,6 +92,21 @@ MM_Forge::initialize(MM_EnvironmentBase* env)
 void 
 MM_Forge::tearDown(MM_EnvironmentBase* env)
 {
+	if (0 != _threadCacheKey) {
+		/* Forget the caches of the threads that are still attached, so that their finalizers are not called */
+		omrthread_tls_free(_threadCacheKey);
+		_threadCacheKey = 0;
+	}
+
+	MM_ForgeThreadCache *cache = _threadCaches;
+	_threadCaches = NULL;
+	while (NULL != cache) {
+		MM_ForgeThreadCache *next = cache->next;
+		flushThreadCache(cache);
+		_portLibrary->mem_free_memory(_portLibrary, cache);
+		cache = next;
+	}
+
 	_portLibrary = NULL;
 	
 	if (NULL != _mutex) {
@@ -58,6 +115,88 @@ MM_Forge::tearDown(MM_EnvironmentBase* env)
 	}
 }
 
+MM_ForgeThreadCache *
+MM_Forge::getThreadCache()
+{
+	if (0 == _threadCacheKey) {
+		return NULL;
+	}
+
+	omrthread_t self = omrthread_self();
+	if (NULL == self) {
+		return NULL;
+	}
+
+	MM_ForgeThreadCache *cache = (MM_ForgeThreadCache *)omrthread_tls_get(self, _threadCacheKey);
+	if (NULL == cache) {
+		/* Reuse the cache of a thread that has exited, if there is one */
+		for (cache = _threadCaches; NULL != cache; cache = cache->next) {
+			if ((0 == cache->inUse) && (0 == MM_AtomicOperations::lockCompareExchange(&cache->inUse, 0, 1))) {
+				break;
+			}
+		}
+
+		if (NULL == cache) {
+			cache = (MM_ForgeThreadCache *)_portLibrary->mem_allocate_memory(_portLibrary, sizeof(MM_ForgeThreadCache), OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM);
+			if (NULL == cache) {
+				return NULL;
+			}
+			memset(cache, 0, sizeof(MM_ForgeThreadCache));
+			cache->forge = this;
+			cache->inUse = 1;
+			cache->stripe = (MM_AtomicOperations::add(&_threadCacheCount, 1) - 1) % MM_FORGE_STATISTICS_STRIPES;
+
+			/* Caches are only unlinked by tearDown(), so a lock-free push is sufficient */
+			MM_ForgeThreadCache *head = NULL;
+			do {
+				head = _threadCaches;
+				cache->next = head;
+			} while ((uintptr_t)head != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_threadCaches, (uintptr_t)head, (uintptr_t)cache));
+		}
+
+		if (0 != omrthread_tls_set(self, _threadCacheKey, cache)) {
+			cache->inUse = 0;
+			return NULL;
+		}
+	}
+
+	return cache;
+}
+
+void
+MM_Forge::flushThreadCache(MM_ForgeThreadCache *cache)
+{
+	for (uintptr_t sizeClass = 0; sizeClass < MM_FORGE_CACHE_SIZE_CLASSES; sizeClass++) {
+		MM_AlignedMemoryHeader *block = cache->freeBlocks[sizeClass];
+		while (NULL != block) {
+			MM_AlignedMemoryHeader *next = *(MM_AlignedMemoryHeader **)(block + 1);
+			_portLibrary->mem_free_memory(_portLibrary, block);
+			block = next;
+		}
+		cache->freeBlocks[sizeClass] = NULL;
+		cache->freeBlockCount[sizeClass] = 0;
+	}
+}
+
+void J9THREAD_PROC
+MM_Forge::threadCacheFinalizer(void *cache)
+{
+	MM_ForgeThreadCache *threadCache = (MM_ForgeThreadCache *)cache;
+	threadCache->forge->flushThreadCache(threadCache);
+	MM_AtomicOperations::storeSync();
+	threadCache->inUse = 0;
+}
+
+void
+MM_Forge::updateHighwater(uintptr_t stripe, MM_AllocationCategory::Enum category, uintptr_t allocated)
+{
+	volatile uintptr_t *highwater = &_stripes[stripe].counters.highwater[category];
+	uintptr_t oldHighwater = *highwater;
+	while (((intptr_t)allocated > (intptr_t)oldHighwater) && (oldHighwater != MM_AtomicOperations::lockCompareExchange(highwater, oldHighwater, allocated))) {
+		oldHighwater = *highwater;
+	}
+}
+
 /**
  * Allocates the amount of memory requested in bytesRequested.  Returns a pointer to the allocated memory, or NULL if the request could
  * not be performed.  This function is a wrapper of omrmem_allocate_memory.
@@ -70,21 +209,35 @@ MM_Forge::tearDown(MM_EnvironmentBase* env)
 void* 
 MM_Forge::allocate(uintptr_t bytesRequested, MM_AllocationCategory::Enum category, const char* callsite)
 {
-	MM_AlignedMemoryHeader* memoryPointer;
+	MM_AlignedMemoryHeader* memoryPointer = NULL;
+	MM_ForgeThreadCache *cache = getThreadCache();
+	uint32_t sizeClass = sizeClassForRequest(bytesRequested);
+
+	if (MM_FORGE_UNCACHED_SIZE_CLASS == sizeClass) {
+		memoryPointer = (MM_AlignedMemoryHeader *) _portLibrary->mem_allocate_memory(_portLibrary, bytesRequested + sizeof(MM_AlignedMemoryHeader), callsite, OMRMEM_CATEGORY_MM);
+	} else if ((NULL != cache) && (NULL != cache->freeBlocks[sizeClass])) {
+		memoryPointer = cache->freeBlocks[sizeClass];
+		cache->freeBlocks[sizeClass] = *(MM_AlignedMemoryHeader **)(memoryPointer + 1);
+		cache->freeBlockCount[sizeClass] -= 1;
+	} else if (NULL == cache) {
+		/* the block can not be cached when it is freed, so it is not rounded up to its size class */
+		sizeClass = MM_FORGE_UNCACHED_SIZE_CLASS;
+		memoryPointer = (MM_AlignedMemoryHeader *) _portLibrary->mem_allocate_memory(_portLibrary, bytesRequested + sizeof(MM_AlignedMemoryHeader), callsite, OMRMEM_CATEGORY_MM);
+	} else {
+		/* allocate the whole block, so that it can be reused for any request of its size class */
+		uintptr_t blockSize = (uintptr_t)MM_FORGE_CACHE_SMALLEST_BLOCK_SIZE << sizeClass;
+		memoryPointer = (MM_AlignedMemoryHeader *) _portLibrary->mem_allocate_memory(_portLibrary, blockSize + sizeof(MM_AlignedMemoryHeader), callsite, OMRMEM_CATEGORY_MM);
+	}
 
-	memoryPointer = (MM_AlignedMemoryHeader *) _portLibrary->mem_allocate_memory(_portLibrary, bytesRequested + sizeof(MM_AlignedMemoryHeader), callsite, OMRMEM_CATEGORY_MM);
 	if (NULL != memoryPointer) {
 		memoryPointer->header.allocatedBytes = bytesRequested;
 		memoryPointer->header.category = category;
+		memoryPointer->header.sizeClass = sizeClass;
 
-		omrthread_monitor_enter(_mutex);
+		uintptr_t stripe = (NULL == cache) ? 0 : cache->stripe;
+		uintptr_t allocated = MM_AtomicOperations::add(&_stripes[stripe].counters.allocated[category], bytesRequested);
+		updateHighwater(stripe, category, allocated);
 
-		_statistics[category].allocated += bytesRequested;
-		if (_statistics[category].allocated > _statistics[category].highwater) {
-			_statistics[category].highwater = _statistics[category].allocated; 
-		}
-
-		omrthread_monitor_exit(_mutex);
 		memoryPointer += 1;
 	}
 	
@@ -107,13 +260,21 @@ MM_Forge::free(void* memoryPointer)
 	MM_AlignedMemoryHeader* alignedHeader = (MM_AlignedMemoryHeader *) memoryPointer;
 	alignedHeader -= 1;
 
+	MM_ForgeThreadCache *cache = getThreadCache();
+	uint32_t sizeClass = alignedHeader->header.sizeClass;
 
-	omrthread_monitor_enter(_mutex);
-	_statistics[alignedHeader->header.category].allocated -= alignedHeader->header.allocatedBytes; 
-	omrthread_monitor_exit(_mutex);
-	
-	OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
-	omrmem_free_memory(alignedHeader);
+	/* The counters of a stripe may wrap when memory is freed by a thread other than the one that allocated it, their sum does not */
+	uintptr_t stripe = (NULL == cache) ? 0 : cache->stripe;
+	MM_AtomicOperations::subtract(&_stripes[stripe].counters.allocated[alignedHeader->header.category], alignedHeader->header.allocatedBytes);
+
+	if ((NULL != cache) && (MM_FORGE_UNCACHED_SIZE_CLASS != sizeClass) && (MM_FORGE_CACHE_BLOCKS_PER_SIZE_CLASS > cache->freeBlockCount[sizeClass])) {
+		*(MM_AlignedMemoryHeader **)(alignedHeader + 1) = cache->freeBlocks[sizeClass];
+		cache->freeBlocks[sizeClass] = alignedHeader;
+		cache->freeBlockCount[sizeClass] += 1;
+	} else {
+		OMRPORT_ACCESS_FROM_OMRPORT(_portLibrary);
+		omrmem_free_memory(alignedHeader);
+	}
 }
 
 /**
@@ -125,5 +286,28 @@ MM_Forge::free(void* memoryPointer)
 MM_MemoryStatistics*
 MM_Forge::getCurrentStatistics()
 {
+	omrthread_monitor_enter(_mutex);
+
+	for (uintptr_t category = 0; category < MM_AllocationCategory::CATEGORY_COUNT; category++) {
+		uintptr_t allocated = 0;
+		intptr_t peak = 0;
+		for (uintptr_t stripe = 0; stripe < MM_FORGE_STATISTICS_STRIPES; stripe++) {
+			allocated += _stripes[stripe].counters.allocated[category];
+			/* Take the peak of the stripe and restart it from the current usage, without losing a peak raised meanwhile */
+			volatile uintptr_t *highwater = &_stripes[stripe].counters.highwater[category];
+			uintptr_t oldHighwater = 0;
+			do {
+				oldHighwater = *highwater;
+			} while (oldHighwater != MM_AtomicOperations::lockCompareExchange(highwater, oldHighwater, _stripes[stripe].counters.allocated[category]));
+			peak += (intptr_t)oldHighwater;
+		}
+		_statistics[category].allocated = allocated;
+		if ((peak > 0) && ((uintptr_t)peak > _statistics[category].highwater)) {
+			_statistics[category].highwater = (uintptr_t)peak;
+		}
+	}
+
+	omrthread_monitor_exit(_mutex);
+
 	return _statistics;
 }
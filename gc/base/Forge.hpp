@@ -46,6 +46,22 @@ typedef struct MM_MemoryStatistics {
 } MM_MemoryStatistics;
 
 class MM_EnvironmentBase;
+struct MM_ForgeThreadCache;
+
+#define MM_FORGE_STATISTICS_STRIPES 16
+#define MM_FORGE_STATISTICS_STRIPE_SIZE 128
+
+/**
+ * Bytes allocated per category by the threads sharing a stripe. Stripes are padded to a cache line,
+ * so that threads on different stripes do not contend on the counters.
+ */
+typedef union MM_ForgeStatisticsStripe {
+	struct {
+		volatile uintptr_t allocated[MM_AllocationCategory::CATEGORY_COUNT];
+		volatile uintptr_t highwater[MM_AllocationCategory::CATEGORY_COUNT]; /**< peak of allocated since the statistics were last refreshed, both compared as signed */
+	} counters;
+	uint8_t padding[MM_FORGE_STATISTICS_STRIPE_SIZE];
+} MM_ForgeStatisticsStripe;
 
 
 class MM_Forge
@@ -54,12 +70,44 @@ class MM_Forge
 friend class MM_GCExtensionsBase;
 
 /* Data Members */
-private:
+protected:
 	omrthread_monitor_t _mutex;
 	OMRPortLibrary* _portLibrary;
-	MM_MemoryStatistics _statistics[MM_AllocationCategory::CATEGORY_COUNT];
+	MM_MemoryStatistics _statistics[MM_AllocationCategory::CATEGORY_COUNT]; /**< snapshot of the stripes, refreshed by getCurrentStatistics() */
+	MM_ForgeStatisticsStripe _stripes[MM_FORGE_STATISTICS_STRIPES]; /**< lock-free per-category counters, each thread updates the stripe of its cache */
+	omrthread_tls_key_t _threadCacheKey; /**< key of the calling thread's cache of free blocks, 0 if thread caching is not available */
+	MM_ForgeThreadCache * volatile _threadCaches; /**< every thread cache ever created, caches of exited threads are reused by new threads */
+	volatile uintptr_t _threadCacheCount; /**< number of thread caches created, used to spread them over the stripes */
 	
 /* Function Members */
+private:
+	/**
+	 * Find the cache of the calling thread, claiming or creating one if the thread does not have one yet.
+	 * @return the cache of the calling thread, or NULL if the thread can not have one
+	 */
+	MM_ForgeThreadCache *getThreadCache();
+
+	/**
+	 * Return the blocks held by a cache to the port library.
+	 * @param[in] cache - the cache to empty
+	 */
+	void flushThreadCache(MM_ForgeThreadCache *cache);
+
+	/**
+	 * Thread local storage finalizer, called when a thread with a cache detaches or exits. The blocks are
+	 * returned to the port library and the cache is released for use by another thread.
+	 * @param[in] cache - the cache of the exiting thread
+	 */
+	static void J9THREAD_PROC threadCacheFinalizer(void *cache);
+
+	/**
+	 * Raise the highwater of a category in a stripe to the stripe's current usage.
+	 * @param[in] stripe - the stripe that has just grown
+	 * @param[in] category - the category that has just grown
+	 * @param[in] allocated - the usage of the category in the stripe after it grew
+	 */
+	void updateHighwater(uintptr_t stripe, MM_AllocationCategory::Enum category, uintptr_t allocated);
+
 protected:
 	/**
 	 * Initialize internal structures of the memory forge.  An instance of MM_Forge must be initialized before
@@ -83,6 +131,8 @@ public:
 	/**
 	 * Allocates the amount of memory requested in bytesRequested.  Returns a pointer to the allocated memory, 
 	 * or NULL if the request could not be performed.  This function is a wrapper of omrmem_allocate_memory.
+	 * Small requests of a thread with a cache are rounded up to a power of two, so that the block can be cached
+	 * when it is freed, and are satisfied from the blocks cached by the thread when possible.
 	 *
 	 * @param[in] byesRequested - the number of bytes to allocate
 	 * @param[in] category - the memory usage category for the allocated memory
@@ -95,7 +145,8 @@ public:
 	/**
 	 * Deallocate memory that has been allocated by the garbage collector.  This function should not be called
 	 * to deallocate memory that has not been allocated by either the allocate or reallocate functions.  This 
-	 * function is a wrapper of omrmem_free_memory.
+	 * function is a wrapper of omrmem_free_memory. Small blocks are kept in the calling thread's cache for
+	 * reuse, up to a limit per size.
 	 *
 	 * @param[in] memoryPointer - a pointer to the memory that will be freed
 	 */
@@ -106,6 +157,10 @@ public:
 	 * to a memory usage category type.  To locate memory usage statistics for a particular category, use the 
 	 * enumeration value as the array index (e.g. stats[REFERENCES]).
 	 *
+	 * The highwater is the sum of the peaks each stripe reached since the statistics were last refreshed, if
+	 * that is above the highwater already reported. It is exact when the memory of a category is allocated
+	 * and freed on one stripe, and otherwise an upper bound, as the stripes may not peak at the same time.
+	 *
 	 * @return an array of memory usage statistics indexed using the CategoryType enumeration
 	 */
 	MM_MemoryStatistics* getCurrentStatistics();
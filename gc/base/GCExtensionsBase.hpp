@@ -57,6 +57,7 @@ class MM_EnvironmentBase;
 class MM_FrequentObjectsStats;
 class MM_GlobalAllocationManager;
 class MM_Heap;
+class MM_HeapDecommitter;
 class MM_HeapMap;
 class MM_HeapRegionManager;
 class MM_InterRegionRememberedSet;
@@ -175,6 +176,7 @@ private:
 	void* _guaranteedNurseryStart; /**< lowest address guaranteed to be in the nursery */
 	void* _guaranteedNurseryEnd; /**< highest address guaranteed to be in the nursery */
 	bool _isRememberedSetInOverflow;
+	bool _isRememberedSetOverflowUncarded; /**< true if objects failed to be remembered outside of the scavenger, so are not on the scavenger overflow cards */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 protected:
@@ -226,6 +228,9 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	bool transparentHugePages; /**< back the heap and its metadata with transparent huge pages; disabled at startup if the OS does not provide them */
+	uintptr_t transparentHugePageSize; /**< size of a transparent huge page, which the heap is aligned to while transparentHugePages is enabled */
+	uintptr_t transparentHugePageCommittedBytes; /**< bytes of heap and metadata committed which the OS took the advice to back with transparent huge pages for */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -277,6 +282,9 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, each TLH refresh is sized from the allocation rate of the refreshing thread rather than grown by tlhIncrementSize */
+	uintptr_t tlhAdaptiveMaximumSize; /**< largest TLH refresh requested under adaptive TLH sizing */
+	uintptr_t tlhAdaptiveRefreshInterval; /**< time, in microseconds, a TLH refresh should last its thread at the thread's allocation rate under adaptive TLH sizing */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -302,6 +310,7 @@ public:
 	bool debugLOAResize;
 	bool debugLOAFreelist;
 	bool debugLOAAllocate;
+	uintptr_t largeObjectPageAlignedMinimumSize; /**< objects at least this large are allocated in the LOA at page granularity, so that compaction can move them by remapping their pages (0 disables page granular allocation) */
 	ConcurrentMetering concurrentMetering;
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 
@@ -311,6 +320,7 @@ public:
 	uintptr_t absoluteMinimumOldSubSpaceSize;
 	uintptr_t absoluteMinimumNewSubSpaceSize;
 	uintptr_t parSweepChunkSize;
+	bool parallelSweepConnect; /**< if true, sweep connects the free lists in parallel segments which are spliced together in a final pass */
 	uintptr_t markingStackSize;
 	uintptr_t heapExpansionMinimumSize;
 	uintptr_t heapExpansionMaximumSize;
@@ -322,6 +332,8 @@ public:
 	uintptr_t heapContractionGCTimeThreshold; /**< min percentage of time spent in gc before contraction */
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	bool backgroundDecommit; /**< Enabled by -Xgc:backgroundDecommit.  Release the memory the heap contracts by from a background thread rather than in the collection pause */
+	uintptr_t backgroundDecommitDelay; /**< milliseconds contracted memory stays committed before it is released, so that re-expansion can reuse it */
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
@@ -329,6 +341,8 @@ public:
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	uintptr_t markingPrefetchDistance; /**< number of popped objects the marking scheme keeps in its lookahead ring so they can be prefetched before being scanned (0 disables the lookahead) */
+	bool workStealingPackets; /**< if true, non-concurrent marking exchanges work packets through per-thread work-stealing deques instead of the shared packet lists */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 
@@ -347,6 +361,7 @@ public:
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
 	bool fvtest_alwaysApplyOverflowRounding; /**< always round down the allocated heap as if overflow rounding were required */
+	bool fvtest_verifyParallelSweepConnect; /**< if true, each sweep which connects in parallel first connects serially, for the parallel result to be checked against */
 	uintptr_t fvtest_forceExcessiveAllocFailureAfter; /**< force excessive GC to occur after this many global GCs */
 	void* fvtest_verifyHeapAbove; /**< if non-NULL, will force start-up failure if any part of the heap is below this value */
 	void* fvtest_verifyHeapBelow; /**< if non-NULL, will force start-up failure if any part of the heap is above this value */
@@ -375,6 +390,8 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreading; /**< if true, the number of threads of each task is chosen from its expected work and the CPUs not used by other processes, gcThreadCount being the maximum */
+	uintptr_t adaptiveGCThreadingWorkPerThread; /**< expected bytes of work which justify one more GC thread under adaptive GC threading */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -395,6 +412,7 @@ public:
 	bool scvTenureStrategyLookback; /**< Flag for enabling the Lookback scavenger tenure strategy. */
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
 	bool scavengerEnabled;
+	bool scavengerNUMALocal; /**< if true, each NUMA node gets its own scavenger scan list and survivor/tenure allocation slices */
 	bool scavengerRsoScanUnsafe;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool concurrentScavenger;
@@ -403,6 +421,9 @@ public:
 	uintptr_t maxScavengeBeforeGlobal;
 	uintptr_t scvArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in the scavenger */
 	uintptr_t scvArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in the scavenger */
+	uintptr_t scavengerHotFieldCopyDepth; /**< levels of hot fields copied immediately after their parent object, zero (default) disables hierarchical copying */
+	uintptr_t scavengerRememberedSetRangeSlots; /**< number of remembered set slots the scavenger processes as one unit of work, zero (default) means whole puddles */
+	bool scavengerRememberedSetOverflowCards; /**< if true, objects which do not fit in an overflowed remembered set are recorded on cards, so that only those cards are walked rather than all of tenure */
 	uintptr_t scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
 	bool tiltedScavenge;
@@ -410,6 +431,7 @@ public:
 	double survivorSpaceMinimumSizeRatio;
 	double survivorSpaceMaximumSizeRatio;
 	double tiltedScavengeMaximumIncrease;
+	bool tiltedScavengeRegionSizing; /**< if true, the survivor space is sized in whole heap regions from the bytes flipped by the last scavenge, rather than from a weighted average which may only shrink it gradually */
 	double scavengerCollectorExpandRatio; /**< the ratio of _avgTenureBytes we use to expand when a collectorAllocate() fails */
 	uintptr_t scavengerMaximumCollectorExpandSize; /**< the maximum amount by which we will expand when a collectorAllocate() fails */
 	bool dynamicNewSpaceSizing;
@@ -451,6 +473,7 @@ public:
 	MM_Heap* heap;
 	MM_HeapRegionManager* heapRegionManager; /**< The heap region manager used to view the heap as regions of memory */
 	MM_MemoryManager* memoryManager; /**< memory manager used to access to virtual memory instances */
+	MM_HeapDecommitter* heapDecommitter; /**< releases contracted heap memory when backgroundDecommit is enabled, NULL otherwise */
 	uintptr_t aggressive;
 	MM_SweepHeapSectioning* sweepHeapSectioning; /**< Reference to the SweepHeapSectioning to Compact can share the backing store */
 
@@ -460,6 +483,7 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	uintptr_t partialCompactSize; /**< heap bytes a non-aggressive compaction evacuates, the rest of the heap is only fixed up in place (0 compacts the whole heap) */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -473,11 +497,13 @@ public:
 	bool dirtCardDuringRSScan;
 	uintptr_t concurrentLevel;
 	uintptr_t concurrentBackground;
+	bool concurrentBackgroundMark; /**< if true, concurrent tracing and card cleaning is left to the background helper threads; mutators are only taxed for the shortfall when the trace rate measured for the helpers falls behind the rate needed to finish before the heap fills. Without helper threads (concurrentBackground=0) mutators are taxed as usual */
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
+	UDATA fvtest_concurrentCardCleaningMaxCards; /**< if non-zero, the most cards a thread cleans before it stops concurrent card cleaning, part way through the cards it claimed */
 
 	UDATA fvtest_forceConcurrentTLHMarkMapCommitFailure; /**< Force failure at Concurrent TLH Mark Map commit operation */
 	UDATA fvtest_forceConcurrentTLHMarkMapCommitFailureCounter; /**< Force failure at Concurrent TLH Mark Map commit operation counter */
@@ -552,6 +578,8 @@ public:
 	uintptr_t managedAllocationContextCount; /**< The number of allocation contexts which will be instantiated and managed by the GlobalAllocationManagerRealtime (currently 2*cpu_count) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool segregatedLazySweep; /**< if true, the collector leaves the small regions of the segregated heap unswept, to be swept when an allocation context first needs them */
+	bool segregatedConcurrentSweep; /**< if true, the small regions left unswept by the collector are swept by a background thread (implies segregatedLazySweep) */
 #endif
 
 /* OMR_GC_REALTIME (in for all -- see 82589) */
@@ -584,6 +612,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asynchronousLogging; /**< Enabled by -Xgc:asynchronousLogging.  Write logs (e.g. verbose:gc) to a file from a background thread */
+	uintptr_t asynchronousLoggingBufferSize; /**< Bytes of log output which may wait for the background thread; output beyond this is dropped */
+	bool verboseBinaryFormat; /**< Enabled by -Xgc:verboseBinaryFormat.  Write verbose logs to file in the compact binary format (decoded by tools/verbosegcdecode) */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -897,7 +928,17 @@ public:
 	
 	MMINLINE bool isRememberedSetInOverflowState() { return _isRememberedSetInOverflow; }
 	MMINLINE void setRememberedSetOverflowState() { _isRememberedSetInOverflow = true; }
-	MMINLINE void clearRememberedSetOverflowState() { _isRememberedSetInOverflow = false; }
+	MMINLINE void clearRememberedSetOverflowState() { _isRememberedSetInOverflow = false; _isRememberedSetOverflowUncarded = false; }
+	MMINLINE bool isRememberedSetOverflowUncarded() { return _isRememberedSetOverflowUncarded; }
+
+	/**
+	 * Overflow the remembered set for an object that was not recorded on the scavenger overflow cards.
+	 */
+	MMINLINE void setRememberedSetOverflowUncardedState()
+	{
+		_isRememberedSetOverflowUncarded = true;
+		_isRememberedSetInOverflow = true;
+	}
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
 	/**
@@ -1030,6 +1071,7 @@ public:
 		, _guaranteedNurseryStart(NULL)
 		, _guaranteedNurseryEnd(NULL)
 		, _isRememberedSetInOverflow(false)
+		, _isRememberedSetOverflowUncarded(false)
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		, _omrVM(NULL)
 		, _globalCollector(NULL)
@@ -1054,6 +1096,9 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, transparentHugePages(false)
+		, transparentHugePageSize(0)
+		, transparentHugePageCommittedBytes(0)
 #if defined(OMR_GC_STACCATO)
 		, staccatoRememberedSet(NULL)
 #endif /* OMR_GC_STACCATO */
@@ -1074,12 +1119,21 @@ public:
 		, gcExclusiveAccessThreadId(NULL)
 		, gcExclusiveAccessMutex(NULL)
 		, _lightweightNonReentrantLockPool(NULL)
+#if defined(OMR_GC_COMBINATION_SPEC)
+		, _isSegregatedHeap(false)
+		, _isVLHGC(false)
+		, _isMetronomeGC(false)
+		, _isStandardGC(false)
+#endif /* OMR_GC_COMBINATION_SPEC */
 		, tlhMinimumSize(MINIMUM_TLH_SIZE)
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAdaptiveMaximumSize(4 * 1024 * 1024)
+		, tlhAdaptiveRefreshInterval(2000)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1094,11 +1148,13 @@ public:
 		, debugLOAResize(false)
 		, debugLOAFreelist(false)
 		, debugLOAAllocate(false)
+		, largeObjectPageAlignedMinimumSize(0)
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 		, heapAlignment(HEAP_ALIGNMENT)
 		, absoluteMinimumOldSubSpaceSize(MINIMUM_OLD_SPACE_SIZE)
 		, absoluteMinimumNewSubSpaceSize(MINIMUM_NEW_SPACE_SIZE)
 		, parSweepChunkSize(0)
+		, parallelSweepConnect(false)
 		, markingStackSize(4096)
 		, heapExpansionMinimumSize(1024 * 1024)
 		, heapExpansionMaximumSize(0)
@@ -1110,14 +1166,20 @@ public:
 		, heapContractionGCTimeThreshold(5)
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, backgroundDecommit(false)
+		, backgroundDecommitDelay(1000)
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, cacheListSplit(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingPrefetchDistance(0)
+		, workStealingPackets(false)
 		, rootScannerStatsEnabled(false)
 		, softMx(0) /* softMx only set if specified */
 		, gcThreadCountForced(false)
+		, adaptiveGCThreading(false)
+		, adaptiveGCThreadingWorkPerThread(1024 * 1024)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 		, scavengerTraceHotFields(false)
@@ -1133,12 +1195,16 @@ public:
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
 		, scavengerEnabled(false)
+		, scavengerNUMALocal(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, concurrentScavenger(true)
 #endif		
 		, scavengerFailedTenureThreshold(0)
 		, scvArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, scavengerHotFieldCopyDepth(0)
+		, scavengerRememberedSetRangeSlots(0)
+		, scavengerRememberedSetOverflowCards(false)
 		, scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE)
 		, scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE)
 		, tiltedScavenge(true)
@@ -1151,6 +1217,7 @@ public:
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 		, survivorSpaceMaximumSizeRatio(0.50)
 		, tiltedScavengeMaximumIncrease(0.10)
+		, tiltedScavengeRegionSizing(false)
 		, scavengerCollectorExpandRatio(0.1)
 		, scavengerMaximumCollectorExpandSize(1024 * 1024)
 		, dynamicNewSpaceSizing(true)
@@ -1180,12 +1247,14 @@ public:
 		, excessiveGCFreeSizeRatio((float)0.03)
 		, heapRegionManager(NULL)
 		, memoryManager(NULL)
+		, heapDecommitter(NULL)
 #if defined(OMR_GC_MODRON_COMPACTION)
 		, compactOnGlobalGC(0) /* By default we will only compact on triggers, no forced compactions */
 		, noCompactOnGlobalGC(0)
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, partialCompactSize(0)
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 		, concurrentMark(false)
@@ -1200,6 +1269,7 @@ public:
 #else
 		, concurrentBackground(1)
 #endif /* LINUX && S390 */
+		, concurrentBackgroundMark(false)
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
@@ -1241,6 +1311,8 @@ public:
 #endif /* OMR_GC_REALTIME */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedLazySweep(false)
+		, segregatedConcurrentSweep(false)
 #endif
 		, distanceToYieldTimeCheck(0)
 		, traceCostToCheckYield(500) /* weighted sum of marked objects and scanned pointers before we check yield in main tracing loop */
@@ -1264,6 +1336,9 @@ public:
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asynchronousLogging(false)
+		, asynchronousLoggingBufferSize(1024 * 1024)
+		, verboseBinaryFormat(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -119,6 +119,11 @@ public:
 
 	virtual bool commitMemory(void *address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress) = 0;
+	/**
+	 * Move the pages backing one page aligned range of the heap to another, leaving the source range zeroed.
+	 * @return true if the pages were moved, false if the caller has to copy the memory instead
+	 */
+	virtual bool remapMemory(void *source, void *target, uintptr_t size) { return false; }
 
 	void mergeHeapStats(MM_HeapStats *heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats *heapStats);
@@ -0,0 +1,313 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+#include "ModronAssertions.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MemoryManager.hpp"
+
+#include "HeapDecommitter.hpp"
+
+MM_HeapDecommitter *
+MM_HeapDecommitter::newInstance(MM_EnvironmentBase *env)
+{
+	MM_HeapDecommitter *decommitter = (MM_HeapDecommitter *)env->getForge()->allocate(sizeof(MM_HeapDecommitter), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != decommitter) {
+		new(decommitter) MM_HeapDecommitter(env);
+		if (!decommitter->initialize(env)) {
+			decommitter->kill(env);
+			decommitter = NULL;
+		}
+	}
+	return decommitter;
+}
+
+void
+MM_HeapDecommitter::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_HeapDecommitter::MM_HeapDecommitter(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _monitor(NULL)
+	, _state(STATE_ERROR)
+	, _ranges(NULL)
+	, _rangeCount(0)
+	, _queuedBytes(0)
+	, _reclaimedBytes(0)
+	, _releasedBytes(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_HeapDecommitter::initialize(MM_EnvironmentBase *env)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_HeapDecommitter::_monitor")) {
+		return false;
+	}
+
+	_ranges = (DecommitRange *)env->getForge()->allocate(sizeof(DecommitRange) * MAXIMUM_RANGES, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _ranges) {
+		return false;
+	}
+
+	/* hold the monitor over start-up so that the thread can not report its state before we wait for it */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		decommitter_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+	} else {
+		_state = STATE_ERROR;
+	}
+	bool result = (STATE_RUNNING == _state);
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_HeapDecommitter::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		/* memory still queued is left committed, the heap is about to be freed */
+		omrthread_monitor_enter(_monitor);
+		if (STATE_RUNNING == _state) {
+			while (STATE_TERMINATED != _state) {
+				_state = STATE_TERMINATION_REQUESTED;
+				omrthread_monitor_notify_all(_monitor);
+				omrthread_monitor_wait(_monitor);
+			}
+		}
+		omrthread_monitor_exit(_monitor);
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	if (NULL != _ranges) {
+		env->getForge()->free(_ranges);
+		_ranges = NULL;
+	}
+}
+
+bool
+MM_HeapDecommitter::enqueue(MM_MemoryHandle *handle, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	void *top = (void *)((uintptr_t)address + size);
+	bool queued = false;
+
+	omrthread_monitor_enter(_monitor);
+	int64_t now = omrtime_current_time_millis();
+
+	/* successive contractions free adjacent ranges, which are released together */
+	for (uintptr_t i = 0; i < _rangeCount; i++) {
+		DecommitRange *range = &_ranges[i];
+		if (handle == range->handle) {
+			if (range->top == address) {
+				range->top = top;
+				range->highValidAddress = highValidAddress;
+				queued = true;
+			} else if (range->base == top) {
+				range->base = address;
+				range->lowValidAddress = lowValidAddress;
+				queued = true;
+			}
+			if (queued) {
+				range->queuedTime = now;
+				break;
+			}
+		}
+	}
+
+	if (!queued && (_rangeCount < MAXIMUM_RANGES)) {
+		DecommitRange *range = &_ranges[_rangeCount];
+		range->handle = handle;
+		range->base = address;
+		range->top = top;
+		range->lowValidAddress = lowValidAddress;
+		range->highValidAddress = highValidAddress;
+		range->queuedTime = now;
+		_rangeCount += 1;
+		queued = true;
+	}
+
+	if (queued) {
+		_queuedBytes += size;
+		omrthread_monitor_notify_all(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return queued;
+}
+
+void
+MM_HeapDecommitter::reclaim(MM_MemoryHandle *handle, void *address, uintptr_t size)
+{
+	void *top = (void *)((uintptr_t)address + size);
+
+	omrthread_monitor_enter(_monitor);
+	uintptr_t i = 0;
+	while (i < _rangeCount) {
+		DecommitRange *range = &_ranges[i];
+		if ((handle != range->handle) || (top <= range->base) || (address >= range->top)) {
+			i += 1;
+			continue;
+		}
+
+		uintptr_t reclaimed = (uintptr_t)OMR_MIN(top, range->top) - (uintptr_t)OMR_MAX(address, range->base);
+		_reclaimedBytes += reclaimed;
+		_queuedBytes -= reclaimed;
+
+		/* the committed range becomes the valid memory next to what is left of the queued one */
+		if ((range->base < address) && (top < range->top)) {
+			if (_rangeCount < MAXIMUM_RANGES) {
+				DecommitRange *upper = &_ranges[_rangeCount];
+				*upper = *range;
+				upper->base = top;
+				upper->lowValidAddress = top;
+				_rangeCount += 1;
+			} else {
+				/* no room to queue the part above, so it stays committed */
+				_queuedBytes -= (uintptr_t)range->top - (uintptr_t)top;
+			}
+			range->top = address;
+			range->highValidAddress = address;
+			i += 1;
+		} else if (range->base < address) {
+			range->top = address;
+			range->highValidAddress = address;
+			i += 1;
+		} else if (top < range->top) {
+			range->base = top;
+			range->lowValidAddress = top;
+			i += 1;
+		} else {
+			removeRange(i);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+/**
+ * Release the lowest chunk of a queued range. The caller holds the monitor.
+ */
+void
+MM_HeapDecommitter::releaseChunk(uintptr_t index)
+{
+	DecommitRange *range = &_ranges[index];
+	void *chunkTop = range->top;
+	void *highValidAddress = range->highValidAddress;
+
+	if (((uintptr_t)range->top - (uintptr_t)range->base) > RELEASE_CHUNK_SIZE) {
+		chunkTop = (void *)((uintptr_t)range->base + RELEASE_CHUNK_SIZE);
+		/* the rest of the range is still queued and may yet be reclaimed */
+		highValidAddress = chunkTop;
+	}
+
+	uintptr_t chunkSize = (uintptr_t)chunkTop - (uintptr_t)range->base;
+	_extensions->memoryManager->decommitMemory(range->handle, range->base, chunkSize, range->lowValidAddress, highValidAddress);
+	_releasedBytes += chunkSize;
+	_queuedBytes -= chunkSize;
+
+	if (chunkTop == range->top) {
+		removeRange(index);
+	} else {
+		range->base = chunkTop;
+		range->lowValidAddress = chunkTop;
+	}
+}
+
+void
+MM_HeapDecommitter::removeRange(uintptr_t index)
+{
+	Assert_MM_true(index < _rangeCount);
+	_rangeCount -= 1;
+	_ranges[index] = _ranges[_rangeCount];
+}
+
+int J9THREAD_PROC
+MM_HeapDecommitter::decommitter_thread_proc(void *info)
+{
+	MM_HeapDecommitter *decommitter = (MM_HeapDecommitter *)info;
+	decommitter->decommitterThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+/**
+ * Body of the decommitter thread: release each queued range once it has been queued for the delay, oldest first,
+ * until asked to terminate. The thread only calls the port library, so it is not attached to the VM.
+ */
+void
+MM_HeapDecommitter::decommitterThreadEntryPoint()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	int64_t delay = (int64_t)_extensions->backgroundDecommitDelay;
+
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (STATE_RUNNING == _state) {
+		if (0 == _rangeCount) {
+			omrthread_monitor_wait(_monitor);
+		} else {
+			uintptr_t oldest = 0;
+			for (uintptr_t i = 1; i < _rangeCount; i++) {
+				if (_ranges[i].queuedTime < _ranges[oldest].queuedTime) {
+					oldest = i;
+				}
+			}
+
+			int64_t releaseTime = _ranges[oldest].queuedTime + delay;
+			int64_t now = omrtime_current_time_millis();
+			if (now >= releaseTime) {
+				releaseChunk(oldest);
+				/* let a waiting re-expansion in between chunks */
+				omrthread_monitor_exit(_monitor);
+				omrthread_yield();
+				omrthread_monitor_enter(_monitor);
+			} else {
+				omrthread_monitor_wait_timed(_monitor, releaseTime - now, 0);
+			}
+		}
+	}
+
+	/* the monitor is only released by omrthread_exit(), so tearDown() can not return before the thread is detached */
+	_state = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_exit(_monitor);
+}
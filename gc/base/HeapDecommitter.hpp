@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(HEAPDECOMMITTER_HPP_)
+#define HEAPDECOMMITTER_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_MemoryHandle;
+
+/**
+ * Releases the memory the heap contracts by from a background thread (see backgroundDecommit), so that
+ * collections do not pay for the release. Contracted ranges are queued, and released once they have been
+ * queued for backgroundDecommitDelay milliseconds. Until then re-expansion takes them back without
+ * faulting their pages in again.
+ * @ingroup GC_Base_Core
+ */
+class MM_HeapDecommitter : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum {
+		MAXIMUM_RANGES = 64, /**< ranges which may be queued; once full, ranges are released by the contracting thread */
+		RELEASE_CHUNK_SIZE = 4 * 1024 * 1024 /**< most bytes released at once, which bounds how long re-expansion can wait for the thread */
+	};
+
+	typedef enum DecommitterState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	} DecommitterState;
+
+	struct DecommitRange {
+		MM_MemoryHandle *handle; /**< virtual memory the range belongs to */
+		void *base;
+		void *top;
+		void *lowValidAddress; /**< end of the committed memory below the range, or NULL */
+		void *highValidAddress; /**< start of the committed memory above the range, or NULL */
+		int64_t queuedTime; /**< time in milliseconds at which the range was last queued or extended */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	omrthread_monitor_t _monitor; /**< protects the queue and the counters, held while a chunk is released */
+	volatile DecommitterState _state;
+	DecommitRange *_ranges;
+	uintptr_t _rangeCount;
+	uintptr_t _queuedBytes; /**< bytes queued for release */
+	uintptr_t _reclaimedBytes; /**< queued bytes which were committed again before they were released */
+	uintptr_t _releasedBytes; /**< queued bytes which were released */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_HeapDecommitter *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Queue a range of heap to be released.
+	 * @param handle the virtual memory the range belongs to
+	 * @param address the start of the range
+	 * @param size the size of the range
+	 * @param lowValidAddress the end of the previous committed block below address, or NULL if address is the first committed block
+	 * @param highValidAddress the start of the next committed block above address, or NULL if address is the last committed block
+	 * @return true if the range was queued, false if the caller must release it
+	 */
+	bool enqueue(MM_MemoryHandle *handle, void *address, uintptr_t size, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Take back any queued memory in a range of heap which is about to be committed, waiting if the thread is releasing it.
+	 * @param handle the virtual memory the range belongs to
+	 * @param address the start of the range
+	 * @param size the size of the range
+	 */
+	void reclaim(MM_MemoryHandle *handle, void *address, uintptr_t size);
+
+	MMINLINE uintptr_t getQueuedBytes() { return _queuedBytes; }
+	MMINLINE uintptr_t getReclaimedBytes() { return _reclaimedBytes; }
+	MMINLINE uintptr_t getReleasedBytes() { return _releasedBytes; }
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_HeapDecommitter(MM_EnvironmentBase *env);
+
+private:
+	void releaseChunk(uintptr_t index);
+	void removeRange(uintptr_t index);
+
+	void decommitterThreadEntryPoint();
+	static int J9THREAD_PROC decommitter_thread_proc(void *info);
+};
+
+#endif /* HEAPDECOMMITTER_HPP_ */
@@ -20,6 +20,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapWordScan.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -127,6 +128,16 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the run of empty map slots lying entirely below the top in bulk */
+				uintptr_t *heapMapSlotTop = _heapMapSlotCurrent + ((uintptr_t)(_heapChunkTop - _heapSlotCurrent) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT);
+				uintptr_t *heapMapSlotNext = MM_HeapMapWordScan::skipEmptyWords(_heapMapSlotCurrent, heapMapSlotTop);
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (heapMapSlotNext - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNext;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ ******************************************************************************/
+
+#include "HeapMapWordScan.hpp"
+
+/*
+ * The vector scans are compiled for their instruction set regardless of the options the GC is
+ * built with, and are only called once the processor has been found to support them.
+ */
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <immintrin.h>
+#define J9MODRON_HMWS_X86
+#define J9MODRON_HMWS_TARGET(isa) __attribute__((target(isa)))
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#include <immintrin.h>
+#define J9MODRON_HMWS_X86
+#define J9MODRON_HMWS_TARGET(isa)
+#endif
+
+MM_HeapMapWordScan::SkipEmptyWordsFunction MM_HeapMapWordScan::_skipEmptyWords = MM_HeapMapWordScan::selectAndSkipEmptyWords;
+
+/**
+ * Finish a scan one word at a time, once fewer words than a block remain or a block holds a non-zero word.
+ */
+static MMINLINE uintptr_t *
+skipEmptyWordsSingly(uintptr_t *current, uintptr_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t *
+skipEmptyWordsScalar(uintptr_t *current, uintptr_t *top)
+{
+	while ((uintptr_t)(top - current) >= 4) {
+		if (0 != (current[0] | current[1] | current[2] | current[3])) {
+			break;
+		}
+		current += 4;
+	}
+	return skipEmptyWordsSingly(current, top);
+}
+
+#if defined(J9MODRON_HMWS_X86)
+J9MODRON_HMWS_TARGET("sse2") static uintptr_t *
+skipEmptyWordsSSE2(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t wordsPerBlock = 16 / sizeof(uintptr_t);
+	const __m128i zero = _mm_setzero_si128();
+	while ((uintptr_t)(top - current) >= wordsPerBlock) {
+		__m128i words = _mm_loadu_si128((__m128i *)current);
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(words, zero))) {
+			break;
+		}
+		current += wordsPerBlock;
+	}
+	return skipEmptyWordsSingly(current, top);
+}
+
+J9MODRON_HMWS_TARGET("avx2") static uintptr_t *
+skipEmptyWordsAVX2(uintptr_t *current, uintptr_t *top)
+{
+	const uintptr_t wordsPerBlock = 32 / sizeof(uintptr_t);
+	while ((uintptr_t)(top - current) >= wordsPerBlock) {
+		__m256i words = _mm256_loadu_si256((__m256i *)current);
+		if (0 == _mm256_testz_si256(words, words)) {
+			break;
+		}
+		current += wordsPerBlock;
+	}
+	return skipEmptyWordsSingly(current, top);
+}
+
+/**
+ * @return true if the processor, and the operating system's saving of vector registers, support the instruction set
+ */
+static bool
+isSupported(MM_HeapMapWordScan::Implementation implementation)
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+	__cpuid(info, 1);
+	bool sse2 = 0 != (info[3] & (1 << 26));
+	bool osSavesYmm = (0 != (info[2] & (1 << 27))) && (0 != (info[2] & (1 << 28))) && (6 == (_xgetbv(0) & 6));
+	bool avx2 = false;
+	if (osSavesYmm && (maxLeaf >= 7)) {
+		__cpuidex(info, 7, 0);
+		avx2 = 0 != (info[1] & (1 << 5));
+	}
+#else /* _MSC_VER */
+	__builtin_cpu_init();
+	bool sse2 = 0 != __builtin_cpu_supports("sse2");
+	bool avx2 = 0 != __builtin_cpu_supports("avx2");
+#endif /* _MSC_VER */
+
+	switch (implementation) {
+	case MM_HeapMapWordScan::SCALAR:
+		return true;
+	case MM_HeapMapWordScan::SSE2:
+		return sse2;
+	case MM_HeapMapWordScan::AVX2:
+		return avx2;
+	default:
+		return false;
+	}
+}
+#endif /* J9MODRON_HMWS_X86 */
+
+MM_HeapMapWordScan::SkipEmptyWordsFunction
+MM_HeapMapWordScan::getImplementation(Implementation implementation)
+{
+	switch (implementation) {
+	case SCALAR:
+		return skipEmptyWordsScalar;
+#if defined(J9MODRON_HMWS_X86)
+	case SSE2:
+		return isSupported(SSE2) ? skipEmptyWordsSSE2 : NULL;
+	case AVX2:
+		return isSupported(AVX2) ? skipEmptyWordsAVX2 : NULL;
+#endif /* J9MODRON_HMWS_X86 */
+	default:
+		return NULL;
+	}
+}
+
+MM_HeapMapWordScan::Implementation
+MM_HeapMapWordScan::getBestImplementation()
+{
+	Implementation best = SCALAR;
+	for (uintptr_t implementation = SCALAR + 1; implementation < IMPLEMENTATION_COUNT; implementation++) {
+		if (NULL != getImplementation((Implementation)implementation)) {
+			best = (Implementation)implementation;
+		}
+	}
+	return best;
+}
+
+/**
+ * Initial value of _skipEmptyWords. Every thread which races through here selects the same scan,
+ * so the unsynchronized store is harmless.
+ */
+uintptr_t *
+MM_HeapMapWordScan::selectAndSkipEmptyWords(uintptr_t *current, uintptr_t *top)
+{
+	_skipEmptyWords = getImplementation(getBestImplementation());
+	return _skipEmptyWords(current, top);
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPWORDSCAN_HPP_)
+#define HEAPMAPWORDSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/**
+ * Bulk scanning of heap map words.
+ * Sparsely live heaps have long runs of empty heap map words, which sweep and heap map iteration
+ * would otherwise read one word at a time. On x86 the widest vector scan the processor supports
+ * (AVX2 or SSE2) is selected the first time a run of empty words is skipped; other platforms use
+ * an unrolled scalar loop.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapWordScan
+{
+public:
+	/**
+	 * The scans which may be compiled into the GC, from narrowest to widest.
+	 */
+	enum Implementation {
+		SCALAR = 0, /**< four words ORed together at a time */
+		SSE2, /**< 16 bytes at a time */
+		AVX2, /**< 32 bytes at a time */
+		IMPLEMENTATION_COUNT
+	};
+
+	/**
+	 * Signature shared by every scan: the address of the first non-zero word in [current, top), or top.
+	 */
+	typedef uintptr_t *(*SkipEmptyWordsFunction)(uintptr_t *current, uintptr_t *top);
+
+private:
+	static SkipEmptyWordsFunction _skipEmptyWords; /**< scan selected for this processor, or selectAndSkipEmptyWords until then */
+
+	static uintptr_t *selectAndSkipEmptyWords(uintptr_t *current, uintptr_t *top);
+
+public:
+	/**
+	 * Find the scan for the given implementation.
+	 * @param implementation the scan to find
+	 * @return the scan, or NULL if it is not compiled into the GC or the processor does not support it
+	 */
+	static SkipEmptyWordsFunction getImplementation(Implementation implementation);
+
+	/**
+	 * @return the widest scan supported by the processor
+	 */
+	static Implementation getBestImplementation();
+
+	/**
+	 * Find the first non-empty heap map word in a range.
+	 * Only words within [current, top) are read.
+	 * @param current first heap map word to examine
+	 * @param top end of the range (exclusive)
+	 * @return address of the first non-zero word, or top if every word in the range is zero
+	 */
+	static MMINLINE uintptr_t *
+	skipEmptyWords(uintptr_t *current, uintptr_t *top)
+	{
+		/* most calls find a live word straight away, so only call out to the vector scan for a run of empty words */
+		if ((current < top) && (0 != *current)) {
+			return current;
+		}
+		return _skipEmptyWords(current, top);
+	}
+};
+
+#endif /* HEAPMAPWORDSCAN_HPP_ */
@@ -24,6 +24,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Collector.hpp"
+#include "HeapDecommitter.hpp"
 #include "HeapRegionManager.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -307,6 +308,10 @@ MM_HeapVirtualMemory::commitMemory(void* address, uintptr_t size)
 {
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	if (NULL != extensions->heapDecommitter) {
+		/* memory contracted recently may not have been released yet, and must not be released once it is reused */
+		extensions->heapDecommitter->reclaim(&_vmemHandle, address, size);
+	}
 	return memoryManager->commitMemory(&_vmemHandle, address, size);
 }
 
@@ -320,9 +325,24 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 {
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	if ((NULL != extensions->heapDecommitter) && extensions->heapDecommitter->enqueue(&_vmemHandle, address, size, lowValidAddress, highValidAddress)) {
+		return true;
+	}
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+/**
+ * Move the pages backing the source range to the target range rather than copying them.
+ * @return true if successful, false otherwise.
+ */
+bool
+MM_HeapVirtualMemory::remapMemory(void* source, void* target, uintptr_t size)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
+	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	return memoryManager->remapMemory(&_vmemHandle, source, target, size);
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
@@ -60,6 +60,7 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual bool remapMemory(void* source, void* target, uintptr_t size);
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
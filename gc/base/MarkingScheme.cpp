@@ -34,6 +34,7 @@
 #include "WorkPacketsConcurrent.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #include "WorkPacketsStandard.hpp"
+#include "WorkPacketsStealing.hpp"
 
 /**
  * Allocate and initialize a new instance of the receiver.
@@ -84,6 +85,10 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->markingPrefetchDistance > MARKING_PREFETCH_DISTANCE_MAX) {
+		_extensions->markingPrefetchDistance = MARKING_PREFETCH_DISTANCE_MAX;
+	}
+
 	return true;
 
 error_no_memory:
@@ -274,14 +279,60 @@ MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
 	omrobjectptr_t objectPtr = NULL;
 	MM_WorkPackets *packets = getWorkPackets();
+	uintptr_t prefetchDistance = _extensions->markingPrefetchDistance;
 
 	do {
-		while(NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			scanObject(env, objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET);
+		if (0 == prefetchDistance) {
+			while(NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				scanObject(env, objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET);
+			}
+		} else {
+			scanWorkStackWithPrefetch(env, prefetchDistance);
 		}
 	} while (packets->handleWorkPacketOverflow(env));
 }
 
+void
+MM_MarkingScheme::scanWorkStackWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance)
+{
+	omrobjectptr_t lookahead[MARKING_PREFETCH_DISTANCE_MAX];
+	uintptr_t head = 0;
+	uintptr_t count = 0;
+
+	Assert_MM_true((0 < prefetchDistance) && (MARKING_PREFETCH_DISTANCE_MAX >= prefetchDistance));
+
+	while (true) {
+		/* Top up the ring. Only block waiting for work when the ring is empty: a thread holding
+		 * objects in its ring must not take part in work packet termination.
+		 */
+		while (count < prefetchDistance) {
+			omrobjectptr_t objectPtr = NULL;
+			if (0 == count) {
+				objectPtr = (omrobjectptr_t)env->_workStack.pop(env);
+			} else {
+				objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+			}
+			if (NULL == objectPtr) {
+				break;
+			}
+			prefetchObject(objectPtr);
+			env->_markStats._objectsPrefetched += 1;
+			lookahead[(head + count) % prefetchDistance] = objectPtr;
+			count += 1;
+		}
+
+		if (0 == count) {
+			/* all work packets have been processed */
+			break;
+		}
+
+		omrobjectptr_t objectPtr = lookahead[head];
+		head = (head + 1) % prefetchDistance;
+		count -= 1;
+		scanObject(env, objectPtr, MM_CollectorLanguageInterface::SCAN_REASON_PACKET);
+	}
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
@@ -348,7 +399,9 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env) {
 		workPackets = MM_WorkPacketsConcurrent::newInstance(env);
 	} else
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-	{
+	if (_extensions->workStealingPackets) {
+		workPackets = MM_WorkPacketsStealing::newInstance(env);
+	} else {
 		workPackets = MM_WorkPacketsStandard::newInstance(env);
 	}
 
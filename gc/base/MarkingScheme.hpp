@@ -24,6 +24,7 @@
 
 #include "BaseVirtual.hpp"
 
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -35,6 +36,18 @@
 #define SCAN_MAX (uintptr_t)(-1)
 #define BITS_PER_BYTE 8
 
+/* Upper bound for markingPrefetchDistance (size of the per-thread lookahead ring used by completeScan) */
+#define MARKING_PREFETCH_DISTANCE_MAX 16
+
+/* Distance between the two cache lines prefetched for every object entering the lookahead ring */
+#if defined(AIXPPC) || defined(LINUXPPC)
+#define MARKING_PREFETCH_LINE_SIZE 128
+#elif defined(J9ZOS390) || (defined(LINUX) && defined(S390))
+#define MARKING_PREFETCH_LINE_SIZE 256
+#else
+#define MARKING_PREFETCH_LINE_SIZE 64
+#endif
+
 class MM_CollectorLanguageInterface;
 
 /**
@@ -70,6 +83,26 @@ private:
 
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
+	/**
+	 * Prefetch the header and the leading slots of an object which is about to be scanned.
+	 * @param[in] objectPtr the object to prefetch
+	 */
+	MMINLINE void
+	prefetchObject(omrobjectptr_t objectPtr)
+	{
+		MM_AtomicOperations::prefetch((void *)objectPtr);
+		MM_AtomicOperations::prefetch((void *)((uintptr_t)objectPtr + MARKING_PREFETCH_LINE_SIZE));
+	}
+
+	/**
+	 * Drain the work stack through a lookahead ring of popped objects. Each object is prefetched
+	 * when it enters the ring and only scanned once prefetchDistance - 1 other objects have been
+	 * popped after it, giving the memory system time to bring it into the cache.
+	 * @param[in] env the current thread
+	 * @param[in] prefetchDistance number of objects held in the ring (1..MARKING_PREFETCH_DISTANCE_MAX)
+	 */
+	void scanWorkStackWithPrefetch(MM_EnvironmentBase *env, uintptr_t prefetchDistance);
+
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -66,6 +66,10 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	if (extensions->transparentHugePages) {
+		mode |= OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES;
+	}
+
 	uintptr_t allocateSize = size;
 	if (heapAlignment > pageSize) {
 		allocateSize += (heapAlignment - pageSize);
@@ -315,6 +319,11 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			uintptr_t pageFlags = extensions->gcmetadataPageFlags;
 			Assert_MM_true(0 != pageSize);
 
+			/* the card table and mark map are aligned to the heap alignment, and so to whole huge pages */
+			if (extensions->transparentHugePages && !isLargePage(env, pageSize)) {
+				mode |= OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES;
+			}
+
 			/*
 			 * Preallocation is enabled for all platforms where metadata can be allocated in virtual memory
 			 * Segmentation is enabled for AIX-64 only, so physical page size is used as a segment size for other platforms
@@ -417,6 +426,15 @@ MM_MemoryManager::decommitMemory(MM_MemoryHandle* handle, void* address, uintptr
 	return memory->decommitMemory(address, size, lowValidAddress, highValidAddress);
 }
 
+bool
+MM_MemoryManager::remapMemory(MM_MemoryHandle* handle, void* source, void* target, uintptr_t size)
+{
+	Assert_MM_true(NULL != handle);
+	MM_VirtualMemory* memory = handle->getVirtualMemory();
+	Assert_MM_true(NULL != memory);
+	return memory->remapMemory(source, target, size);
+}
+
 bool
 MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 {
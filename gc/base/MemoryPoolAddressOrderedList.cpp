@@ -37,6 +37,7 @@
 #include "LargeObjectAllocateStats.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "Heap.hpp"
+#include "Math.hpp"
 
 /**
  * Create and initialize a new instance of the receiver.
@@ -520,10 +521,118 @@ fail_allocate:
 	return NULL;
 }
 
+/**
+ * Allocate an object starting on a page boundary. The part of the free entry below the object is kept on the
+ * free list if it is large enough, as is the part above it. Hints are not used since they do not account for
+ * the alignment, so the whole free list may be searched.
+ */
+void *
+MM_MemoryPoolAddressOrderedList::internalAllocatePageAligned(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
+{
+	MM_HeapLinkedFreeHeader *currentFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *nextFreeEntry = NULL;
+	uintptr_t walkCount = 0;
+	uintptr_t largestFreeEntry = 0;
+	uintptr_t addrBase = 0;
+	uintptr_t entryBase = 0;
+	uintptr_t entryTop = 0;
+	uintptr_t leadingDiscardedBytes = 0;
+	uintptr_t trailingDiscardedBytes = 0;
+
+	if (lockingRequired) {
+		_heapLock.acquire();
+	}
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+retry:
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+	currentFreeEntry = _heapFreeList;
+	previousFreeEntry = NULL;
+	walkCount = 0;
+
+	while (NULL != currentFreeEntry) {
+		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+		if (currentFreeEntrySize > largestFreeEntry) {
+			largestFreeEntry = currentFreeEntrySize;
+		}
+
+		entryBase = (uintptr_t)currentFreeEntry;
+		entryTop = entryBase + currentFreeEntrySize;
+		addrBase = MM_Math::roundToCeiling(_pageSize, entryBase);
+		if ((addrBase < entryTop) && (sizeInBytesRequired <= (entryTop - addrBase))) {
+			break;
+		}
+
+		walkCount += 1;
+
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext();
+		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
+	}
+
+	if (NULL == currentFreeEntry) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+		if(_memorySubSpace->replenishPoolForAllocate(env, this, sizeInBytesRequired + _pageSize)) {
+			goto retry;
+		}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+		setLargestFreeEntry(largestFreeEntry);
+		if (lockingRequired) {
+			_heapLock.release();
+		}
+		return NULL;
+	}
+
+	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(entryTop - entryBase);
+	/* The entry is split, so a hint to it may no longer be satisfied by it */
+	removeHint(currentFreeEntry);
+	nextFreeEntry = currentFreeEntry->getNext();
+
+	/* The entry leaves the free list, the parts of it around the object return to it below */
+	_freeMemorySize -= (entryTop - entryBase);
+	_freeEntryCount -= 1;
+
+	_allocCount += 1;
+	_allocBytes += sizeInBytesRequired;
+	_allocSearchCount += walkCount;
+
+	if (recycleHeapChunk((void *)entryBase, (void *)addrBase, previousFreeEntry, nextFreeEntry)) {
+		previousFreeEntry = currentFreeEntry;
+		_freeMemorySize += addrBase - entryBase;
+		_freeEntryCount += 1;
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(addrBase - entryBase);
+	} else {
+		leadingDiscardedBytes = addrBase - entryBase;
+	}
+
+	uintptr_t recycleBase = addrBase + sizeInBytesRequired;
+	if (recycleHeapChunk((void *)recycleBase, (void *)entryTop, previousFreeEntry, nextFreeEntry)) {
+		_freeMemorySize += entryTop - recycleBase;
+		_freeEntryCount += 1;
+		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(entryTop - recycleBase);
+	} else {
+		trailingDiscardedBytes = entryTop - recycleBase;
+	}
+	_allocDiscardedBytes += leadingDiscardedBytes + trailingDiscardedBytes;
+
+	if (NULL != largeObjectAllocateStats) {
+		largeObjectAllocateStats->allocateObject(sizeInBytesRequired);
+	}
+	_largeObjectAllocateStats->allocatePageAlignedObject(sizeInBytesRequired, leadingDiscardedBytes);
+
+	if (lockingRequired) {
+		_heapLock.release();
+	}
+
+	return (void *)addrBase;
+}
+
 void *
 MM_MemoryPoolAddressOrderedList::allocateObject(MM_EnvironmentBase *env,  MM_AllocateDescription *allocDescription)
 {
-	void * addr = internalAllocate(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStats);
+	void * addr = allocateContiguous(env, allocDescription->getContiguousBytes(), true, _largeObjectAllocateStats);
 
 	if (addr != NULL) {
 #if defined(OMR_GC_ALLOCATION_TAX)
@@ -542,7 +651,7 @@ MM_MemoryPoolAddressOrderedList::allocateObject(MM_EnvironmentBase *env,  MM_All
 void *
 MM_MemoryPoolAddressOrderedList::collectorAllocate(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool lockingRequired)
 {
-	void *addr = internalAllocate(env, allocDescription->getContiguousBytes(), lockingRequired, _largeObjectCollectorAllocateStats);
+	void *addr = allocateContiguous(env, allocDescription->getContiguousBytes(), lockingRequired, _largeObjectCollectorAllocateStats);
 
 	if (addr != NULL) {
 		allocDescription->setTLHAllocation(false);
@@ -56,6 +56,9 @@ private:
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
+	uintptr_t _pageAlignedMinimumSize; /**< objects at least this large are allocated at page granularity, 0 if no object is */
+	uintptr_t _pageSize; /**< granularity of page aligned allocation */
+
 protected:
 public:
 	
@@ -70,6 +73,14 @@ private:
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+	void *internalAllocatePageAligned(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+	MMINLINE void *allocateContiguous(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
+	{
+		if ((0 != _pageAlignedMinimumSize) && (sizeInBytesRequired >= _pageAlignedMinimumSize)) {
+			return internalAllocatePageAligned(env, sizeInBytesRequired, lockingRequired, largeObjectAllocateStats);
+		}
+		return internalAllocate(env, sizeInBytesRequired, lockingRequired, largeObjectAllocateStats);
+	}
 	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 
 	bool recycleHeapChunk(void *addrBase, void *addrTop, MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *nextFreeEntry);	
@@ -129,6 +140,18 @@ public:
 	
 	virtual void appendCollectorLargeAllocateStats();
 
+	/**
+	 * Allocate objects of at least minimumSize bytes starting on a page boundary, so that compaction can move them
+	 * by remapping their pages rather than copying them.
+	 * @param minimumSize smallest object allocated at page granularity, 0 to allocate every object from the start of a free entry
+	 * @param pageSize page size of the heap
+	 */
+	void setPageAlignedAllocation(uintptr_t minimumSize, uintptr_t pageSize)
+	{
+		_pageAlignedMinimumSize = (0 == minimumSize) ? 0 : OMR_MAX(minimumSize, pageSize);
+		_pageSize = pageSize;
+	}
+
 	virtual void mergeFreeEntryAllocateStats() {_largeObjectAllocateStats->getFreeEntrySizeClassStats()->mergeCountForVeryLargeEntries();}
 	
 	virtual bool initializeSweepPool(MM_EnvironmentBase *env);
@@ -145,6 +168,8 @@ public:
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
+		,_pageAlignedMinimumSize(0)
+		,_pageSize(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -153,6 +178,8 @@ public:
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
 		,_largeObjectCollectorAllocateStats(NULL)
+		,_pageAlignedMinimumSize(0)
+		,_pageSize(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -139,6 +139,25 @@ MM_MemoryPoolAddressOrderedListBase::connectOuterMemoryToPool(MM_EnvironmentBase
 	}
 }
 
+/**
+ * Connect leading/trailing chunk free memory piece within a free list fragment ("Connect" for parallel connect)
+ * Unlike connectOuterMemoryToPool() the pool list head is never touched, so fragments of the
+ * list may be built by several threads at once and linked to the pool later.
+ *
+ * @param address free memory start address
+ * @param size free memory size in bytes
+ * @param nextFreeEntry next element of list this memory must be connected with
+ */
+void
+MM_MemoryPoolAddressOrderedListBase::connectOuterMemoryToSublist(MM_EnvironmentBase* env, void* address, uintptr_t size, void* nextFreeEntry)
+{
+	Assert_MM_true((NULL != address) && (address < nextFreeEntry));
+	Assert_MM_true(size >= getMinimumFreeEntrySize());
+
+	/* Build the free header */
+	createFreeEntry(env, (MM_HeapLinkedFreeHeader*)address, (uint8_t*)address + size, NULL, (MM_HeapLinkedFreeHeader*)nextFreeEntry);
+}
+
 /**
  * Connect leading/trailing chunk free memory piece ("Finalize")
  * temporary - need be separated because of implementation of subpools
@@ -168,6 +168,7 @@ protected:
 
 	bool connectInnerMemoryToPool(MM_EnvironmentBase* env, void* address, uintptr_t size, void* previousFreeEntry);
 	void connectOuterMemoryToPool(MM_EnvironmentBase *env, void *address, uintptr_t size, void *nextFreeEntry);
+	void connectOuterMemoryToSublist(MM_EnvironmentBase *env, void *address, uintptr_t size, void *nextFreeEntry);
 	void connectFinalMemoryToPool(MM_EnvironmentBase *env, void *address, uintptr_t size);
 	void abandonMemoryInPool(MM_EnvironmentBase *env, void *address, uintptr_t size);
 
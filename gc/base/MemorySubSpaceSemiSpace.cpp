@@ -710,8 +710,20 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBas
 		/* Calculate the desired survivor space ratio */
 		
 		double survivorSizeAmplification = 1.04 + extensions->dispatcher->threadCount() / 100.0;
-		_desiredSurvivorSpaceRatio = (_tiltedAverageBytesFlipped + _tiltedAverageBytesFlippedDelta)
-										* survivorSizeAmplification	/ currentSize;
+		if (extensions->tiltedScavengeRegionSizing) {
+			/* Give the survivor space as many whole regions as the last scavenge flipped, plus one region of headroom,
+			 * and hand the rest of new space to allocation right away rather than as the averages decay. The shrink
+			 * limit below is not applied either. Allocate and survivor are still carved from the one contiguous range
+			 * of new space rather than taken from a free region pool, since the scavenger, the semispace sub spaces
+			 * and the card table and remembered set code all assume each of them is a single range.
+			 */
+			uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+			uintptr_t survivorRegionBytes = MM_Math::roundToCeiling(regionSize, (uintptr_t)(flipBytes * survivorSizeAmplification)) + regionSize;
+			_desiredSurvivorSpaceRatio = (double)survivorRegionBytes / currentSize;
+		} else {
+			_desiredSurvivorSpaceRatio = (_tiltedAverageBytesFlipped + _tiltedAverageBytesFlippedDelta)
+											* survivorSizeAmplification	/ currentSize;
+		}
 										
 		if(debug) {
 			omrtty_printf("\tDesired survivor size: %zu  ratio: %zu\n",
@@ -733,7 +745,7 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBas
 		
 		/* Do not let survivor space shrink by more than the maximum tilt increase */
 		assume0(previousSurvivorSpaceRatio >= extensions->tiltedScavengeMaximumIncrease);
-		if (_desiredSurvivorSpaceRatio < (previousSurvivorSpaceRatio - extensions->tiltedScavengeMaximumIncrease)) {
+		if (!extensions->tiltedScavengeRegionSizing && (_desiredSurvivorSpaceRatio < (previousSurvivorSpaceRatio - extensions->tiltedScavengeMaximumIncrease))) {
 			_desiredSurvivorSpaceRatio = previousSurvivorSpaceRatio -  extensions->tiltedScavengeMaximumIncrease;
 		}
 		
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PACKETDEQUE_HPP_)
+#define PACKETDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_Packet;
+
+/**
+ * Fixed capacity work-stealing deque of packets (Chase-Lev).
+ * The owning thread pushes and pops at the bottom without any atomic operation except when
+ * racing for the last entry; any other thread may steal from the top with a single compare and swap.
+ * The deque never grows: a failed push tells the caller to fall back to the shared packet lists.
+ * @ingroup GC_Base
+ */
+class MM_PacketDeque : public MM_BaseNonVirtual
+{
+/* Data members */
+public:
+	enum {
+		_capacity = 256 /**< number of slots in the deque, must be a power of two */
+	};
+
+private:
+	volatile uintptr_t _top; /**< index of the next entry to steal, only advanced with compare and swap */
+	volatile uintptr_t _bottom; /**< index of the next free slot, only written by the owner */
+	uintptr_t _victimSeed; /**< owner private state used to pick steal victims */
+	MM_Packet * volatile _slots[_capacity]; /**< circular array of entries, indexed modulo _capacity */
+
+/* Methods */
+public:
+	/**
+	 * Reset the deque to empty.
+	 * @param seed initial (non-zero) value of the steal victim generator
+	 */
+	void
+	initialize(uintptr_t seed)
+	{
+		_top = 0;
+		_bottom = 0;
+		_victimSeed = (0 == seed) ? 1 : seed;
+	}
+
+	/**
+	 * @return true if the deque appeared empty at the time of the call
+	 */
+	MMINLINE bool
+	isEmpty()
+	{
+		return 0 >= (intptr_t)(_bottom - _top);
+	}
+
+	/**
+	 * Push a packet at the bottom of the deque. Must only be called by the owner.
+	 * @return true on success, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_slots[bottom & (_capacity - 1)] = packet;
+		/* the entry must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed packet. Must only be called by the owner.
+	 * @return a packet, or NULL if the deque is empty or the last entry was stolen
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* publish the reservation before reading top so that a racing thief sees it */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		MM_Packet *packet = NULL;
+
+		if (0 <= (intptr_t)(bottom - top)) {
+			packet = _slots[bottom & (_capacity - 1)];
+			if (bottom == top) {
+				/* last entry - thieves may be competing for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					packet = NULL;
+				}
+				_bottom = top + 1;
+			}
+		} else {
+			_bottom = top;
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet from the deque. May be called by any thread.
+	 * @return a packet, or NULL if the deque is empty or another thread won the race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		uintptr_t top = _top;
+		MM_AtomicOperations::readBarrier();
+		uintptr_t bottom = _bottom;
+		MM_Packet *packet = NULL;
+
+		if (0 < (intptr_t)(bottom - top)) {
+			packet = _slots[top & (_capacity - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Pick the next steal victim. Must only be called by the owner.
+	 * @param victimCount number of deques to choose from
+	 * @return index in the range [0, victimCount)
+	 */
+	MMINLINE uintptr_t
+	nextVictim(uintptr_t victimCount)
+	{
+		/* xorshift - cheap and good enough to spread thieves across victims */
+		uintptr_t seed = _victimSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		_victimSeed = seed;
+		return seed % victimCount;
+	}
+};
+
+#endif /* PACKETDEQUE_HPP_ */
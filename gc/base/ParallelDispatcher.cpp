@@ -47,6 +47,9 @@ typedef struct slaveThreadInfo {
 
 #define MINIMUM_HEAP_PER_THREAD (2*1024*1024)
 
+/* shortest interval over which the CPU use of other processes is measured, in nanoseconds */
+#define CPU_LOAD_SAMPLE_INTERVAL (10*1000*1000)
+
 uintptr_t
 dispatcher_thread_proc2(OMRPortLibrary* portLib, void *info)
 {
@@ -156,7 +159,7 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	while(slave_status_dying != _statusTable[slaveID]) {
 		/* Wait for a task to be dispatched to the slave thread */
 		while(slave_status_waiting == _statusTable[slaveID]) {
-			omrthread_monitor_wait(_slaveThreadMutex);
+			waitForTask(env);
 		}
 
 		if(slave_status_reserved == _statusTable[slaveID]) {
@@ -174,6 +177,27 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_slaveThreadMutex);	
 }
 
+/**
+ * Wait for the slave thread to be reserved for a task or told to die.
+ * Each slave waits on its own monitor, so that only the threads reserved for a task are woken for it.
+ * @note called and returns with _slaveThreadMutex held
+ */
+void
+MM_ParallelDispatcher::waitForTask(MM_EnvironmentBase *env)
+{
+	uintptr_t slaveID = env->getSlaveID();
+	omrthread_monitor_t wakeUpMonitor = _slaveWakeUpMonitors[slaveID];
+
+	omrthread_monitor_exit(_slaveThreadMutex);
+	omrthread_monitor_enter(wakeUpMonitor);
+	/* The status is changed before the monitor is notified, so the change can not be missed */
+	while(slave_status_waiting == _statusTable[slaveID]) {
+		omrthread_monitor_wait(wakeUpMonitor);
+	}
+	omrthread_monitor_exit(wakeUpMonitor);
+	omrthread_monitor_enter(_slaveThreadMutex);
+}
+
 void
 MM_ParallelDispatcher::masterEntryPoint(MM_EnvironmentBase *env)
 {
@@ -217,6 +241,15 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		omrthread_monitor_destroy(_synchronizeMutex);
 		_synchronizeMutex = NULL;
 	}
+	if(_slaveWakeUpMonitors) {
+		for(uintptr_t index=0; index < _slaveWakeUpMonitorCount; index++) {
+			if(_slaveWakeUpMonitors[index]) {
+				omrthread_monitor_destroy(_slaveWakeUpMonitors[index]);
+			}
+		}
+		forge->free(_slaveWakeUpMonitors);
+		_slaveWakeUpMonitors = NULL;
+	}
 
 	if(_taskTable) {
 		forge->free(_taskTable);
@@ -267,6 +300,18 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	_slaveWakeUpMonitors = (omrthread_monitor_t *)forge->allocate(_threadCountMaximum * sizeof(omrthread_monitor_t), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if(!_slaveWakeUpMonitors) {
+		goto error_no_memory;
+	}
+	memset(_slaveWakeUpMonitors, 0, _threadCountMaximum * sizeof(omrthread_monitor_t));
+	_slaveWakeUpMonitorCount = _threadCountMaximum;
+	for(uintptr_t index=0; index < _threadCountMaximum; index++) {
+		if(omrthread_monitor_init_with_name(&_slaveWakeUpMonitors[index], 0, "MM_ParallelDispatcher::slaveWakeUp")) {
+			goto error_no_memory;
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -365,7 +410,7 @@ MM_ParallelDispatcher::shutDownThreads()
 	/* making them the master in a single threaded GC */
 	_threadCount = 1;
 
-	wakeUpThreads(_threadShutdownCount);
+	wakeUpThreads(_threadCountMaximum);
 	omrthread_monitor_exit(_slaveThreadMutex);
 
 	omrthread_monitor_enter(_dispatcherMonitor);
@@ -376,15 +421,18 @@ MM_ParallelDispatcher::shutDownThreads()
 }
 
 /**
- * Wake up at least the first <code>count</code> slave threads.
- * In this implementation, since slaveThreadEntryPoint() allows a thread to
- * go back to sleep if it wasn't selected, we can wake them all up. This
- * may not apply to all subclasses though.
+ * Wake up the first <code>count</code> slave threads.
+ * Each slave waits on its own monitor (see waitForTask()), so the cost of dispatching
+ * a task does not depend on the number of idle threads.
  */
 void
 MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 {
-	omrthread_monitor_notify_all(_slaveThreadMutex);	
+	for(uintptr_t index=0; index < count; index++) {
+		omrthread_monitor_enter(_slaveWakeUpMonitors[index]);
+		omrthread_monitor_notify(_slaveWakeUpMonitors[index]);
+		omrthread_monitor_exit(_slaveWakeUpMonitors[index]);
+	}
 }
 
 /**
@@ -402,6 +450,46 @@ MM_ParallelDispatcher::recomputeActiveThreadCount(MM_EnvironmentBase *env)
 	_activeThreadCount = adjustThreadCount(_threadCount);
 }
 
+void
+MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task)
+{
+	recomputeActiveThreadCount(env);
+
+	if (_extensions->adaptiveGCThreading) {
+		/* Waking threads which will find no work, or which compete for CPUs with other processes, only lengthens the pause */
+		uintptr_t recommendedThreads = task->getRecommendedWorkingThreads();
+		uintptr_t availableCPUs = getAvailableCPUs(env);
+		uintptr_t threadCount = OMR_MIN(_activeThreadCount, OMR_MIN(recommendedThreads, availableCPUs));
+		_activeThreadCount = OMR_MAX(threadCount, 1);
+		Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_adaptive(_activeThreadCount, recommendedThreads, availableCPUs);
+	}
+}
+
+uintptr_t
+MM_ParallelDispatcher::getAvailableCPUs(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	uintptr_t cpuCount = omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_TARGET);
+	J9SysinfoCPUTime cpuTime;
+
+	if (0 == omrsysinfo_get_CPU_utilization(&cpuTime)) {
+		int64_t elapsed = cpuTime.timestamp - _cpuTimeSample.timestamp;
+		if ((0 == _cpuTimeSample.timestamp) || (CPU_LOAD_SAMPLE_INTERVAL <= elapsed)) {
+			int64_t processCPUTime = omrthread_get_process_cpu_time();
+			if ((0 != _cpuTimeSample.timestamp) && (-1 != processCPUTime) && (-1 != _processCPUTimeSample)) {
+				/* Subtract the CPU time of this process: the mutators are stopped while the GC threads run */
+				int64_t otherCPUTime = (cpuTime.cpuTime - _cpuTimeSample.cpuTime) - (processCPUTime - _processCPUTimeSample);
+				uintptr_t busyCPUs = (0 < otherCPUTime) ? (uintptr_t)(otherCPUTime / elapsed) : 0;
+				_availableCPUs = (busyCPUs < cpuCount) ? (cpuCount - busyCPUs) : 1;
+			}
+			_cpuTimeSample = cpuTime;
+			_processCPUTimeSample = processCPUTime;
+		}
+	}
+
+	return OMR_MIN(_availableCPUs, cpuCount);
+}
+
 uintptr_t 
 MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 {
@@ -447,7 +535,7 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 		/* Metronome recomputes the number of GC threads at the beginning of
 		 * a GC cycle. It may not be safe to do so at the beginning of a task
 		 */	
-		recomputeActiveThreadCount(env);
+		recomputeActiveThreadCountForTask(env, task);
 	}
 
 	task->setThreadCount(_activeThreadCount);
@@ -59,6 +59,8 @@ protected:
 	MM_Task **_taskTable;
 	
 	omrthread_monitor_t _slaveThreadMutex;
+	omrthread_monitor_t *_slaveWakeUpMonitors; /**< for each slave, the monitor it waits on for a task, so that dispatching a task only wakes the threads reserved for it */
+	uintptr_t _slaveWakeUpMonitorCount; /**< number of entries of _slaveWakeUpMonitors */
 	omrthread_monitor_t _dispatcherMonitor; /**< Provides signalling between threads for startup and shutting down as well as the thread that initiated the shutdown */
 
 	/* The synchronize mutex should eventually be a table of mutexes that are distributed to each */
@@ -73,6 +75,10 @@ protected:
 	uintptr_t _threadCount; /**< number of threads currently forked */
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
 
+	J9SysinfoCPUTime _cpuTimeSample; /**< system CPU time when the available CPUs were last computed */
+	int64_t _processCPUTimeSample; /**< process CPU time when the available CPUs were last computed, -1 if unsupported */
+	uintptr_t _availableCPUs; /**< CPUs which were not used by other processes over the last sampling interval */
+
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
@@ -105,6 +111,20 @@ protected:
 	virtual void wakeUpThreads(uintptr_t count);
 
 	virtual void recomputeActiveThreadCount(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide how many threads should be active for the given task: under adaptive GC threading, no more than
+	 * the task recommends and no more than the CPUs not used by other processes.
+	 */
+	virtual void recomputeActiveThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task);
+
+	/**
+	 * @return the number of CPUs which were not used by other processes since the previous sample
+	 * @note the caller must hold _slaveThreadMutex
+	 */
+	uintptr_t getAvailableCPUs(MM_EnvironmentBase *env);
+
+	void waitForTask(MM_EnvironmentBase *env);
 	
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
@@ -135,6 +155,8 @@ public:
 		,_statusTable(NULL)
 		,_taskTable(NULL)
 		,_slaveThreadMutex(NULL)
+		,_slaveWakeUpMonitors(NULL)
+		,_slaveWakeUpMonitorCount(0)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
 		,_slaveThreadsReservedForGC(false)
@@ -142,11 +164,14 @@ public:
 		,_threadCountMaximum(1)
 		,_threadCount(1)
 		,_activeThreadCount(1)
+		,_processCPUTimeSample(-1)
+		,_availableCPUs(UDATA_MAX)
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
 	{
 		_typeId = __FUNCTION__;
+		memset(&_cpuTimeSample, 0, sizeof(_cpuTimeSample));
 	}
 
 	/*
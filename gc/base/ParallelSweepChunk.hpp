@@ -56,6 +56,7 @@ public:
 	uintptr_t freeListTailSize;
 	MM_HeapLinkedFreeHeader *previousFreeListTail; /**< previous free entry of freeListTail */
 	bool _coalesceCandidate;  /**< Flag if the chunk can coalesce with the previous chunks free information */
+	bool _liveObjectFound;  /**< Flag if sweep found at least one marked object in the chunk */
 	MM_MemoryPool *memoryPool;
 	uintptr_t freeBytes;
 	uintptr_t freeHoles;
@@ -125,6 +126,7 @@ public:
 		freeListTailSize(0),
 		previousFreeListTail(NULL),
 		_coalesceCandidate(false),
+		_liveObjectFound(false),
 		memoryPool(NULL),
 		freeBytes(0),
 		freeHoles(0),
@@ -44,6 +44,26 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNCHRONOUS_LOGGING "-Xgc:asynchronousLogging"
+#define OMR_XGCASYNCHRONOUS_LOGGING_LENGTH 24
+#define OMR_XGCVERBOSE_BINARY_FORMAT "-Xgc:verboseBinaryFormat"
+#define OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH 24
+#define OMR_XGCBACKGROUND_DECOMMIT "-Xgc:backgroundDecommit"
+#define OMR_XGCBACKGROUND_DECOMMIT_LENGTH 23
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCONCURRENT_BACKGROUND_MARK "-Xgc:concurrentBackgroundMark"
+#define OMR_XGCCONCURRENT_BACKGROUND_MARK_LENGTH 29
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_COMPRESSED_POINTERS)
+#define OMR_XGCCOMPRESSED_REFS_SHIFT "-Xgc:compressedRefsShift="
+#define OMR_XGCCOMPRESSED_REFS_SHIFT_LENGTH 25
+#endif /* defined(OMR_GC_COMPRESSED_POINTERS) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCLAZY_SWEEP "-Xgc:lazySweep"
+#define OMR_XGCLAZY_SWEEP_LENGTH 14
+#define OMR_XGCCONCURRENT_SWEEP "-Xgc:concurrentSweep"
+#define OMR_XGCCONCURRENT_SWEEP_LENGTH 20
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -272,7 +292,40 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
-#if defined(OMR_GC_MORDON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCASYNCHRONOUS_LOGGING, OMR_XGCASYNCHRONOUS_LOGGING_LENGTH)) {
+		extensions->asynchronousLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSE_BINARY_FORMAT, OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH)) {
+		extensions->verboseBinaryFormat = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCBACKGROUND_DECOMMIT, OMR_XGCBACKGROUND_DECOMMIT_LENGTH)) {
+		extensions->backgroundDecommit = true;
+	}
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_BACKGROUND_MARK, OMR_XGCCONCURRENT_BACKGROUND_MARK_LENGTH)) {
+		extensions->concurrentBackgroundMark = true;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_COMPRESSED_POINTERS)
+	else if (0 == strncmp(option, OMR_XGCCOMPRESSED_REFS_SHIFT, OMR_XGCCOMPRESSED_REFS_SHIFT_LENGTH)) {
+		uintptr_t shift = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCOMPRESSED_REFS_SHIFT_LENGTH, &shift)) || (shift > LOW_MEMORY_HEAP_CEILING_SHIFT)) {
+			result = false;
+		} else {
+			extensions->shouldForceSpecifiedShiftingCompression = true;
+			extensions->forcedShiftingCompressionAmount = shift;
+		}
+	}
+#endif /* defined(OMR_GC_COMPRESSED_POINTERS) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCLAZY_SWEEP, OMR_XGCLAZY_SWEEP_LENGTH)) {
+		extensions->segregatedLazySweep = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCCONCURRENT_SWEEP, OMR_XGCCONCURRENT_SWEEP_LENGTH)) {
+		extensions->segregatedConcurrentSweep = true;
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
 		if (0 == strncmp(gcpolicy, OMR_GCPOLICY_GENCON, OMR_GCPOLICY_GENCON_LENGTH)) {
@@ -282,7 +335,7 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			result = false;
 		}
 	}
-#endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
@@ -21,6 +21,7 @@
 #include "modronopt.h"
 
 #include "EnvironmentBase.hpp"
+#include "ModronAssertions.h"
 #include "SweepPoolManager.hpp"
 
 /**
@@ -48,3 +49,25 @@ MM_SweepPoolManager::initialize(MM_EnvironmentBase *env)
 	return true;
 }
 
+bool
+MM_SweepPoolManager::canConnectSublists()
+{
+	return false;
+}
+
+void
+MM_SweepPoolManager::connectChunkToSublist(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolSublistState *sublist)
+{
+	Assert_MM_unreachable();
+}
+
+void
+MM_SweepPoolManager::spliceSublist(MM_EnvironmentBase *env, MM_SweepPoolSublistState *sublist)
+{
+	Assert_MM_unreachable();
+}
+
+void
+MM_SweepPoolManager::sublistChunkPostProcess(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolSublistState *sublist)
+{
+}
@@ -36,6 +36,7 @@ class MM_GCExtensionsBase;
 class MM_MemoryPool;
 class MM_ParallelSweepChunk;
 class MM_SweepPoolState;
+class MM_SweepPoolSublistState;
 
 /*
  * 	 superclass MM_SweepPoolManager
@@ -79,6 +80,33 @@ public:
 	 */
 	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk) = 0;
 
+	/**
+	 * @return true if the receiver implements connectChunkToSublist() and spliceSublist(), so that the chunks
+	 * of its pools may be connected by several threads at once
+	 */
+	virtual bool canConnectSublists();
+
+	/**
+	 * Connect a chunk into the free list fragment (sublist) built for one segment of a parallel connect.
+	 * Same as connectChunk(), but the connect state is the sublist's rather than the pool's, and
+	 * nothing that is shared between threads is updated.
+	 * @note all chunks of the pool preceding the chunk within the segment must have been connected to the same sublist
+	 */
+	virtual void connectChunkToSublist(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolSublistState *sublist);
+
+	/**
+	 * Append a sublist built by connectChunkToSublist() to the free list of its pool.
+	 * Sublists of a pool must be spliced in address order, after initializing the pool sweep state.
+	 * @note single threaded routine
+	 */
+	virtual void spliceSublist(MM_EnvironmentBase *env, MM_SweepPoolSublistState *sublist);
+
+	/**
+	 * Fix up chunk data recorded by connectChunkToSublist() that depends on the connect state
+	 * preceding the sublist, once the sublist has been spliced.
+	 */
+	virtual void sublistChunkPostProcess(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolSublistState *sublist);
+
 	/**
 	 * 	Add free memory slot to pool list
 	 * 
@@ -30,6 +30,7 @@
 #include "MemoryPool.hpp"
 #include "ParallelSweepChunk.hpp"
 #include "SweepPoolState.hpp"
+#include "SweepPoolSublistState.hpp"
 #include "MarkMap.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
 #include "SweepPoolManagerAddressOrderedListBase.hpp"
@@ -92,6 +93,49 @@ MM_SweepPoolManagerAddressOrderedListBase::calculateTrailingDetails(
 	}
 }
 
+/**
+ * Link a free entry following the last entry connected so far.
+ * Without a sublist the entry goes to the pool free list. Within a sublist the first entry becomes
+ * the sublist head, which is linked to the pool free list when the sublist is spliced.
+ */
+MMINLINE void
+MM_SweepPoolManagerAddressOrderedListBase::connectOuterMemory(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedListBase *memoryPool, MM_SweepPoolSublistState *sublist, void *previousFreeEntry, uintptr_t previousFreeEntrySize, void *nextFreeEntry)
+{
+	if (NULL == sublist) {
+		memoryPool->connectOuterMemoryToPool(env, previousFreeEntry, previousFreeEntrySize, nextFreeEntry);
+	} else if (NULL == previousFreeEntry) {
+		sublist->_sublistHead = (MM_HeapLinkedFreeHeader *)nextFreeEntry;
+	} else {
+		memoryPool->connectOuterMemoryToSublist(env, previousFreeEntry, previousFreeEntrySize, nextFreeEntry);
+	}
+}
+
+/**
+ * Count a free entry in the size class stats of the pool, or in the thread local stats when connecting a sublist.
+ */
+MMINLINE void
+MM_SweepPoolManagerAddressOrderedListBase::incrementFreeEntrySizeClassStats(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedListBase *memoryPool, MM_SweepPoolSublistState *sublist, uintptr_t freeEntrySize)
+{
+	if (NULL == sublist) {
+		memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(freeEntrySize);
+	} else {
+		memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(freeEntrySize, &env->_freeEntrySizeClassStats);
+	}
+}
+
+/**
+ * Uncount a free entry in the size class stats of the pool, or in the thread local stats when connecting a sublist.
+ */
+MMINLINE void
+MM_SweepPoolManagerAddressOrderedListBase::decrementFreeEntrySizeClassStats(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedListBase *memoryPool, MM_SweepPoolSublistState *sublist, uintptr_t freeEntrySize)
+{
+	if (NULL == sublist) {
+		memoryPool->getLargeObjectAllocateStats()->decrementFreeEntrySizeClassStats(freeEntrySize);
+	} else {
+		memoryPool->getLargeObjectAllocateStats()->decrementFreeEntrySizeClassStats(freeEntrySize, &env->_freeEntrySizeClassStats, 1);
+	}
+}
+
 /**
  * Connect a chunk into the free list.
  * Given a previously swept chunk, connect its data to the free list of the associated memory subspace.
@@ -103,6 +147,28 @@ MM_SweepPoolManagerAddressOrderedListBase::calculateTrailingDetails(
  */
 void
 MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk)
+{
+	connectChunk(env, chunk, getPoolState(chunk->memoryPool), NULL);
+}
+
+/**
+ * Connect a chunk into the free list fragment of one segment of a parallel connect.
+ * @see MM_SweepPoolManager::connectChunkToSublist()
+ */
+void
+MM_SweepPoolManagerAddressOrderedListBase::connectChunkToSublist(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolSublistState *sublist)
+{
+	Assert_MM_true(sublist->_memoryPool == chunk->memoryPool);
+	connectChunk(env, chunk, sublist, sublist);
+}
+
+/**
+ * Connect a chunk using the given connect state.
+ * @param sweepState the pool sweep state, or the sublist when connecting a segment of a parallel connect
+ * @param sublist the sublist being built, NULL when connecting directly to the pool free list
+ */
+void
+MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolState *sweepState, MM_SweepPoolSublistState *sublist)
 {
 #if defined(J9MODRON_SWEEP_SCHEME_CONNECT_CHUNKS_TRACE)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
@@ -113,7 +179,6 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 	 *  Memory Pool and Memory Pool State
 	 */
 	MM_MemoryPoolAddressOrderedListBase *memoryPool = (MM_MemoryPoolAddressOrderedListBase *)chunk->memoryPool;
-	MM_SweepPoolState *sweepState = getPoolState(memoryPool);
 
 	MM_HeapLinkedFreeHeader *previousFreeEntry = sweepState->_connectPreviousFreeEntry;
 	uintptr_t previousFreeEntrySize = sweepState->_connectPreviousFreeEntrySize;
@@ -155,18 +220,18 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 		&& chunk->_coalesceCandidate
 	) {
 		/* So should be using same MM_SweepPoolState */
-		Assert_MM_true(getPoolState(previousConnectChunk->memoryPool) == sweepState);
+		Assert_MM_true((NULL != sublist) || (getPoolState(previousConnectChunk->memoryPool) == sweepState));
 
 		/* The previous free entry consumes the leading free entry */
 		/* This trumps any checks on the trailing free space of the previous chunk */
 #if defined(J9MODRON_SWEEP_SCHEME_CONNECT_CHUNKS_TRACE)
 		omrtty_printf("CC: Previous consumes leading: %p(+%p) -> %p(+%p)\n", previousFreeEntry, previousFreeEntrySize, leadingFreeEntry, leadingFreeEntrySize);
 #endif
-		memoryPool->getLargeObjectAllocateStats()->decrementFreeEntrySizeClassStats(previousFreeEntrySize);
+		decrementFreeEntrySizeClassStats(env, memoryPool, sublist, previousFreeEntrySize);
 		previousFreeEntrySize += leadingFreeEntrySize;
 		sweepState->_sweepFreeBytes += leadingFreeEntrySize;
  		sweepState->updateLargestFreeEntry(previousFreeEntrySize, previousPreviousFreeEntry);
-		memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(previousFreeEntrySize);
+		incrementFreeEntrySizeClassStats(env, memoryPool, sublist, previousFreeEntrySize);
 
 		/* Consume the leading entry */
 		leadingFreeEntry = NULL;
@@ -192,7 +257,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 				omrtty_printf("CC: trailing/leading merged %p(+%p) + %p(+%p)\n", previousConnectChunk->trailingFreeCandidate, previousConnectChunk->trailingFreeCandidateSize, leadingFreeEntry, leadingFreeEntrySize);
 #endif
 
-				memoryPool->connectOuterMemoryToPool(env,
+				connectOuterMemory(env, memoryPool, sublist,
 						previousFreeEntry,
 						previousFreeEntrySize,
 						previousConnectChunk->trailingFreeCandidate);
@@ -209,7 +274,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 					sweepState->_sweepFreeHoles += 1;
 			 		sweepState->updateLargestFreeEntry(jointFreeSize, previousPreviousFreeEntry);
 
-					memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(jointFreeSize);
+					incrementFreeEntrySizeClassStats(env, memoryPool, sublist, jointFreeSize);
 				}
 			}
 
@@ -225,7 +290,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 				omrtty_printf("CC: trailing from previous used %p(+%p)\n", previousConnectChunk->trailingFreeCandidate, previousConnectChunk->trailingFreeCandidateSize);
 #endif
 
-				memoryPool->connectOuterMemoryToPool(env,
+				connectOuterMemory(env, memoryPool, sublist,
 						previousFreeEntry,
 						previousFreeEntrySize,
 						previousConnectChunk->trailingFreeCandidate);
@@ -242,7 +307,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 					sweepState->_sweepFreeHoles += 1;
 			 		sweepState->updateLargestFreeEntry(previousConnectChunk->trailingFreeCandidateSize, previousPreviousFreeEntry);
 
-					memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(previousConnectChunk->trailingFreeCandidateSize);
+					incrementFreeEntrySizeClassStats(env, memoryPool, sublist, previousConnectChunk->trailingFreeCandidateSize);
 				}
 			}
 		}
@@ -268,7 +333,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 
 				Assert_MM_true(previousFreeEntry <= leadingFreeEntry);
 
-				memoryPool->connectOuterMemoryToPool(env,
+				connectOuterMemory(env, memoryPool, sublist,
 						previousFreeEntry,
 						previousFreeEntrySize,
 						leadingFreeEntry);
@@ -285,7 +350,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 					sweepState->_sweepFreeHoles += 1;
 			 		sweepState->updateLargestFreeEntry(leadingFreeEntrySize, previousPreviousFreeEntry);
 
-					memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(leadingFreeEntrySize);
+					incrementFreeEntrySizeClassStats(env, memoryPool, sublist, leadingFreeEntrySize);
 				}
 			} else {
 				/* Abandon it. We need to do this in case we encounter a free entry which
@@ -305,7 +370,7 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 	if(chunk->freeListHead) {
 		Assert_MM_true(previousFreeEntry < chunk->freeListHead);
 
-		memoryPool->connectOuterMemoryToPool(env,
+		connectOuterMemory(env, memoryPool, sublist,
 				previousFreeEntry,
 				previousFreeEntrySize,
 				chunk->freeListHead);
@@ -342,11 +407,93 @@ MM_SweepPoolManagerAddressOrderedListBase::connectChunk(MM_EnvironmentBase *env,
 	sweepState->_connectPreviousFreeEntrySize = previousFreeEntrySize;
 	sweepState->_connectPreviousChunk = chunk;
 
-	memoryPool->incrementDarkMatterBytes(chunk->_darkMatterBytes);
-	memoryPool->incrementDarkMatterSamples(chunk->_darkMatterSamples);
+	if (NULL == sublist) {
+		memoryPool->incrementDarkMatterBytes(chunk->_darkMatterBytes);
+		memoryPool->incrementDarkMatterSamples(chunk->_darkMatterSamples);
+	} else {
+		sublist->_darkMatterBytes += chunk->_darkMatterBytes;
+		sublist->_darkMatterSamples += chunk->_darkMatterSamples;
+	}
 }
 
 
+/**
+ * Append a sublist to the free list of its pool.
+ * @see MM_SweepPoolManager::spliceSublist()
+ */
+void
+MM_SweepPoolManagerAddressOrderedListBase::spliceSublist(MM_EnvironmentBase *env, MM_SweepPoolSublistState *sublist)
+{
+	MM_MemoryPoolAddressOrderedListBase *memoryPool = (MM_MemoryPoolAddressOrderedListBase *)sublist->_memoryPool;
+	MM_SweepPoolState *sweepState = getPoolState(memoryPool);
+	MM_ParallelSweepChunk *previousConnectChunk = sweepState->_connectPreviousChunk;
+
+	if (NULL != sublist->_seedChunk) {
+		/* The sublist has already dealt with the trailing free space of the last chunk connected to the pool */
+		Assert_MM_true(sublist->_seedChunk == previousConnectChunk);
+	} else if (NULL != previousConnectChunk) {
+		/* The sublist starts after a chunk of another pool, so the trailing free space of the last chunk connected
+		 * to the pool has no connecting partner - connect it as connectChunk() would have done for the first chunk
+		 * of the sublist (no split candidate is recorded for it).
+		 */
+		if (memoryPool->canMemoryBeConnectedToPool(env, previousConnectChunk->trailingFreeCandidate, previousConnectChunk->trailingFreeCandidateSize)) {
+			memoryPool->connectOuterMemoryToPool(env,
+					sweepState->_connectPreviousFreeEntry,
+					sweepState->_connectPreviousFreeEntrySize,
+					previousConnectChunk->trailingFreeCandidate);
+
+			sweepState->_connectPreviousPreviousFreeEntry = sweepState->_connectPreviousFreeEntry;
+			sweepState->_connectPreviousFreeEntry = (MM_HeapLinkedFreeHeader *)previousConnectChunk->trailingFreeCandidate;
+			sweepState->_connectPreviousFreeEntrySize = previousConnectChunk->trailingFreeCandidateSize;
+
+			if (0 != previousConnectChunk->trailingFreeCandidateSize) {
+				sweepState->_sweepFreeBytes += previousConnectChunk->trailingFreeCandidateSize;
+				sweepState->_sweepFreeHoles += 1;
+				sweepState->updateLargestFreeEntry(previousConnectChunk->trailingFreeCandidateSize, sweepState->_connectPreviousPreviousFreeEntry);
+
+				memoryPool->getLargeObjectAllocateStats()->incrementFreeEntrySizeClassStats(previousConnectChunk->trailingFreeCandidateSize);
+			}
+		}
+	}
+
+	/* Remember what preceded the sublist, for sublistChunkPostProcess() */
+	sublist->_splicePreviousFreeEntry = sweepState->_connectPreviousFreeEntry;
+	sublist->_spliceFreeBytes = sweepState->_sweepFreeBytes;
+	sublist->_spliceFreeHoles = sweepState->_sweepFreeHoles;
+
+	/* Within the sublist a NULL previous entry stands for the last entry connected to the pool before it */
+	if (NULL != sublist->_sublistHead) {
+		memoryPool->connectOuterMemoryToPool(env,
+				sweepState->_connectPreviousFreeEntry,
+				sweepState->_connectPreviousFreeEntrySize,
+				sublist->_sublistHead);
+
+		if (sublist->_largestFreeEntry > sweepState->_largestFreeEntry) {
+			sweepState->_largestFreeEntry = sublist->_largestFreeEntry;
+			if (NULL == sublist->_previousLargestFreeEntry) {
+				sweepState->_previousLargestFreeEntry = sweepState->_connectPreviousFreeEntry;
+			} else {
+				sweepState->_previousLargestFreeEntry = sublist->_previousLargestFreeEntry;
+			}
+		}
+
+		if (NULL == sublist->_connectPreviousPreviousFreeEntry) {
+			sweepState->_connectPreviousPreviousFreeEntry = sweepState->_connectPreviousFreeEntry;
+		} else {
+			sweepState->_connectPreviousPreviousFreeEntry = sublist->_connectPreviousPreviousFreeEntry;
+		}
+		sweepState->_connectPreviousFreeEntry = sublist->_connectPreviousFreeEntry;
+		sweepState->_connectPreviousFreeEntrySize = sublist->_connectPreviousFreeEntrySize;
+	}
+
+	sweepState->_sweepFreeBytes += sublist->_sweepFreeBytes;
+	sweepState->_sweepFreeHoles += sublist->_sweepFreeHoles;
+	sweepState->_connectPreviousChunk = sublist->_connectPreviousChunk;
+
+	memoryPool->incrementDarkMatterBytes(sublist->_darkMatterBytes);
+	memoryPool->incrementDarkMatterSamples(sublist->_darkMatterSamples);
+}
+
 /**
  * Flush any unaccounted for free entries to the free list.
  */
@@ -38,11 +38,17 @@
 class MM_AllocateDescription;
 class MM_EnvironmentBase;
 class MM_MemoryPool;
+class MM_MemoryPoolAddressOrderedListBase;
 class MM_HeapLinkedFreeHeader;
+class MM_SweepPoolSublistState;
 
 class MM_SweepPoolManagerAddressOrderedListBase : public MM_SweepPoolManager
 {
 private:
+	void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolState *sweepState, MM_SweepPoolSublistState *sublist);
+	MMINLINE void connectOuterMemory(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedListBase *memoryPool, MM_SweepPoolSublistState *sublist, void *previousFreeEntry, uintptr_t previousFreeEntrySize, void *nextFreeEntry);
+	MMINLINE void incrementFreeEntrySizeClassStats(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedListBase *memoryPool, MM_SweepPoolSublistState *sublist, uintptr_t freeEntrySize);
+	MMINLINE void decrementFreeEntrySizeClassStats(MM_EnvironmentBase *env, MM_MemoryPoolAddressOrderedListBase *memoryPool, MM_SweepPoolSublistState *sublist, uintptr_t freeEntrySize);
 
 protected:
 
@@ -68,6 +74,9 @@ public:
 	virtual void connectFinalChunk(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool);
 	virtual void poolPostProcess(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool){}
 	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
+	virtual bool canConnectSublists() { return true; }
+	virtual void connectChunkToSublist(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolSublistState *sublist);
+	virtual void spliceSublist(MM_EnvironmentBase *env, MM_SweepPoolSublistState *sublist);
 	virtual bool addFreeMemory(MM_EnvironmentBase *env, MM_ParallelSweepChunk *sweepChunk, uintptr_t *heapSlotFreeHead, uintptr_t heapSlotFreeCount);
 	virtual void updateTrailingFreeMemory(MM_EnvironmentBase *env, MM_ParallelSweepChunk *sweepChunk, uintptr_t *heapSlotFreeHead, uintptr_t heapSlotFreeCount);
 	virtual MM_SweepPoolState *getPoolState(MM_MemoryPool *memoryPool);
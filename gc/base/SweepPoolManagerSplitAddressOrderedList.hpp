@@ -35,6 +35,7 @@
 #include "EnvironmentBase.hpp"
 #include "MemoryPool.hpp"
 #include "SweepPoolManagerAddressOrderedListBase.hpp"
+#include "SweepPoolSublistState.hpp"
 
 class MM_SweepPoolManagerSplitAddressOrderedList : public MM_SweepPoolManagerAddressOrderedListBase
 {
@@ -58,6 +59,21 @@ public:
 
 	virtual void poolPostProcess(MM_EnvironmentBase *envModron, MM_MemoryPool *memoryPool);
 
+	/**
+	 * The split candidate information of a chunk connected to a sublist accumulates from the start of the sublist
+	 * and refers to the sublist head as having no previous entry - rebase it on what preceded the sublist.
+	 */
+	virtual void sublistChunkPostProcess(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk, MM_SweepPoolSublistState *sublist)
+	{
+		if (NULL != chunk->_splitCandidate) {
+			chunk->_accumulatedFreeSize += sublist->_spliceFreeBytes;
+			chunk->_accumulatedFreeHoles += sublist->_spliceFreeHoles;
+			if (NULL == chunk->_splitCandidatePreviousEntry) {
+				chunk->_splitCandidatePreviousEntry = sublist->_splicePreviousFreeEntry;
+			}
+		}
+	}
+
 	/**
 	 * Create a SweepPoolManager object.
 	 */
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(SWEEPPOOLSUBLISTSTATE_HPP_)
+#define SWEEPPOOLSUBLISTSTATE_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include "SweepPoolState.hpp"
+
+/**
+ * Connect state of one memory pool within one segment of a parallel connect.
+ * The inherited connect fields describe the free list fragment (sublist) built for the segment, starting
+ * from an empty list rather than from the pool's free list. The sublist is linked into the pool's free list
+ * when the segments are spliced together in address order.
+ * @ingroup GC_Base
+ */
+class MM_SweepPoolSublistState : public MM_SweepPoolState
+{
+public:
+	MM_HeapLinkedFreeHeader *_sublistHead; /**< first free entry of the sublist, still to be linked to the pool's last entry */
+	MM_ParallelSweepChunk *_seedChunk; /**< chunk preceding the segment whose trailing free space the sublist has taken over, or NULL */
+	uintptr_t _darkMatterBytes; /**< dark matter of the connected chunks, added to the pool on splice */
+	uintptr_t _darkMatterSamples; /**< dark matter samples of the connected chunks, added to the pool on splice */
+	MM_HeapLinkedFreeHeader *_splicePreviousFreeEntry; /**< pool free entry the sublist head was linked to (NULL if it became the list head) */
+	uintptr_t _spliceFreeBytes; /**< free bytes connected in the pool before the sublist */
+	uintptr_t _spliceFreeHoles; /**< free entries connected in the pool before the sublist */
+
+	/**
+	 * Reset the receiver to an empty sublist of the given pool.
+	 * @param seedChunk chunk preceding the segment if it belongs to the same pool, NULL otherwise
+	 */
+	MMINLINE void
+	initializeForSegment(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, MM_ParallelSweepChunk *seedChunk)
+	{
+		_memoryPool = memoryPool;
+		initializeForSweep(env);
+		_connectPreviousChunk = seedChunk;
+		_sublistHead = NULL;
+		_seedChunk = seedChunk;
+		_darkMatterBytes = 0;
+		_darkMatterSamples = 0;
+		_splicePreviousFreeEntry = NULL;
+		_spliceFreeBytes = 0;
+		_spliceFreeHoles = 0;
+	}
+
+	/**
+	 * Create a SweepPoolSublistState object.
+	 */
+	MM_SweepPoolSublistState() :
+		MM_SweepPoolState(NULL),
+		_sublistHead(NULL),
+		_seedChunk(NULL),
+		_darkMatterBytes(0),
+		_darkMatterSamples(0),
+		_splicePreviousFreeEntry(NULL),
+		_spliceFreeBytes(0),
+		_spliceFreeHoles(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* SWEEPPOOLSUBLISTSTATE_HPP_ */
@@ -29,6 +29,7 @@
 
 #include "ModronAssertions.h"
 #include "objectdescription.h"
+#include "omrport.h"
 #include "omrutil.h"
 
 #include "AllocateDescription.hpp"
@@ -134,9 +135,65 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	if (extensions->tlhAdaptiveSizing) {
+		/* A thread which has not refreshed since the previous restart has mostly been holding on to
+		 * nursery it did not use, so let its rate decay.
+		 */
+		if (0 == _lastRefreshTime) {
+			_allocationRate /= 2;
+		}
+		/* The collection is not allocation time: the first refresh of the cycle does not take a sample */
+		_lastRefreshTime = 0;
+		_tlh->refreshSize = (0 == _allocationRate) ? extensions->tlhInitialSize : getAdaptiveRefreshSize(extensions);
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
 };
 
+/**
+ * Sample the allocation rate of the thread at a refresh and size the refresh from it (adaptive TLH sizing).
+ * The sample is the amount allocated from the current TLH over the time since the previous refresh,
+ * and is averaged into the thread's rate with a weight of one half, so a hot thread reaches its size
+ * within a few refreshes and a thread which goes idle gives nursery back as quickly.
+ */
+void
+MM_TLHAllocationSupport::updateAllocationRate(MM_EnvironmentBase *env, MM_AllocationStats *stats)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t now = omrtime_hires_clock();
+
+	if (0 != _lastRefreshTime) {
+		uint64_t consumedBytes = 0;
+		if (NULL != getBase()) {
+			consumedBytes = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+		}
+		uint64_t elapsedMicros = OMR_MAX(omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS), 1);
+		uint64_t sampleRate = (consumedBytes * 1000) / elapsedMicros;
+		uint64_t rate = ((uint64_t)_allocationRate + sampleRate) / 2;
+		_allocationRate = (uintptr_t)OMR_MIN(rate, (uint64_t)UDATA_MAX);
+
+		setRefreshSize(getAdaptiveRefreshSize(env->getExtensions()));
+		if (_allocationRate > stats->_tlhMaxAllocationRate) {
+			stats->_tlhMaxAllocationRate = _allocationRate;
+		}
+	}
+
+	_lastRefreshTime = now;
+}
+
+/**
+ * @return the refresh size which lasts the thread tlhAdaptiveRefreshInterval at its allocation rate,
+ * bounded by tlhMinimumSize and tlhAdaptiveMaximumSize
+ */
+uintptr_t
+MM_TLHAllocationSupport::getAdaptiveRefreshSize(MM_GCExtensionsBase *extensions)
+{
+	uint64_t size = ((uint64_t)_allocationRate * extensions->tlhAdaptiveRefreshInterval) / 1000;
+	size = OMR_MIN(size, (uint64_t)extensions->tlhAdaptiveMaximumSize);
+	size = OMR_MAX(size, (uint64_t)extensions->tlhMinimumSize);
+	return MM_Math::roundToCeiling(sizeof(uintptr_t), (uintptr_t)size);
+}
+
 /**
  * Refresh the TLH.
  */
@@ -155,7 +212,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
 		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		if (!extensions->tlhAdaptiveSizing && getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -163,6 +220,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
+	if (extensions->tlhAdaptiveSizing) {
+		updateAllocationRate(env, stats);
+	}
+
 	stats->_tlhDiscardedBytes += getSize();
 
 	/* Try to cache the current TLH */
@@ -265,7 +326,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
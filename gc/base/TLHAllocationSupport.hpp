@@ -39,6 +39,7 @@
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
 class MM_AllocateDescription;
+class MM_AllocationStats;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_ObjectAllocationInterface;
@@ -79,6 +80,9 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	uint64_t _lastRefreshTime; /**< hires time of the last refresh, or 0 if the TLH has not been refreshed since the last restart (adaptive TLH sizing) */
+	uintptr_t _allocationRate; /**< smoothed allocation rate of the thread, in bytes per millisecond (adaptive TLH sizing) */
+
 public:
 protected:
 private:
@@ -133,6 +137,8 @@ private:
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void restart(MM_EnvironmentBase *env);
 	bool refresh(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
+	void updateAllocationRate(MM_EnvironmentBase *env, MM_AllocationStats *stats);
+	uintptr_t getAdaptiveRefreshSize(MM_GCExtensionsBase *extensions);
 
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
 
@@ -181,7 +187,9 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_lastRefreshTime(0),
+		_allocationRate(0)
 	{};
 
 	/*
@@ -72,6 +72,12 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) { assume0(1 == threadCount); }
 	MMINLINE virtual uintptr_t getThreadCount() { return 1; }
 
+	/**
+	 * Number of threads the task expects to keep busy, used by the dispatcher under adaptive GC threading.
+	 * @return the recommended thread count, or UDATA_MAX if the task has no estimate of its work
+	 */
+	virtual uintptr_t getRecommendedWorkingThreads() { return UDATA_MAX; }
+
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
 	{
 		/* in a Task we don't need a mutex */
@@ -22,6 +22,7 @@
 #include "omrport.h"
 #include "omr.h"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
@@ -194,6 +195,10 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 
 	if (0 < commitSize) {
 		success = omrvmem_commit_memory(commitBase, commitSize, &_identifier) != 0;
+		/* the port library clears the mode if the OS refused the advice */
+		if (success && (0 != (_identifier.mode & OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES))) {
+			MM_AtomicOperations::add(&_extensions->transparentHugePageCommittedBytes, commitSize);
+		}
 	}
 
 	if (success) {
@@ -252,6 +257,21 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	return result;
 }
 
+bool
+MM_VirtualMemory::remapMemory(void* source, void* target, uintptr_t size)
+{
+	Assert_MM_true(0 != _pageSize);
+	Assert_MM_true(0 == ((uintptr_t)source % _pageSize));
+	Assert_MM_true(0 == ((uintptr_t)target % _pageSize));
+	Assert_MM_true(0 == (size % _pageSize));
+
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	intptr_t rc = omrvmem_remap_memory(source, target, size, &_identifier);
+	/* The objects did move, but the heap is left with a hole where the source was, which can not be recovered from */
+	Assert_MM_true(OMRPORT_ERROR_VMEM_REMAP_SOURCE_UNMAPPED != rc);
+	return 0 == rc;
+}
+
 void
 MM_VirtualMemory::tearDown(MM_EnvironmentBase* env)
 {
@@ -102,6 +102,18 @@ protected:
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
 	void roundDownTop(uintptr_t rounding);
 
+	/**
+	 * Move the pages backing a committed range to another committed range of the receiver without copying them.
+	 * The source range is left committed and zeroed.
+	 *
+	 * @param[in] source - the start of the range to move, must be aligned to the physical page size
+	 * @param[in] target - the start of the range to move to, must be aligned to the physical page size
+	 * @param size - the size of the range, must be aligned to the physical page size
+	 *
+	 * @return true on success, false if the pages could not be moved (the memory is then unchanged)
+	 */
+	virtual bool remapMemory(void* source, void* target, uintptr_t size);
+
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
 	 * 
@@ -107,10 +107,10 @@ public:
 	void reuseDeferredPackets(MM_EnvironmentBase *env);
 
 	static uintptr_t getSlotsInPacket() { return _slotsInPacket; }
-	MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
+	virtual MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
 	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
-	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	virtual void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
@@ -119,7 +119,7 @@ public:
 	/**
 	 * Returns TRUE if an input packet is available, FALSE otherwise.
 	 */
-	bool inputPacketAvailable(MM_EnvironmentBase *env);
+	virtual bool inputPacketAvailable(MM_EnvironmentBase *env);
 	
 	/**
 	 * Returns TRUE if all packets are empty, FALSE otherwise.
@@ -184,7 +184,7 @@ public:
 	 */
 	void clearOverflowFlag();
 
-	void resetAllPackets(MM_EnvironmentBase *env);
+	virtual void resetAllPackets(MM_EnvironmentBase *env);
 	
 	void overflowItem(MM_EnvironmentBase *env, void *item, MM_OverflowType type);
 
@@ -196,6 +196,8 @@ MM_AllocationContextSegregated::tryAllocateRegionFromSmallSizeClass(MM_Environme
 	MM_HeapRegionDescriptorSegregated *region = _regionPool->allocateRegionFromSmallSizeClass(env, sizeClass);
 	bool result = false;
 	if (region != NULL) {
+		/* Allocating from the stale free cells of an unswept region would overwrite live objects */
+		Assert_MM_true(!region->isUnswept());
 		_smallRegions[sizeClass] = region;
 		/* cache the small full region in AC */
 		_perContextSmallFullRegions[sizeClass]->enqueue(region);
@@ -263,21 +265,26 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase *env, uintpt
 	/* BEN TODO 1429: The object allocation interface base class should define all API used by this method such that casting would be unnecessary. */
 	MM_SegregatedAllocationInterface* segregatedAllocationInterface = (MM_SegregatedAllocationInterface*)env->_objectAllocationInterface;
 	uintptr_t replenishSize = segregatedAllocationInterface->getReplenishSize(env, sizeInBytesRequired);
-	uintptr_t preAllocatedBytes = 0;
+	uintptr_t* cellLists[MM_SegregatedAllocationInterface::REPLENISH_CELL_LISTS];
+	uintptr_t cellListBytes[MM_SegregatedAllocationInterface::REPLENISH_CELL_LISTS];
 
 	while (!done) {
 
-		/* If we have a region, attempt to replenish the ACL's cache */
+		/* If we have a region, attempt to replenish the ACL's cache, taking several cell lists at once
+		 * when the free cells of the region are fragmented so that the thread comes back less often
+		 */
 		MM_HeapRegionDescriptorSegregated *region = _smallRegions[sizeClass];
 		if (NULL != region) {
 			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
-			uintptr_t* cellList = memoryPoolACL->preAllocateCells(env, sizeClasses->getCellSize(sizeClass), replenishSize, &preAllocatedBytes);
-			if (NULL != cellList) {
-				Assert_MM_true(preAllocatedBytes > 0);
-				if (shouldPreMarkSmallCells(env)) {
-					_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
+			uintptr_t cellListCount = memoryPoolACL->preAllocateCellLists(env, sizeClasses->getCellSize(sizeClass), replenishSize, cellLists, cellListBytes, MM_SegregatedAllocationInterface::REPLENISH_CELL_LISTS);
+			if (0 != cellListCount) {
+				for (uintptr_t i = 0; i < cellListCount; i++) {
+					Assert_MM_true(cellListBytes[i] > 0);
+					if (shouldPreMarkSmallCells(env)) {
+						_markingScheme->preMarkSmallCells(env, region, cellLists[i], cellListBytes[i]);
+					}
 				}
-				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList, preAllocatedBytes);
+				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellLists, cellListBytes, cellListCount);
 				result = (uintptr_t *) segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
 				done = true;
 			}
@@ -36,6 +36,12 @@ class MM_HeapRegionDescriptorSegregated : public MM_HeapRegionDescriptor
 	 * Data members
 	 */
 public:
+	enum SweepState {
+		SWEEP_STATE_SWEPT = 0, /**< the free cells of the region are up to date */
+		SWEEP_STATE_UNSWEPT, /**< the region was left unswept by the last collection (see segregatedLazySweep) */
+		SWEEP_STATE_SWEEPING /**< the region is being swept, by the collector, an allocating thread or the background sweeper */
+	};
+
 protected:
 	uintptr_t **_arrayletBackPointers;
 
@@ -47,6 +53,7 @@ private:
 	MM_HeapRegionManager *_regionManager;
 	OMR_SizeClasses *_segregatedSizeClasses;
 	uintptr_t _nextArrayletIndex; /**< next arraylet to use for allocation */
+	volatile SweepState _sweepState; /**< whether the mark map or the free cells of the region describe its live objects */
 	
 	/*
 	 * Function members
@@ -61,6 +68,7 @@ public:
 		,_regionManager(NULL)
 		,_segregatedSizeClasses(env->getOmrVM()->_sizeClasses)
 		,_nextArrayletIndex(0)
+		,_sweepState(SWEEP_STATE_SWEPT)
 	{
 		_arrayletBackPointers = ((uintptr_t **)(this + 1));
 		_typeId = __FUNCTION__;
@@ -100,6 +108,14 @@ public:
 	bool isFree() { return getRegionType() == FREE; }
 	bool isCanonical() { return isReserved() || isSmall() || getRangeCount() >= 1; }
 
+	MMINLINE SweepState getSweepState() { return _sweepState; }
+	MMINLINE void setSweepState(SweepState sweepState) { _sweepState = sweepState; }
+	/**
+	 * A region is unswept until its sweep has completed. Until then its free cells are stale, and
+	 * the mark map tells which of its cells hold live objects.
+	 */
+	MMINLINE bool isUnswept() { return SWEEP_STATE_SWEPT != _sweepState; }
+
 	void setRange(RegionType type, uintptr_t range);
 	uintptr_t getRange() { return getRangeCount(); };
 	MM_HeapRegionDescriptorSegregated *splitRange(uintptr_t numRegionsToSplit);
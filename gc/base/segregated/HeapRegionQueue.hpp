@@ -70,6 +70,22 @@ public:
 
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count) = 0;
 
+	/**
+	 * Remove up to maxCount regions from the receiver and return them as a chain linked through
+	 * their next and prev pointers, the front region having no prev and the back region no next.
+	 * Used to move regions between queues of different implementations.
+	 * @param front where the first detached region is written to (NULL if none)
+	 * @param back where the last detached region is written to (NULL if none)
+	 * @param maxCount maximum number of regions to detach, UDATA_MAX for all of them
+	 * @return the number of regions detached
+	 */
+	virtual uintptr_t detach(MM_HeapRegionDescriptorSegregated **front, MM_HeapRegionDescriptorSegregated **back, uintptr_t maxCount) = 0;
+
+	/**
+	 * Add a chain of regions, as returned by detach(), to the receiver.
+	 */
+	virtual void enqueue(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count) = 0;
+
 	virtual uintptr_t debugCountFreeBytesInRegions() = 0;
 
 	/* Virtual methods inherited from RegionList */
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrport.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_LockFreeHeapRegionQueue *
+MM_LockFreeHeapRegionQueue::newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool trackFreeBytes)
+{
+	MM_LockFreeHeapRegionQueue *regionList = (MM_LockFreeHeapRegionQueue *)env->getForge()->allocate(sizeof(MM_LockFreeHeapRegionQueue), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (regionList) {
+		new (regionList) MM_LockFreeHeapRegionQueue(regionListKind, trackFreeBytes);
+		if (!regionList->initialize(env)) {
+			regionList->kill(env);
+			return NULL;
+		}
+	}
+	return regionList;
+}
+
+void
+MM_LockFreeHeapRegionQueue::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LockFreeHeapRegionQueue::initialize(MM_EnvironmentBase *env)
+{
+	_heapRegionManager = env->getExtensions()->heapRegionManager;
+	return NULL != _heapRegionManager;
+}
+
+void
+MM_LockFreeHeapRegionQueue::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+/**
+ * Push a chain of regions linked through their next pointers.
+ * The length is bumped before the regions become visible, so that it never underflows in pop().
+ */
+void
+MM_LockFreeHeapRegionQueue::push(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count)
+{
+	MM_AtomicOperations::add(&_length, count);
+
+	uint64_t oldTop = 0;
+	do {
+		oldTop = MM_AtomicOperations::getU64(&_top);
+		back->setNext(regionForTop(oldTop));
+	} while (oldTop != MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, nextTop(oldTop, front)));
+}
+
+/**
+ * Pop the top region.
+ * @return the region, unlinked, or NULL if the queue was empty
+ */
+MM_HeapRegionDescriptorSegregated *
+MM_LockFreeHeapRegionQueue::pop()
+{
+	uint64_t oldTop = 0;
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	do {
+		oldTop = MM_AtomicOperations::getU64(&_top);
+		region = regionForTop(oldTop);
+		if (NULL == region) {
+			return NULL;
+		}
+		/* region may be taken and re-queued by another thread right now; the tag makes the exchange fail if so */
+	} while (oldTop != MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, nextTop(oldTop, region->getNext())));
+
+	MM_AtomicOperations::subtract(&_length, 1);
+	region->setNext(NULL);
+	region->setPrev(NULL);
+	return region;
+}
+
+void
+MM_LockFreeHeapRegionQueue::enqueue(MM_HeapRegionQueue *src)
+{
+	if (src->isEmpty()) {
+		return;
+	}
+	MM_HeapRegionDescriptorSegregated *front = NULL;
+	MM_HeapRegionDescriptorSegregated *back = NULL;
+	uintptr_t srcLength = src->detach(&front, &back, UDATA_MAX);
+	if (0 != srcLength) {
+		push(front, back, srcLength);
+	}
+}
+
+void
+MM_LockFreeHeapRegionQueue::enqueue(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count)
+{
+	push(front, back, count);
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_LockFreeHeapRegionQueue::dequeue()
+{
+	return pop();
+}
+
+uintptr_t
+MM_LockFreeHeapRegionQueue::dequeue(MM_HeapRegionQueue *target, uintptr_t count)
+{
+	MM_HeapRegionDescriptorSegregated *front = NULL;
+	MM_HeapRegionDescriptorSegregated *back = NULL;
+	uintptr_t moved = detach(&front, &back, count);
+	if (0 != moved) {
+		target->enqueue(front, back, moved);
+	}
+	return moved;
+}
+
+/**
+ * Detach regions from the top of the stack. Taking everything is a single exchange of the top,
+ * a bounded count is taken one region at a time.
+ */
+uintptr_t
+MM_LockFreeHeapRegionQueue::detach(MM_HeapRegionDescriptorSegregated **front, MM_HeapRegionDescriptorSegregated **back, uintptr_t maxCount)
+{
+	uintptr_t detached = 0;
+	MM_HeapRegionDescriptorSegregated *first = NULL;
+	MM_HeapRegionDescriptorSegregated *last = NULL;
+
+	if (UDATA_MAX == maxCount) {
+		uint64_t oldTop = 0;
+		do {
+			oldTop = MM_AtomicOperations::getU64(&_top);
+			first = regionForTop(oldTop);
+		} while ((NULL != first) && (oldTop != MM_AtomicOperations::lockCompareExchangeU64(&_top, oldTop, nextTop(oldTop, NULL))));
+
+		/* the chain is now private: count it and rebuild the prev pointers */
+		MM_HeapRegionDescriptorSegregated *prev = NULL;
+		for (MM_HeapRegionDescriptorSegregated *cur = first; NULL != cur; cur = cur->getNext()) {
+			cur->setPrev(prev);
+			prev = cur;
+			detached += 1;
+		}
+		last = prev;
+		MM_AtomicOperations::subtract(&_length, detached);
+	} else {
+		while (detached < maxCount) {
+			MM_HeapRegionDescriptorSegregated *region = pop();
+			if (NULL == region) {
+				break;
+			}
+			if (NULL == first) {
+				first = region;
+			} else {
+				last->setNext(region);
+				region->setPrev(last);
+			}
+			last = region;
+			detached += 1;
+		}
+	}
+
+	*front = first;
+	*back = last;
+	return detached;
+}
+
+void
+MM_LockFreeHeapRegionQueue::showList(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t count = 0;
+	omrtty_printf("LockFreeHeapRegionQueue 0x%x: ", this);
+	for (MM_HeapRegionDescriptorSegregated *cur = peek(); cur != NULL; cur = cur->getNext()) {
+		omrtty_printf("  %d-%d-%d ", count, count, cur->getRange());
+		count += 1;
+	}
+	omrtty_printf("\n");
+}
+
+/**
+ * DEBUG method that iterates over all regions in the list and sums up the free bytes.
+ * @note Not safe against concurrent updates of the queue.
+ * @see MM_HeapRegionDescriptorSegregated::debugCountFreeBytes()
+ */
+uintptr_t
+MM_LockFreeHeapRegionQueue::debugCountFreeBytesInRegions()
+{
+	uintptr_t freeBytes = 0;
+	for (MM_HeapRegionDescriptorSegregated *cur = peek(); cur != NULL; cur = cur->getNext()) {
+		freeBytes += cur->debugCountFreeBytes();
+	}
+	return freeBytes;
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
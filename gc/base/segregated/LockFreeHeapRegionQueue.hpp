@@ -0,0 +1,124 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(LOCKFREEHEAPREGIONQUEUE_HPP_)
+#define LOCKFREEHEAPREGIONQUEUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "HeapRegionQueue.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * A region queue for single regions which is shared between threads without a lock.
+ * Regions are kept on a stack (so dequeue returns the most recently enqueued region) linked through
+ * their next pointers. The top of the stack is a 64 bit word holding the region table index of the
+ * top region (plus one, so that zero means empty) in its low half and a version tag in its high half.
+ * Every update increments the tag, so a compare and swap based on a stale read of the top fails even
+ * if the same region has been dequeued and enqueued again in the meantime. Region descriptors are never
+ * freed, so reading the next pointer of a region that has just been taken by another thread is harmless.
+ * The prev pointers of queued regions are not maintained; detach() rebuilds them for the regions it returns.
+ *
+ * Unlike the locking queue this is LIFO. No user depends on the order, since every caller takes whichever
+ * region of the right size class and state comes first. A lock-free FIFO keeps its most recently dequeued
+ * node as a dummy head, which cannot be done when the nodes are the regions being handed out, and a stack
+ * also hands out the region whose descriptor and cells were touched most recently.
+ */
+class MM_LockFreeHeapRegionQueue : public MM_HeapRegionQueue
+{
+/* Data members & types */
+public:
+protected:
+private:
+	volatile uint64_t _top; /**< (tag << 32) | (region table index of the top region + 1), 0 in the low half if empty */
+	MM_HeapRegionManager *_heapRegionManager; /**< maps regions to and from their region table index */
+
+/* Methods */
+public:
+	static MM_LockFreeHeapRegionQueue *newInstance(MM_EnvironmentBase *env, RegionListKind regionListKind, bool trackFreeBytes = false);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	MM_LockFreeHeapRegionQueue(RegionListKind regionListKind, bool trackFreeBytes) :
+		MM_HeapRegionQueue(regionListKind, true, trackFreeBytes),
+		_top(0),
+		_heapRegionManager(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+	virtual bool isEmpty() { return NULL == peek(); }
+
+	virtual uintptr_t getTotalRegions() { return length(); }
+
+	virtual void enqueue(MM_HeapRegionDescriptorSegregated *region)
+	{
+		push(region, region, 1);
+	}
+
+	virtual void enqueue(MM_HeapRegionQueue *src);
+
+	virtual MM_HeapRegionDescriptorSegregated *dequeue();
+
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count);
+
+	virtual uintptr_t detach(MM_HeapRegionDescriptorSegregated **front, MM_HeapRegionDescriptorSegregated **back, uintptr_t maxCount);
+	virtual void enqueue(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count);
+
+	virtual uintptr_t debugCountFreeBytesInRegions();
+	virtual void showList(MM_EnvironmentBase *env);
+
+protected:
+private:
+	MMINLINE MM_HeapRegionDescriptorSegregated *
+	regionForTop(uint64_t top)
+	{
+		uint32_t indexPlusOne = (uint32_t)top;
+		if (0 == indexPlusOne) {
+			return NULL;
+		}
+		return (MM_HeapRegionDescriptorSegregated *)_heapRegionManager->physicalTableDescriptorForIndex(indexPlusOne - 1);
+	}
+
+	MMINLINE uint64_t
+	nextTop(uint64_t oldTop, MM_HeapRegionDescriptorSegregated *region)
+	{
+		uint64_t indexPlusOne = 0;
+		if (NULL != region) {
+			indexPlusOne = _heapRegionManager->physicalTableDescriptorIndexForAddress(region->getLowAddress()) + 1;
+		}
+		return (((oldTop >> 32) + 1) << 32) | indexPlusOne;
+	}
+
+	MMINLINE MM_HeapRegionDescriptorSegregated *peek() { return regionForTop(MM_AtomicOperations::getU64(&_top)); }
+
+	void push(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count);
+	MM_HeapRegionDescriptorSegregated *pop();
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* LOCKFREEHEAPREGIONQUEUE_HPP_ */
@@ -67,23 +67,21 @@ public:
 	}
 	
 	virtual void
-	push(MM_HeapRegionQueue *srcAsPQ)
+	push(MM_HeapRegionQueue *src)
 	{ 
-		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
-		if (src->_head == NULL) { /* Nothing to move - single read needs no lock */
+		if (src->isEmpty()) { /* Nothing to move - single read needs no lock */
 			return;
 		}
-		lock();
-		src->lock();
 		
 		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = src->detach(&front, &back, UDATA_MAX);
+		if (0 == srcLength) {
+			return;
+		}
 		
+		lock();
 		/* Add to front of self */
 		back->setNext(_head); /* OK even if _head is NULL */
 		if (_head == NULL) {
@@ -93,8 +91,6 @@ public:
 		}
 		_head = front;
 		_length += srcLength;
-		
-		src->unlock();
 		unlock();
 	}
 	
@@ -36,9 +36,6 @@
 
 class MM_LockingHeapRegionQueue : public MM_HeapRegionQueue
 {
-/* For efficient pushFront operation */
-friend class MM_LockingFreeHeapRegionList;
-	
 /* Data members & types */
 public:
 protected:
@@ -83,22 +80,22 @@ public:
 	}
 
 	/* enqueue src at the _end_ of the receiver's queue */
-	virtual void enqueue(MM_HeapRegionQueue *srcAsPQ)
+	virtual void enqueue(MM_HeapRegionQueue *src)
 	{
-		MM_LockingHeapRegionQueue* src = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(srcAsPQ);
-		if (NULL == src->_head) { /* Nothing to move - single read needs no lock */
+		if (src->isEmpty()) { /* Nothing to move - single read needs no lock */
 			return;
 		}
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t srcLength = src->detach(&front, &back, UDATA_MAX);
+		if (0 != srcLength) {
+			enqueue(front, back, srcLength);
+		}
+	}
+
+	virtual void enqueue(MM_HeapRegionDescriptorSegregated *front, MM_HeapRegionDescriptorSegregated *back, uintptr_t count)
+	{
 		lock();
-		src->lock();
-		/* Remove from src */
-		MM_HeapRegionDescriptorSegregated *front = src->_head;
-		MM_HeapRegionDescriptorSegregated *back = src->_tail;
-		uintptr_t srcLength = src->_length;
-		src->_head = NULL;
-		src->_tail = NULL;
-		src->_length = 0;
-		
 		/* Add to back of self */
 		front->setPrev(_tail); /* OK even if _tail is NULL */
 		if (_tail == NULL) {
@@ -107,9 +104,7 @@ public:
 			_tail->setNext(front);
 		}
 		_tail = back;
-		_length += srcLength;
-		
-		src->unlock();
+		_length += count;
 		unlock();
 	}
 
@@ -133,15 +128,23 @@ public:
 		return region;
 	}
 
-	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
+	virtual uintptr_t dequeue(MM_HeapRegionQueue *target, uintptr_t count)
+	{
+		MM_HeapRegionDescriptorSegregated *front = NULL;
+		MM_HeapRegionDescriptorSegregated *back = NULL;
+		uintptr_t moved = detach(&front, &back, count);
+		if (0 != moved) {
+			target->enqueue(front, back, moved);
+		}
+		return moved;
+	}
+
+	virtual uintptr_t detach(MM_HeapRegionDescriptorSegregated **front, MM_HeapRegionDescriptorSegregated **back, uintptr_t maxCount)
 	{
-		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
 		lock();
-		target->lock();
-		uintptr_t moved = dequeueInternal(target, count);
-		target->unlock();
+		uintptr_t detached = detachInternal(front, back, maxCount);
 		unlock();
-		return moved;
+		return detached;
 	}
 
 	virtual uintptr_t debugCountFreeBytesInRegions();
@@ -178,18 +181,33 @@ private:
 		_length++;
 	}
 
-	uintptr_t dequeueInternal(MM_LockingHeapRegionQueue *target, uintptr_t count)
+	uintptr_t detachInternal(MM_HeapRegionDescriptorSegregated **front, MM_HeapRegionDescriptorSegregated **back, uintptr_t maxCount)
 	{
-		uintptr_t moved = 0;
-		while (count-- > 0) {
-			MM_HeapRegionDescriptorSegregated *p = dequeueInternal();
-			if (p == NULL) {
-				break;
+		uintptr_t detached = 0;
+		*front = NULL;
+		*back = NULL;
+		if ((0 != maxCount) && (NULL != _head)) {
+			*front = _head;
+			if (maxCount >= _length) {
+				*back = _tail;
+				detached = _length;
+				_head = NULL;
+				_tail = NULL;
+			} else {
+				MM_HeapRegionDescriptorSegregated *last = _head;
+				detached = 1;
+				while (detached < maxCount) {
+					last = last->getNext();
+					detached += 1;
+				}
+				*back = last;
+				_head = last->getNext();
+				last->setNext(NULL);
+				_head->setPrev(NULL);
 			}
-			moved++;
-			target->enqueueInternal(p);
+			_length -= detached;
 		}
-		return moved;
+		return detached;
 	}
 
 	MM_HeapRegionDescriptorSegregated *dequeueInternal()
@@ -88,6 +88,61 @@ MM_MemoryPoolAggregatedCellList::preAllocateCells(MM_EnvironmentBase* env, uintp
 	return allocatedCellList;
 }
 
+/**
+ * Pre allocates several lists of cells within the region, taking the lock only once.
+ * Free chunks are taken whole until the desired amount of bytes is reached, the chunk which
+ * reaches it is carved as by preAllocateCells().
+ * @param desiredBytes the desired amount of bytes to be pre-allocated in total
+ * @param cellLists where the heads of the pre-allocated lists of cells will be written to
+ * @param cellListBytes where the size in bytes of each pre-allocated list will be written to
+ * @param maxCellLists the capacity of cellLists and cellListBytes
+ * @return the number of pre-allocated lists, 0 if the region has no free cell
+ */
+uintptr_t
+MM_MemoryPoolAggregatedCellList::preAllocateCellLists(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t** cellLists, uintptr_t* cellListBytes, uintptr_t maxCellLists)
+{
+	uintptr_t remainingCellCount = OMR_MAX(desiredBytes / cellSize, 1);
+	uintptr_t preAllocatedBytes = 0;
+	uintptr_t listCount = 0;
+
+	_lock.acquire();
+
+	while ((listCount < maxCellLists) && (0 != remainingCellCount)) {
+		if (_heapCurrent == _heapTop) {
+			/* The current chunk is empty, get the next one */
+			refreshCurrentEntry();
+			if (NULL == _heapCurrent) {
+				break;
+			}
+		}
+
+		uintptr_t chunkCellCount = ((uintptr_t)_heapTop - (uintptr_t)_heapCurrent) / cellSize;
+		cellLists[listCount] = _heapCurrent;
+		if (chunkCellCount > remainingCellCount) {
+			/* Carve off the desired part */
+			cellListBytes[listCount] = remainingCellCount * cellSize;
+			_heapCurrent = (uintptr_t *)((uintptr_t)_heapCurrent + cellListBytes[listCount]);
+			/* Make the remainder walkable */
+			MM_HeapLinkedFreeHeader::fillWithHoles(_heapCurrent, (uintptr_t)_heapTop - (uintptr_t)_heapCurrent);
+			remainingCellCount = 0;
+		} else {
+			/* Take the whole free chunk */
+			cellListBytes[listCount] = (uintptr_t)_heapTop - (uintptr_t)_heapCurrent;
+			_heapCurrent = _heapTop;
+			remainingCellCount -= chunkCellCount;
+		}
+		preAllocatedBytes += cellListBytes[listCount];
+		listCount += 1;
+	}
+
+	if (0 != preAllocatedBytes) {
+		addBytesAllocated(env, preAllocatedBytes);
+	}
+	_lock.release();
+
+	return listCount;
+}
+
 /**
  * @todo Provide function documentation
  */
@@ -117,6 +117,7 @@ public:
 	void returnCell(MM_EnvironmentBase *env, uintptr_t *cell);
 	MMINLINE bool hasCell() { return (_freeListHead != NULL) || (_heapCurrent < _heapTop); }
 	uintptr_t* preAllocateCells(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t* preAllocatedBytesOutput);
+	uintptr_t preAllocateCellLists(MM_EnvironmentBase* env, uintptr_t cellSize, uintptr_t desiredBytes, uintptr_t** cellLists, uintptr_t* cellListBytes, uintptr_t maxCellLists);
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	uintptr_t debugCountFreeBytes();
 	
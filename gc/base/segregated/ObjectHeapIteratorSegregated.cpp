@@ -17,6 +17,13 @@
  *******************************************************************************/
 
 
+#include "omrcfg.h"
+
+#include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionManager.hpp"
+#include "SegregatedGC.hpp"
+#include "SegregatedMarkingScheme.hpp"
+
 #include "ObjectHeapIteratorSegregated.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -32,12 +39,12 @@ GC_ObjectHeapIteratorSegregated::nextObject()
 	switch (_type) {
 		case MM_HeapRegionDescriptor::SEGREGATED_SMALL:
 			while(_scanPtr < _smallPtrTop) {
-				if (!_extensions->objectModel.isDeadObject(_scanPtr)) {
+				if (!isDeadCell(_scanPtr)) {
 					object = _scanPtr;
 					_scanPtr = (omrobjectptr_t) (((uintptr_t)_scanPtr) + _cellSize);
 					break;
 				} else {
-					_scanPtr = (omrobjectptr_t)(((uintptr_t)_scanPtr) + _extensions->objectModel.getSizeInBytesDeadObject(_scanPtr));
+					_scanPtr = (omrobjectptr_t)(((uintptr_t)_scanPtr) + getDeadCellSize(_scanPtr));
 					if (_includeDeadObjects) {
 						object = _scanPtr;
 						break;
@@ -82,18 +89,18 @@ GC_ObjectHeapIteratorSegregated::nextObjectNoAdvance()
 				if(_scanPtr >= _smallPtrTop) {
 					return NULL;
 				}
-				if (!_extensions->objectModel.isDeadObject(_scanPtr) || _includeDeadObjects) {
+				if (!isDeadCell(_scanPtr) || _includeDeadObjects) {
 					return _scanPtr;
 				}
 			}
 			while(_scanPtr < _smallPtrTop) {
-				if (!_extensions->objectModel.isDeadObject(_scanPtr)) {
+				if (!isDeadCell(_scanPtr)) {
 					_scanPtr = (omrobjectptr_t)((uintptr_t)_scanPtr + _cellSize);
 				} else {
-					_scanPtr = (omrobjectptr_t)((uintptr_t)_scanPtr + _extensions->objectModel.getSizeInBytesDeadObject(_scanPtr));
+					_scanPtr = (omrobjectptr_t)((uintptr_t)_scanPtr + getDeadCellSize(_scanPtr));
 				}
 				if (_scanPtr < _smallPtrTop) {
-					if (!_extensions->objectModel.isDeadObject(_scanPtr) || _includeDeadObjects) {
+					if (!isDeadCell(_scanPtr) || _includeDeadObjects) {
 						return _scanPtr;
 					}
 				}
@@ -155,7 +162,16 @@ GC_ObjectHeapIteratorSegregated::calculateActualScanPtrTop()
 		uintptr_t cellCount = ((uintptr_t)_scanPtrTop - (uintptr_t)_scanPtr) / _cellSize;
 		uintptr_t actualSize = cellCount * _cellSize;
 		_smallPtrTop = (omrobjectptr_t)((uintptr_t)_scanPtr + actualSize);
-	} 
+
+		/* The dead objects of a region left unswept by the last collection (see segregatedLazySweep) are not yet holes */
+		_markMap = NULL;
+		if (_scanPtr < _smallPtrTop) {
+			MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)_extensions->heapRegionManager->tableDescriptorForAddress(_scanPtr);
+			if (region->isUnswept()) {
+				_markMap = ((MM_SegregatedGC *)_extensions->getGlobalCollector())->getMarkingScheme()->getMarkMap();
+			}
+		}
+	}
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
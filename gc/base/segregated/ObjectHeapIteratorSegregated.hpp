@@ -20,6 +20,7 @@
 #define OBJECTHEAPITERATORSEGREGATED_HPP_
 
 #include "HeapRegionDescriptor.hpp"
+#include "MarkMap.hpp"
 #include "ObjectModel.hpp"
 
 #include "ObjectHeapIterator.hpp"
@@ -43,6 +44,7 @@ private:
 	bool _includeDeadObjects;
 	bool _pastFirstObject;
 	omrobjectptr_t _smallPtrTop;
+	MM_MarkMap *_markMap; /**< tells the live cells of an unswept small region, NULL if the region is swept */
 	MM_GCExtensionsBase *_extensions;
 
 public:
@@ -59,6 +61,7 @@ public:
 		,_includeDeadObjects(includeDeadObjects)
 		,_pastFirstObject(skipFirstObject)
 		,_smallPtrTop(NULL)
+		,_markMap(NULL)
 		,_extensions(extensions)
 	{
 		calculateActualScanPtrTop();
@@ -68,6 +71,26 @@ protected:
 
 private:
 	void calculateActualScanPtrTop();
+
+	/**
+	 * In an unswept region a dead object is only told from a live one by the mark map, and every
+	 * cell is walked. Otherwise free cells are holes and live cells are objects.
+	 */
+	MMINLINE bool isDeadCell(omrobjectptr_t cell)
+	{
+		if (NULL != _markMap) {
+			return !_markMap->isBitSet(cell);
+		}
+		return _extensions->objectModel.isDeadObject(cell);
+	}
+
+	MMINLINE uintptr_t getDeadCellSize(omrobjectptr_t cell)
+	{
+		if (NULL != _markMap) {
+			return _cellSize;
+		}
+		return _extensions->objectModel.getSizeInBytesDeadObject(cell);
+	}
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
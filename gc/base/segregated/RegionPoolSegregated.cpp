@@ -29,6 +29,7 @@
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionManager.hpp"
 #include "LockingFreeHeapRegionList.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
 #include "OMR_VMThread.hpp"
@@ -86,15 +87,15 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 	Assert_MM_true(0 < _splitAvailableListSplitCount);
 	for (szClass=OMR_SIZECLASSES_MIN_SMALL; szClass<=OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			uintptr_t splitAvailableListsSize = sizeof(MM_LockingHeapRegionQueue) * _splitAvailableListSplitCount;
-			_smallAvailableRegions[szClass][i] = (MM_LockingHeapRegionQueue *)env->getForge()->allocate(splitAvailableListsSize, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			uintptr_t splitAvailableListsSize = sizeof(MM_LockFreeHeapRegionQueue) * _splitAvailableListSplitCount;
+			_smallAvailableRegions[szClass][i] = (MM_LockFreeHeapRegionQueue *)env->getForge()->allocate(splitAvailableListsSize, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
 			if (NULL == _smallAvailableRegions[szClass][i]) {
 				return false;
 			}
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
+			MM_LockFreeHeapRegionQueue *regionQueue = _smallAvailableRegions[szClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
-				/* The available lists should track the free bytes in their regions (4th param = true) */
-				new (&regionQueue[j]) MM_LockingHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true, true, true);
+				/* The available lists should track the free bytes in their regions (2nd param = true) */
+				new (&regionQueue[j]) MM_LockFreeHeapRegionQueue(MM_HeapRegionList::HRL_KIND_AVAILABLE, true);
 				if (!(&regionQueue[j])->initialize(env)) {
 					return false;
 				}
@@ -131,6 +132,10 @@ MM_RegionPoolSegregated::initialize(MM_EnvironmentBase *env)
 MM_HeapRegionQueue*
 MM_RegionPoolSegregated::allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes)
 {
+	/* Shared queues of single regions are handed regions by mutators refilling their allocation contexts, so they do without a lock */
+	if (singleRegionsOnly && concurrentAccess) {
+		return MM_LockFreeHeapRegionQueue::newInstance(env, regionListKind, trackFreeBytes);
+	}
 	return MM_LockingHeapRegionQueue::newInstance(env, regionListKind, singleRegionsOnly, concurrentAccess, trackFreeBytes);
 }
 
@@ -182,7 +187,7 @@ MM_RegionPoolSegregated::tearDown(MM_EnvironmentBase *env)
 	
 	for (int32_t szClass=OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
 		for (uintptr_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueueArray = _smallAvailableRegions[szClass][i];
+			MM_LockFreeHeapRegionQueue *regionQueueArray = _smallAvailableRegions[szClass][i];
 			if (NULL != regionQueueArray) {
 				for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
 					(&regionQueueArray[j])->tearDown(env);
@@ -217,7 +222,7 @@ MM_RegionPoolSegregated::moveInUseToSweep(MM_EnvironmentBase *env)
 		_darkMatterCellCount[sizeClass] = 0;
 		_smallSweepRegions[sizeClass]->enqueue(_smallFullRegions[sizeClass]);
 		for (int32_t i=0; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
+			MM_LockFreeHeapRegionQueue *regionQueue = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=0; j<_splitAvailableListSplitCount; j++) {
 				_smallSweepRegions[sizeClass]->enqueue(&regionQueue[j]);
 			}
@@ -324,7 +329,7 @@ MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
 {
 	uintptr_t splitIndex = env->getSlaveID() % _splitAvailableListSplitCount;
 	for (int32_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
-		MM_LockingHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
+		MM_LockFreeHeapRegionQueue *primaryQueue = &(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex];
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
 			primaryQueue->enqueue(&(_smallAvailableRegions[sizeClass][i])[splitIndex]);
 		}
@@ -346,9 +351,9 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 
 	/* try bucket 0, i.e. primary bucket first */
 	uintptr_t startList = env->getEnvironmentId() % _splitAvailableListSplitCount;
-	MM_LockingHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
-	MM_LockingHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
-	region = allocationQueue->dequeueIfNonEmpty();
+	MM_LockFreeHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
+	MM_LockFreeHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
+	region = allocationQueue->dequeue();
 	if (region != NULL) {
 		return region;
 	}
@@ -356,7 +361,7 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 	/* if primary bucket fails, try the other split queues, starting from the current thread's split index */
 	for (uintptr_t j=startList+1; j<startList+_splitAvailableListSplitCount; j++) {
 		allocationQueue = &primaryQueueArray[j%_splitAvailableListSplitCount];
-		region = allocationQueue->dequeueIfNonEmpty();
+		region = allocationQueue->dequeue();
 		if (region != NULL) {
 			return region;
 		}
@@ -365,10 +370,10 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 	/* if all split lists in the primary bucket fail, try the remaining buckets */
 	if (_isSweepingSmall) {
 		for (int32_t i=1; i<NUM_DEFRAG_BUCKETS; i++) {
-			MM_LockingHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
+			MM_LockFreeHeapRegionQueue *queueArray = _smallAvailableRegions[sizeClass][i];
 			for (uintptr_t j=startList; j<startList+_splitAvailableListSplitCount; j++) {
 				allocationQueue = &queueArray[j%_splitAvailableListSplitCount];
-				region = allocationQueue->dequeueIfNonEmpty();
+				region = allocationQueue->dequeue();
 				if (region != NULL) {
 					return region;
 				}
@@ -409,6 +414,7 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 		_smallOccupancy[sizeClass] = (_smallOccupancy[sizeClass] * 0.9f) + (region->getMemoryPoolACL()->getMarkCount() / region->getNumCells() * 0.1f );
 		decrementCurrentCountOfSweepRegions(sizeClass, 1);
 		decrementCurrentTotalCountOfSweepRegions(1);
+		MM_AtomicOperations::add(&_allocationSweptRegionCount, 1);
 		_smallFullRegions[sizeClass]->enqueue(region);
 	}
 	return region;
@@ -24,6 +24,7 @@
 
 #include "HeapRegionList.hpp"
 #include "HeapRegionManager.hpp"
+#include "LockFreeHeapRegionQueue.hpp"
 #include "LockingHeapRegionQueue.hpp"
 #include "RegionPool.hpp"
 #include "SweepSchemeSegregated.hpp"
@@ -34,6 +35,7 @@ class MM_EnvironmentBase;
 class MM_FreeHeapRegionList;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
+class MM_LockFreeHeapRegionQueue;
 class MM_LockingHeapRegionQueue;
 
 #define PRIMARY_BUCKET 0
@@ -73,7 +75,7 @@ private:
 	 * defragmentation purposes prefers the least occupied regions while allocation prefers the
 	 * most occupied.
 	*/
-	MM_LockingHeapRegionQueue *_smallAvailableRegions[OMR_SIZECLASSES_NUM_SMALL+1][NUM_DEFRAG_BUCKETS]; /**< Regions that are available to be given out to allocation contexts and aren't entirely free. */
+	MM_LockFreeHeapRegionQueue *_smallAvailableRegions[OMR_SIZECLASSES_NUM_SMALL+1][NUM_DEFRAG_BUCKETS]; /**< Regions that are available to be given out to allocation contexts and aren't entirely free. */
 	
 	/** 
 	 * @note Some of the full regions may be attached to AllocationContexts, and thus being actively
@@ -128,6 +130,7 @@ private:
 	volatile uintptr_t _currentCountOfSweepRegions[OMR_SIZECLASSES_MAX_SMALL + 1];
 	uintptr_t _initialTotalCountOfSweepRegions;
 	volatile uintptr_t _currentTotalCountOfSweepRegions;
+	volatile uintptr_t _allocationSweptRegionCount; /**< Number of regions swept by allocating threads since the last call to resetAllocationSweptRegionCount() */
 	
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
@@ -218,6 +221,16 @@ public:
 	{
 		MM_AtomicOperations::subtract(&_currentTotalCountOfSweepRegions, count);
 	}
+
+	MMINLINE uintptr_t getAllocationSweptRegionCount() const
+	{
+		return _allocationSweptRegionCount;
+	}
+
+	MMINLINE void resetAllocationSweptRegionCount()
+	{
+		_allocationSweptRegionCount = 0;
+	}
 	
 	MMINLINE void addDarkMatterCellsAfterSweepForSizeClass(uintptr_t sizeClass, uintptr_t cellCount) {
 		MM_AtomicOperations::add(&_darkMatterCellCount[sizeClass], cellCount);
@@ -245,7 +258,7 @@ public:
 	MMINLINE MM_HeapRegionQueue *getArrayletSweepRegions() { return _arrayletSweepRegions; }
 	MMINLINE MM_HeapRegionQueue *getArrayletFullRegions() { return _arrayletFullRegions; }
 	MMINLINE MM_HeapRegionQueue *getArrayletAvailableRegions() { return _arrayletAvailableRegions; }
-	MMINLINE MM_LockingHeapRegionQueue *getSmallAvailableRegions(uintptr_t sizeClass, uintptr_t defragBucket, uintptr_t splitList) { return &_smallAvailableRegions[sizeClass][defragBucket][splitList]; }
+	MMINLINE MM_LockFreeHeapRegionQueue *getSmallAvailableRegions(uintptr_t sizeClass, uintptr_t defragBucket, uintptr_t splitList) { return &_smallAvailableRegions[sizeClass][defragBucket][splitList]; }
 	MMINLINE MM_HeapRegionQueue *getSmallSweepRegions(uintptr_t sizeClass) { return _smallSweepRegions[sizeClass]; }
 	MMINLINE MM_HeapRegionQueue *getSmallFullRegions(uintptr_t sizeClass) { return _smallFullRegions[sizeClass]; }
 	MMINLINE uintptr_t getDarkMatterCellCount(uintptr_t sizeClass) { return _darkMatterCellCount[sizeClass]; }
@@ -270,6 +283,9 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _initialTotalCountOfSweepRegions(0)
+		, _currentTotalCountOfSweepRegions(0)
+		, _allocationSweptRegionCount(0)
 		, _isSweepingSmall(false)
 	{
 		_typeId = __FUNCTION__;
@@ -133,11 +133,36 @@ MM_SegregatedAllocationInterface::allocateFromCache(MM_EnvironmentBase* env, uin
 	if (cellSize <= ((uintptr_t)_allocationCache[sizeClass].top) - ((uintptr_t) cellCurrent)) {
 		_allocationCache[sizeClass].current = (uintptr_t *)((uintptr_t)cellCurrent + cellSize);
 	} else {
-		return NULL;
+		return allocateFromPendingCellList(env, sizeClass);
 	}
 	return cellCurrent;
 }
 
+/**
+ * Make the next pending cell list of the size class the current cache and allocate its first cell.
+ * Pending cell lists were taken from the region by an earlier replenish, so no lock is needed.
+ * @return The carved off cell, or NULL if there is no pending cell list for the size class.
+ */
+void*
+MM_SegregatedAllocationInterface::allocateFromPendingCellList(MM_EnvironmentBase* env, uintptr_t sizeClass)
+{
+	uintptr_t pendingCount = _pendingCellListCount[sizeClass];
+	if (0 == pendingCount) {
+		return NULL;
+	}
+	if (env->getExtensions()->doFrequentObjectAllocationSampling) {
+		updateFrequentObjectsStats(env, sizeClass);
+	}
+
+	pendingCount -= 1;
+	_pendingCellListCount[sizeClass] = pendingCount;
+	uintptr_t* cellList = _pendingCellLists[sizeClass][pendingCount];
+	_allocationCacheBases[sizeClass] = cellList;
+	_allocationCache[sizeClass].current = (uintptr_t *)((uintptr_t)cellList + _sizeClasses->getCellSize(sizeClass));
+	_allocationCache[sizeClass].top = (uintptr_t *)((uintptr_t)cellList + _pendingCellListBytes[sizeClass][pendingCount]);
+	return cellList;
+}
+
 void*
 MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
@@ -261,8 +286,14 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 			/* next pointer value is irrelevant, it just needs to be low bit tagged, to make it non-object */
 			chunk->setNext(NULL);
 		}
+		for (uintptr_t i = 0; i < _pendingCellListCount[sizeClass]; i++) {
+			MM_HeapLinkedFreeHeader *chunk = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(_pendingCellLists[sizeClass][i]);
+			chunk->setSize(_pendingCellListBytes[sizeClass][i]);
+			chunk->setNext(NULL);
+		}
 	}
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
+	memset(_pendingCellListCount, 0, sizeof(_pendingCellListCount));
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
 }
@@ -315,23 +346,51 @@ MM_SegregatedAllocationInterface::restartCache(MM_EnvironmentBase *env)
  */
 void
 MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void* cacheMemory, uintptr_t cacheSize)
+{
+	uintptr_t* cellList = (uintptr_t*)cacheMemory;
+	replenishCache(env, sizeInBytes, &cellList, &cacheSize, 1);
+}
+
+/**
+ * Replenishes the cache for the given size class with several cell lists. The first list becomes the
+ * cache, the others are kept pending and become the cache in turn once it is used up. The cache for the
+ * given size class must be empty and have no pending lists.
+ * @param sizeInBytes The size in bytes of a single cell (ie: not the total of bytes in the cache)
+ * @param cellLists The heads of the new cell lists
+ * @param cellListBytes The size of allocatable memory contained in each cell list
+ * @param cellListCount The number of cell lists, at most REPLENISH_CELL_LISTS
+ */
+void
+MM_SegregatedAllocationInterface::replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, uintptr_t** cellLists, uintptr_t* cellListBytes, uintptr_t cellListCount)
 {
 	MM_GCExtensionsBase* extensions = env->getExtensions();
-	uintptr_t* cellLink = (uintptr_t*)cacheMemory;
+	uintptr_t* cellLink = cellLists[0];
 	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+	uintptr_t cacheSize = 0;
 
 	/* The allocation cache for the size class being replenished must be empty, otherwise we'd have
 	 * to append the cellLink to the end, which would require traversing the list. There should be no
 	 * reason to replenish a non-empty cache.
 	 */
 	Assert_MM_true(_allocationCache[sizeClass].current == _allocationCache[sizeClass].top);
+	Assert_MM_true(0 == _pendingCellListCount[sizeClass]);
+	Assert_MM_true((0 < cellListCount) && (cellListCount <= REPLENISH_CELL_LISTS));
 	if (extensions->doFrequentObjectAllocationSampling) {
 		updateFrequentObjectsStats(env, sizeClass);
 	}
 
 	_allocationCache[sizeClass].current = cellLink;
 	_allocationCacheBases[sizeClass] = cellLink;
-	_allocationCache[sizeClass].top = (uintptr_t *)((uintptr_t)cellLink + cacheSize);
+	_allocationCache[sizeClass].top = (uintptr_t *)((uintptr_t)cellLink + cellListBytes[0]);
+	cacheSize += cellListBytes[0];
+
+	/* pending lists are used from the highest index down, so store them in reverse order */
+	for (uintptr_t i = 1; i < cellListCount; i++) {
+		_pendingCellLists[sizeClass][cellListCount - 1 - i] = cellLists[i];
+		_pendingCellListBytes[sizeClass][cellListCount - 1 - i] = cellListBytes[i];
+		cacheSize += cellListBytes[i];
+	}
+	_pendingCellListCount[sizeClass] = cellListCount - 1;
 	
 	if (_cachedAllocationsEnabled) {
 		/* Update the allocation stats. */
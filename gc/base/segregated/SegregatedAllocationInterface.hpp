@@ -43,6 +43,9 @@ class MM_SegregatedAllocationInterface : public MM_ObjectAllocationInterface
 	 * Data members
 	 */
 public:
+	enum {
+		REPLENISH_CELL_LISTS = 4 /**< The maximum number of cell lists taken from a region by one replenish (per size class). */
+	};
 protected:
 private:
 	MM_LanguageSegregatedAllocationCache _languageAllocationCache;
@@ -54,6 +57,9 @@ private:
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
+	uintptr_t *_pendingCellLists[OMR_SIZECLASSES_NUM_SMALL + 1][REPLENISH_CELL_LISTS - 1]; /**< Cell lists of the last replenish waiting to become the cache, used from the highest index down (per size class). */
+	uintptr_t _pendingCellListBytes[OMR_SIZECLASSES_NUM_SMALL + 1][REPLENISH_CELL_LISTS - 1]; /**< The size of each pending cell list (per size class). */
+	uintptr_t _pendingCellListCount[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The number of pending cell lists (per size class). */
 
 	/*
 	 * Function members
@@ -88,6 +94,7 @@ public:
 	uintptr_t getAllocatableSize(uintptr_t sizeClass) { return (uintptr_t)_allocationCache[sizeClass].top - (uintptr_t)_allocationCache[sizeClass].current; }
 	void* allocateFromCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void *cacheMemory, uintptr_t cacheSize);
+	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, uintptr_t **cellLists, uintptr_t *cellListBytes, uintptr_t cellListCount);
 	uintptr_t getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	
 	virtual void enableCachedAllocations(MM_EnvironmentBase *env);
@@ -105,10 +112,12 @@ protected:
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
+		memset(_pendingCellListCount, 0, sizeof(_pendingCellListCount));
 	};
 	
 private:
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env, uintptr_t sizeClass);
+	void* allocateFromPendingCellList(MM_EnvironmentBase* env, uintptr_t sizeClass);
 	
 };
 
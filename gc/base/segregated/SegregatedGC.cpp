@@ -25,8 +25,10 @@
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SegregatedSweeperThread.hpp"
 #include "SegregatedSweepTask.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
@@ -89,6 +91,14 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (_extensions->segregatedConcurrentSweep) {
+		_extensions->segregatedLazySweep = true;
+		_sweeperThread = MM_SegregatedSweeperThread::newInstance(env, _sweepScheme);
+		if (NULL == _sweeperThread) {
+			return false;
+		}
+	}
 	return true;
 }
 
@@ -103,6 +113,11 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_markingScheme = NULL;
 	}
 
+	if(NULL != _sweeperThread) {
+		_sweeperThread->kill(env);
+		_sweeperThread = NULL;
+	}
+
 	if(NULL != _sweepScheme) {
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
@@ -129,12 +144,19 @@ void MM_SegregatedGC::heapReconfigured(MM_EnvironmentBase* env)
 bool
 MM_SegregatedGC::collectorStartup(MM_GCExtensionsBase* extensions)
 {
-	return true;
+	bool result = true;
+	if (NULL != _sweeperThread) {
+		result = _sweeperThread->startup();
+	}
+	return result;
 }
 
 void
 MM_SegregatedGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+	if (NULL != _sweeperThread) {
+		_sweeperThread->shutdown();
+	}
 }
 
 void *
@@ -179,6 +201,12 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	_extensions->globalGCStats.clear();
 	_extensions->globalGCStats.gcCount++;
 
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool();
+	if (_extensions->segregatedLazySweep) {
+		/* Must precede the flush of the allocation contexts, which queues their regions for this cycle's sweep */
+		completeLazySweep(env, memoryPool);
+	}
+
 	/*
 	 * Marking
 	 */
@@ -222,8 +250,14 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
+	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
 	_dispatcher->run(env, &sweepTask);
+	if (_extensions->segregatedLazySweep) {
+		sweepStats->unsweptRegions = memoryPool->getRegionPool()->getCurrentTotalCountOfSweepRegions();
+	}
+	if (NULL != _sweeperThread) {
+		_sweeperThread->startSweep(env);
+	}
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
@@ -247,6 +281,30 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	return true;
 }
 
+/**
+ * Sweep the regions the previous collection left unswept, since marking overwrites the mark map
+ * they are swept with. The background sweeper is stopped first.
+ */
+void
+MM_SegregatedGC::completeLazySweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	MM_RegionPoolSegregated *regionPool = memoryPool->getRegionPool();
+
+	if (NULL != _sweeperThread) {
+		sweepStats->lazySweptRegionsInBackground = _sweeperThread->stopSweep(env);
+	}
+	sweepStats->lazySweptRegionsByAllocation = regionPool->getAllocationSweptRegionCount();
+	regionPool->resetAllocationSweptRegionCount();
+
+	/* Allocating threads are stopped, so every region dequeued for sweeping has been swept */
+	sweepStats->lazySweptRegionsByCollector = regionPool->getCurrentTotalCountOfSweepRegions();
+	if (0 != sweepStats->lazySweptRegionsByCollector) {
+		MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool, true);
+		_dispatcher->run(env, &sweepTask);
+	}
+}
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -30,6 +30,9 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+class MM_MemoryPoolSegregated;
+class MM_SegregatedSweeperThread;
+
 class MM_SegregatedGC : public MM_GlobalCollector
 {
 	/*
@@ -40,6 +43,7 @@ protected:
 	OMRPortLibrary *_portLibrary;
 	MM_SegregatedMarkingScheme *_markingScheme;
 	MM_SweepSchemeSegregated *_sweepScheme;
+	MM_SegregatedSweeperThread *_sweeperThread; /**< sweeps the regions left unswept by a collection, NULL unless segregatedConcurrentSweep is set */
 	MM_Dispatcher *_dispatcher;
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
@@ -69,6 +73,8 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	void completeLazySweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env, MM_CollectorLanguageInterface *cli);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -115,6 +121,7 @@ public:
 		, _portLibrary(env->getPortLibrary())
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
+		, _sweeperThread(NULL)
 		, _dispatcher(_extensions->dispatcher)
 		, _scanBytes(0)
 		, _objectsMarked(0)
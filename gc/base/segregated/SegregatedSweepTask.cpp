@@ -26,7 +26,11 @@
 void
 MM_SegregatedSweepTask::run(MM_EnvironmentBase *env)
 {
-	_sweepScheme->sweep(env, _memoryPool, false);
+	if (_completeLazySweep) {
+		_sweepScheme->completeSweep(env, _memoryPool);
+	} else {
+		_sweepScheme->sweep(env, _memoryPool, false);
+	}
 }
 
 void
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "CollectorLanguageInterfaceImpl.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "SweepSchemeSegregated.hpp"
+
+#include "SegregatedSweeperThread.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_SegregatedSweeperThread *
+MM_SegregatedSweeperThread::newInstance(MM_EnvironmentBase *env, MM_SweepSchemeSegregated *sweepScheme)
+{
+	MM_SegregatedSweeperThread *sweeperThread = (MM_SegregatedSweeperThread *)env->getForge()->allocate(sizeof(MM_SegregatedSweeperThread), MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != sweeperThread) {
+		new(sweeperThread) MM_SegregatedSweeperThread(env, sweepScheme);
+		if (!sweeperThread->initialize(env)) {
+			sweeperThread->kill(env);
+			sweeperThread = NULL;
+		}
+	}
+	return sweeperThread;
+}
+
+void
+MM_SegregatedSweeperThread::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+MM_SegregatedSweeperThread::MM_SegregatedSweeperThread(MM_EnvironmentBase *env, MM_SweepSchemeSegregated *sweepScheme)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _sweepScheme(sweepScheme)
+	, _sweeperMonitor(NULL)
+	, _sweeperState(STATE_ERROR)
+	, _stopRequested(false)
+	, _sweptRegions(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+MM_SegregatedSweeperThread::initialize(MM_EnvironmentBase *env)
+{
+	return 0 == omrthread_monitor_init_with_name(&_sweeperMonitor, 0, "MM_SegregatedSweeperThread::_sweeperMonitor");
+}
+
+void
+MM_SegregatedSweeperThread::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sweeperMonitor) {
+		omrthread_monitor_destroy(_sweeperMonitor);
+		_sweeperMonitor = NULL;
+	}
+}
+
+bool
+MM_SegregatedSweeperThread::startup()
+{
+	/* hold the monitor over start-up so that the thread can not report its state before we wait for it */
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		sweeper_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _sweeperState) {
+			omrthread_monitor_wait(_sweeperMonitor);
+		}
+	} else {
+		_sweeperState = STATE_ERROR;
+	}
+	bool success = (STATE_ERROR != _sweeperState);
+	omrthread_monitor_exit(_sweeperMonitor);
+
+	return success;
+}
+
+void
+MM_SegregatedSweeperThread::shutdown()
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	if (STATE_ERROR != _sweeperState) {
+		_stopRequested = true;
+		while (STATE_TERMINATED != _sweeperState) {
+			if (STATE_SWEEPING != _sweeperState) {
+				_sweeperState = STATE_TERMINATION_REQUESTED;
+			}
+			omrthread_monitor_notify_all(_sweeperMonitor);
+			omrthread_monitor_wait(_sweeperMonitor);
+		}
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+}
+
+void
+MM_SegregatedSweeperThread::startSweep(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	if (STATE_IDLE == _sweeperState) {
+		_sweeperState = STATE_SWEEP_REQUESTED;
+		omrthread_monitor_notify_all(_sweeperMonitor);
+	}
+	omrthread_monitor_exit(_sweeperMonitor);
+}
+
+uintptr_t
+MM_SegregatedSweeperThread::stopSweep(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_sweeperMonitor);
+	_stopRequested = true;
+	while (STATE_SWEEPING == _sweeperState) {
+		omrthread_monitor_wait(_sweeperMonitor);
+	}
+	if (STATE_SWEEP_REQUESTED == _sweeperState) {
+		_sweeperState = STATE_IDLE;
+	}
+	_stopRequested = false;
+	uintptr_t sweptRegions = _sweptRegions;
+	_sweptRegions = 0;
+	omrthread_monitor_exit(_sweeperMonitor);
+
+	return sweptRegions;
+}
+
+int J9THREAD_PROC
+MM_SegregatedSweeperThread::sweeper_thread_proc(void *info)
+{
+	MM_SegregatedSweeperThread *sweeperThread = (MM_SegregatedSweeperThread *)info;
+	sweeperThread->sweeperThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+/**
+ * Body of the sweeper thread: sweep whenever asked to until asked to terminate.
+ * The thread sweeps without holding the monitor or VM access, the collector stops it before marking.
+ */
+void
+MM_SegregatedSweeperThread::sweeperThreadEntryPoint()
+{
+	MM_CollectorLanguageInterface *cli = _extensions->collectorLanguageInterface;
+	OMR_VMThread *omrVMThread = NULL;
+
+	omrthread_monitor_enter(_sweeperMonitor);
+	_sweeperState = STATE_IDLE;
+	omrthread_monitor_notify_all(_sweeperMonitor);
+
+	while (STATE_TERMINATION_REQUESTED != _sweeperState) {
+		if (STATE_SWEEP_REQUESTED == _sweeperState) {
+			_sweeperState = STATE_SWEEPING;
+			omrthread_monitor_exit(_sweeperMonitor);
+			if (NULL == omrVMThread) {
+				/* The environment of a thread needs the default memory space, which the collector may be started before */
+				omrVMThread = cli->attachVMThread(_extensions->getOmrVM(), "GC Sweeper", MM_CollectorLanguageInterfaceImpl::ATTACH_GC_HELPER_THREAD);
+				if (NULL != omrVMThread) {
+					MM_EnvironmentBase::getEnvironment(omrVMThread)->setThreadType(GC_SLAVE_THREAD);
+				}
+			}
+			/* If the thread could not attach, the regions are left for allocation and the next collection to sweep */
+			uintptr_t sweptRegions = 0;
+			if (NULL != omrVMThread) {
+				sweptRegions = _sweepScheme->sweepUnsweptRegions(MM_EnvironmentBase::getEnvironment(omrVMThread), &_stopRequested);
+			}
+			omrthread_monitor_enter(_sweeperMonitor);
+			_sweptRegions += sweptRegions;
+			_sweeperState = STATE_IDLE;
+			omrthread_monitor_notify_all(_sweeperMonitor);
+		} else {
+			omrthread_monitor_wait(_sweeperMonitor);
+		}
+	}
+
+	/* the monitor is only released by omrthread_exit(), so shutdown() can not return before the thread is detached */
+	_sweeperState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_sweeperMonitor);
+	if (NULL != omrVMThread) {
+		cli->detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_CollectorLanguageInterfaceImpl::ATTACH_GC_HELPER_THREAD);
+	}
+	omrthread_exit(_sweeperMonitor);
+}
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
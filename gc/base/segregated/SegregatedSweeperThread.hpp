@@ -0,0 +1,105 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDSWEEPERTHREAD_HPP_)
+#define SEGREGATEDSWEEPERTHREAD_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_SweepSchemeSegregated;
+
+/**
+ * Background thread which sweeps the small regions a collection left unswept (see segregatedConcurrentSweep),
+ * so that allocating threads seldom have to sweep a region themselves. The collector stops it before marking.
+ * @ingroup GC_Modron_Segregated
+ */
+class MM_SegregatedSweeperThread : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	typedef enum SweeperThreadState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_IDLE,
+		STATE_SWEEP_REQUESTED,
+		STATE_SWEEPING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	} SweeperThreadState;
+
+	MM_GCExtensionsBase *_extensions;
+	MM_SweepSchemeSegregated *_sweepScheme;
+	omrthread_monitor_t _sweeperMonitor; /**< protects _sweeperState */
+	volatile SweeperThreadState _sweeperState;
+	volatile bool _stopRequested; /**< set to make the thread stop sweeping after its current region */
+	uintptr_t _sweptRegions; /**< number of regions swept since the last stopSweep() */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_SegregatedSweeperThread *newInstance(MM_EnvironmentBase *env, MM_SweepSchemeSegregated *sweepScheme);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the thread, waiting until it reports whether it is running.
+	 * @return true on success, false on failure
+	 */
+	bool startup();
+
+	/**
+	 * Stop the thread, waiting until it has exited.
+	 */
+	void shutdown();
+
+	/**
+	 * Have the thread sweep the regions left unswept by the collection which just ended.
+	 */
+	void startSweep(MM_EnvironmentBase *env);
+
+	/**
+	 * Stop the thread sweeping, returning once it has finished sweeping its current region.
+	 * @return the number of regions the thread swept since the last call
+	 */
+	uintptr_t stopSweep(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_SegregatedSweeperThread(MM_EnvironmentBase *env, MM_SweepSchemeSegregated *sweepScheme);
+
+private:
+	void sweeperThreadEntryPoint();
+	static int J9THREAD_PROC sweeper_thread_proc(void *info);
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDSWEEPERTHREAD_HPP_ */
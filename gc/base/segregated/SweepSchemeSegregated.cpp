@@ -97,9 +97,14 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 {
 	_memoryPool = memoryPool;
 	_isFixHeapForWalk = isFixHeapForWalk;
+	/* The small regions are left for allocation and the background sweeper, unless the heap has to be walkable */
+	bool lazySweep = env->getExtensions()->segregatedLazySweep && !isFixHeapForWalk;
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		preSweep(env);
+		if (lazySweep) {
+			markUnsweptRegions(env);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 	
@@ -116,16 +121,104 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
+	if (!lazySweep) {
+		incrementalSweepSmall(env);
+		regionPool->joinBucketListsForSplitIndex(env);
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		/* Until the lazy sweep completes, swept regions are made available in every defragmentation bucket */
+		if (!lazySweep) {
+			regionPool->setSweepSmallPages(false);
+		}
+		postSweep(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_SweepSchemeSegregated::completeSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool)
+{
+	_memoryPool = memoryPool;
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+
 	incrementalSweepSmall(env);
 	regionPool->joinBucketListsForSplitIndex(env);
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		regionPool->setSweepSmallPages(false);
-		postSweep(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+uintptr_t
+MM_SweepSchemeSegregated::sweepUnsweptRegions(MM_EnvironmentBase *env, volatile bool *stopRequested)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	uintptr_t splitIndex = env->getSlaveID() % regionPool->getSplitAvailableListSplitCount();
+	uintptr_t sweptRegions = 0;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		MM_HeapRegionQueue *sweepList = regionPool->getSmallSweepRegions(sizeClass);
+		uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
+		MM_HeapRegionDescriptorSegregated *currentRegion = NULL;
+		/* Each region is dequeued by exactly one of the sweeping threads */
+		while (!*stopRequested && (NULL != (currentRegion = sweepList->dequeue()))) {
+			regionPool->decrementCurrentCountOfSweepRegions(sizeClass, 1);
+			regionPool->decrementCurrentTotalCountOfSweepRegions(1);
+			sweepRegion(env, currentRegion);
+			releaseSweptSmallRegion(env, currentRegion, sizeClass, numCells, splitIndex);
+			sweptRegions += 1;
+		}
+	}
+
+	return sweptRegions;
+}
+
+/**
+ * Record every small region as unswept, they have all been moved to the sweep lists by preSweep().
+ */
+void
+MM_SweepSchemeSegregated::markUnsweptRegions(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heap->getHeapRegionManager();
+	uintptr_t regionCount = regionManager->getTableRegionCount();
+
+	for (uintptr_t i = 0; i < regionCount; ) {
+		MM_HeapRegionDescriptorSegregated *region = (MM_HeapRegionDescriptorSegregated *)regionManager->mapRegionTableIndexToDescriptor(i);
+		i += OMR_MAX(region->getRange(), 1);
+		if (region->isSmall()) {
+			region->setSweepState(MM_HeapRegionDescriptorSegregated::SWEEP_STATE_UNSWEPT);
+		}
+	}
+}
+
+/**
+ * Hand a swept small region to the region pool, as incrementalSweepSmall() does for the regions it sweeps.
+ */
+void
+MM_SweepSchemeSegregated::releaseSweptSmallRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t numCells, uintptr_t splitIndex)
+{
+	MM_RegionPoolSegregated *regionPool = _memoryPool->getRegionPool();
+	MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+
+	if (memoryPoolACL->getFreeCount() < numCells) {
+		uintptr_t occupancy = (memoryPoolACL->getMarkCount() * 100) / numCells;
+		if (env->getExtensions()->nonDeterministicSweep) {
+			regionPool->updateOccupancy(sizeClass, occupancy);
+		}
+		if (memoryPoolACL->getMarkCount() == numCells) {
+			regionPool->getSmallFullRegions(sizeClass)->enqueue(region);
+		} else {
+			regionPool->enqueueAvailable(region, sizeClass, occupancy, splitIndex);
+		}
+	} else {
+		region->emptyRegionReturned(env);
+		regionPool->addFreeRegion(env, region);
+	}
+}
+
 void
 MM_SweepSchemeSegregated::preSweep(MM_EnvironmentBase *env)
 {
@@ -141,6 +234,7 @@ MM_SweepSchemeSegregated::postSweep(MM_EnvironmentBase *env)
 void
 MM_SweepSchemeSegregated::sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region)
 {
+	region->setSweepState(MM_HeapRegionDescriptorSegregated::SWEEP_STATE_SWEEPING);
 	region->getMemoryPoolACL()->resetCounts();
 
 	switch (region->getRegionType()) {
@@ -167,6 +261,8 @@ MM_SweepSchemeSegregated::sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDesc
 	default:
 		Assert_MM_unreachable();
 	}
+
+	region->setSweepState(MM_HeapRegionDescriptorSegregated::SWEEP_STATE_SWEPT);
 }
 
 void
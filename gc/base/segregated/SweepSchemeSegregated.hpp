@@ -62,6 +62,19 @@ public:
 	void sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool, bool isFixHeapForWalk);
 	virtual void sweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 
+	/**
+	 * Sweep the small regions the previous collection left unswept (see segregatedLazySweep), before marking
+	 * overwrites the mark map they are swept with. Called by every thread of a MM_SegregatedSweepTask.
+	 */
+	void completeSweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated *memoryPool);
+
+	/**
+	 * Sweep the small regions left unswept by the last collection one at a time, concurrently with allocating
+	 * threads (which may sweep regions themselves), until none is left or stopRequested is set.
+	 * @return the number of regions swept
+	 */
+	uintptr_t sweepUnsweptRegions(MM_EnvironmentBase *env, volatile bool *stopRequested);
+
 	bool isClearMarkMapAfterSweep() { return _clearMarkMapAfterSweep; }
 	void setClearMarkMapAfterSweep(bool clearMarkMapAfterSweep) { _clearMarkMapAfterSweep = clearMarkMapAfterSweep; }
 protected:
@@ -88,6 +101,8 @@ protected:
 	
 private:
 	void unmarkRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
+	void markUnsweptRegions(MM_EnvironmentBase *env);
+	void releaseSweptSmallRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t numCells, uintptr_t splitIndex);
 	void sweepSmallRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 #if defined(OMR_GC_ARRAYLETS)
 	void sweepArrayletRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
@@ -41,8 +41,10 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "HeapStats.hpp"
+#include "LargeObjectAllocateStats.hpp"
 #include "MarkingScheme.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -66,6 +68,11 @@
 #define getConsumedSizeInBytesWithHeaderForMove getConsumedSizeInBytesWithHeader
 #endif /* !defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+/* Most remap calls worth making to move one object; an object moved a short distance is copied instead */
+#define COMPACT_REMAP_MAXIMUM_CHUNKS 16
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -491,10 +498,69 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 				j++;
 			}
 		}
+		if (_partialCompact) {
+			selectPartialCompactSubAreas(env, j);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+/**
+ *  Select the sub areas evacuated by a partial compaction.
+ *  The window starts at the first sub area at or above the address where the previous partial
+ *  compaction stopped, wrapping around to the bottom of the heap, and covers partialCompactSize
+ *  bytes. The sub areas outside the window are only fixed up, so forwarding pointers are only ever
+ *  looked up for objects in [_compactFrom, _compactTo).
+ *  This is not an incremental or concurrent compaction: it runs entirely stop-the-world, and the window
+ *  only bounds the bytes moved. Every live object of the heap is still fixed up, so the fixup phase
+ *  still grows with the live set. Evacuating while mutators run would need every reference load to
+ *  be healed, and readBarrierLoad() only heals references into the evacuate space of the scavenger.
+ */
+void
+MM_CompactScheme::selectPartialCompactSubAreas(MM_EnvironmentStandard *env, uintptr_t subAreaCount)
+{
+	uintptr_t first = subAreaCount;
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		if ((SubAreaEntry::init == _subAreaTable[i].state) && (_subAreaTable[i].firstObject >= _partialCompactNext)) {
+			first = i;
+			break;
+		}
+	}
+	if (first == subAreaCount) {
+		for (uintptr_t i = 0; i < subAreaCount; i++) {
+			if (SubAreaEntry::init == _subAreaTable[i].state) {
+				first = i;
+				break;
+			}
+		}
+	}
+	if (first == subAreaCount) {
+		/* nothing to compact */
+		return;
+	}
+
+	/* every init sub area is followed by another sub area or by the end_segment of its region */
+	uintptr_t last = first;
+	uintptr_t windowSize = 0;
+	for (uintptr_t i = first; (i < subAreaCount) && (windowSize < _extensions->partialCompactSize); i++) {
+		if (SubAreaEntry::init == _subAreaTable[i].state) {
+			windowSize += (uintptr_t)_subAreaTable[i + 1].firstObject - (uintptr_t)_subAreaTable[i].firstObject;
+			last = i;
+		}
+	}
+
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		if ((SubAreaEntry::init == _subAreaTable[i].state) && ((i < first) || (i > last))) {
+			_subAreaTable[i].state = SubAreaEntry::fixup_only;
+		}
+	}
+
+	_compactFrom = _subAreaTable[first].firstObject;
+	_compactTo = _subAreaTable[last + 1].firstObject;
+	_partialCompactNext = _compactTo;
+	env->_compactStats._windowBytes = windowSize;
+}
+
 /**
  *  Complete setup for each sub area.
  */
@@ -545,6 +611,9 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* Aggressive compactions must free as much contiguous memory as they can, so they are never partial */
+		_partialCompact = !aggressive && (0 != _extensions->partialCompactSize);
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -563,7 +632,8 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	}
 
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
-	workerSetupForGC(env, singleThreaded);
+	/* A partial compaction needs several sub areas per segment to choose its window from */
+	workerSetupForGC(env, singleThreaded && !_partialCompact);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
 	/* If a single threaded compaction force compact to run on master thread. Required
@@ -665,7 +735,33 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 		poolState->_memoryPool = subAreaTable[i].memoryPool;
 
 		do {
-			if (NULL != subAreaTable[i].freeChunk) {
+			if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+				/* The sub area was fixed up in place. Its free entries are chained from freeChunk by
+				 * fixupSubAreaInPlace(), merge them with any free space adjacent to them.
+				 */
+				void *currentFreeTop = (void *)subAreaTable[i].firstObject;
+				MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)subAreaTable[i].freeChunk;
+				while (NULL != freeEntry) {
+					MM_HeapLinkedFreeHeader *nextFreeEntry = freeEntry->getNext();
+					if ((NULL != currentFreeBase) && ((void *)freeEntry != currentFreeTop)) {
+						currentFreeSize = (uintptr_t)currentFreeTop - (uintptr_t)currentFreeBase;
+						addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+						currentFreeBase = NULL;
+					}
+					if (NULL == currentFreeBase) {
+						currentFreeBase = (void *)freeEntry;
+					}
+					currentFreeTop = (void *)freeEntry->afterEnd();
+					freeEntry = nextFreeEntry;
+				}
+				/* A free entry reaching the next sub area may continue there */
+				if ((NULL != currentFreeBase) && (currentFreeTop != (void *)subAreaTable[i + 1].firstObject)) {
+					currentFreeSize = (uintptr_t)currentFreeTop - (uintptr_t)currentFreeBase;
+					addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, currentFreeSize);
+					currentFreeBase = NULL;
+				}
+				currentFreeSize = 0;
+			} else if (NULL != subAreaTable[i].freeChunk) {
 				if (subAreaTable[i].freeChunk == subAreaTable[i].firstObject) {
 					/* The entire sub area is free */
 					if (NULL == currentFreeBase) {
@@ -685,9 +781,7 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					currentFreeBase = (void *)subAreaTable[i].freeChunk;
 				}
 			} else {
-				/* Either there is no free area in the sub area or sub area is
-				 * a fixup_only sub area, i.e. IC is active
-				 */
+				/* There is no free area in the sub area */
 				if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
@@ -1214,6 +1308,20 @@ MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memo
 
 		assume0(!evacuate || objectSizeAfterMove <= deadObjectSize);
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		omrobjectptr_t remapDestination = NULL;
+		if (!evacuate && (objectSize == objectSizeAfterMove)) {
+			remapDestination = getRemapDestination(objectPtr, objectSize, deadObject);
+			if ((NULL != remapDestination) && (remapDestination != deadObject)) {
+				/* Sliding to a page boundary leaves a hole below the object, but lets its pages be remapped.
+				 * The object is the first one on its page so its forwarding pointer is recorded exactly.
+				 */
+				MM_HeapLinkedFreeHeader::fillWithHoles(deadObject, (uintptr_t)remapDestination - (uintptr_t)deadObject);
+				deadObject = remapDestination;
+			}
+		}
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+
 		/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
 		saveForwardingPtr(entry, objectPtr, deadObject, page, counter);
 
@@ -1240,7 +1348,19 @@ MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memo
 			memcpy(deadObject, objectPtr, objectSize);
 		} else {
 			//deadObjectSize = (uintptr_t)objectPtr - (uintptr_t)deadObject;
-			memmove(deadObject, objectPtr, objectSize);
+			uintptr_t remappedSize = 0;
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+			if (NULL != remapDestination) {
+				remappedSize = remapObject(objectPtr, objectSize, deadObject);
+				if (0 != remappedSize) {
+					MM_LargeObjectAllocateStats *stats = memorySubSpace->getMemoryPool(deadObject)->getLargeObjectAllocateStats();
+					if (NULL != stats) {
+						stats->remapObject(remappedSize);
+					}
+				}
+			}
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+			memmove((uint8_t *)deadObject + remappedSize, (uint8_t *)objectPtr + remappedSize, objectSize - remappedSize);
 		}
 
 #if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
@@ -1274,6 +1394,47 @@ MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memo
 	return objectPtr;
 }
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+omrobjectptr_t
+MM_CompactScheme::getRemapDestination(omrobjectptr_t objectPtr, uintptr_t objectSize, omrobjectptr_t deadObject)
+{
+	uintptr_t minimumSize = _extensions->largeObjectPageAlignedMinimumSize;
+	uintptr_t pageSize = _heap->getPageSize();
+
+	if ((0 == minimumSize) || (objectSize < minimumSize) || (objectSize < pageSize) || (0 != ((uintptr_t)objectPtr % pageSize))) {
+		return NULL;
+	}
+
+	omrobjectptr_t destination = (omrobjectptr_t)MM_Math::roundToCeiling(pageSize, (uintptr_t)deadObject);
+	uintptr_t distance = (uintptr_t)objectPtr - (uintptr_t)destination;
+	if ((0 == distance) || ((MM_Math::roundToFloor(pageSize, objectSize) / distance) >= COMPACT_REMAP_MAXIMUM_CHUNKS)) {
+		/* not moving, or moving too short a distance to be remapped in a few calls */
+		return NULL;
+	}
+
+	return destination;
+}
+
+uintptr_t
+MM_CompactScheme::remapObject(omrobjectptr_t objectPtr, uintptr_t objectSize, omrobjectptr_t destination)
+{
+	uintptr_t distance = (uintptr_t)objectPtr - (uintptr_t)destination;
+	uintptr_t remapSize = MM_Math::roundToFloor(_heap->getPageSize(), objectSize);
+	uintptr_t remappedSize = 0;
+
+	while (remappedSize < remapSize) {
+		uintptr_t chunkSize = OMR_MIN(distance, remapSize - remappedSize);
+		if (!_heap->remapMemory((void *)((uintptr_t)objectPtr + remappedSize), (void *)((uintptr_t)destination + remappedSize), chunkSize)) {
+			/* the rest of the object is still in place and is copied by the caller */
+			break;
+		}
+		remappedSize += chunkSize;
+	}
+
+	return remappedSize;
+}
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+
 omrobjectptr_t
 MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 {
@@ -1352,7 +1513,11 @@ MM_CompactScheme::fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCou
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-        		fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
+        		if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+        			fixupSubAreaInPlace(env, subAreaTable, i, objectCount);
+        		} else {
+        			fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i+1].firstObject, false, objectCount);
+        		}
 			}
         }
         /* Number of regions in regionTable, including
@@ -1397,6 +1562,50 @@ MM_CompactScheme::fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t first
 	}
 }
 
+void
+MM_CompactScheme::fixupSubAreaInPlace(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t& objectCount)
+{
+	omrobjectptr_t firstObject = subAreaTable[i].firstObject;
+	omrobjectptr_t finish = subAreaTable[i + 1].firstObject;
+	MM_MemoryPool *memoryPool = subAreaTable[i].memoryPool;
+	MM_HeapLinkedFreeHeader *freeListHead = NULL;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	void *freeBase = (void *)firstObject;
+
+	MM_CompactSchemeFixupObject fixupObject(env, this);
+
+	/* No marked object of this sub area starts on the page of the first object of the next sub area,
+	 * whose mark bits are overwritten by the compact table if the next sub area was compacted.
+	 */
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)firstObject, (uintptr_t *)pageStart(pageIndex(finish)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		objectCount++;
+		fixupObject.fixupObject(env, objectPtr);
+
+		/* Dead objects may refer to moved objects, so the space between live objects can not be left as it is */
+		if ((void *)objectPtr > freeBase) {
+			if (memoryPool->createFreeEntry(env, freeBase, objectPtr, previousFreeEntry, NULL)) {
+				if (NULL == freeListHead) {
+					freeListHead = (MM_HeapLinkedFreeHeader *)freeBase;
+				}
+				previousFreeEntry = (MM_HeapLinkedFreeHeader *)freeBase;
+			}
+		}
+		freeBase = (void *)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+
+	if ((void *)finish > freeBase) {
+		if (memoryPool->createFreeEntry(env, freeBase, finish, previousFreeEntry, NULL)) {
+			if (NULL == freeListHead) {
+				freeListHead = (MM_HeapLinkedFreeHeader *)freeBase;
+			}
+		}
+	}
+
+	subAreaTable[i].freeChunk = (omrobjectptr_t)freeListHead;
+}
+
 void
 MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 {
@@ -1412,7 +1621,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -131,6 +131,8 @@ protected:
     SubAreaEntry *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
+    bool _partialCompact; /**< true if the current compaction only evacuates a window of the sub areas */
+    omrobjectptr_t _partialCompactNext; /**< address the window of the next partial compaction starts from */
 public:
 
     /*
@@ -159,6 +161,14 @@ protected:
      */
     void setRealLimitsSubAreas(MM_EnvironmentStandard *env);
     void removeNullSubAreas(MM_EnvironmentStandard *env);
+
+    /**
+     * Restrict evacuation to a window of consecutive sub areas, turning all others into fixup_only sub areas.
+     *
+     * @param env[in] the current thread
+     * @param subAreaCount[in] the number of entries in the sub area table
+     */
+    void selectPartialCompactSubAreas(MM_EnvironmentStandard *env, uintptr_t subAreaCount);
     void completeSubAreaTable(MM_EnvironmentStandard *env);
 
     void saveForwardingPtr(class CompactTableEntry&,
@@ -176,6 +186,30 @@ protected:
                         uintptr_t &byteCount,
                         bool evacuate);
 
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+    /**
+     * Answer the page aligned address a page aligned large object should slide to so that its pages
+     * can be remapped rather than copied (see largeObjectPageAlignedMinimumSize).
+     *
+     * @param[in] objectPtr the object to be moved
+     * @param[in] objectSize the size of the object, before and after the move
+     * @param[in] deadObject the address the object would be copied to
+     * @return the page aligned destination, or NULL if the object should be copied to deadObject
+     */
+    omrobjectptr_t getRemapDestination(omrobjectptr_t objectPtr, uintptr_t objectSize, omrobjectptr_t deadObject);
+
+    /**
+     * Slide the whole pages of a page aligned object down to a page aligned destination by remapping
+     * them, in chunks no larger than the distance moved so that no chunk overlaps its destination.
+     *
+     * @param[in] objectPtr the object to be moved
+     * @param[in] objectSize the size of the object
+     * @param[in] destination the page aligned address the object is moved to
+     * @return the number of leading bytes of the object which were moved, the rest has to be copied
+     */
+    uintptr_t remapObject(omrobjectptr_t objectPtr, uintptr_t objectSize, omrobjectptr_t destination);
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
+
     /**
      * Attempt to evacuate objects from the specified subArea.
      *
@@ -207,6 +241,17 @@ protected:
      * @param[in/out] objectCount the number of objects fixed up (accumulated)
      */
     void fixupSubArea(MM_EnvironmentStandard *env, omrobjectptr_t firstObject, omrobjectptr_t finish,  bool markedOnly, uintptr_t& objectCount);
+
+    /**
+     * Fix up the live objects of a fixup_only subArea, and turn the dead space between them into free entries
+     * which are chained in address order from the freeChunk field of the subArea for rebuildFreelist()
+     *
+     * @param env[in] the current thread
+     * @param subAreaTable[in] the subArea table of the region which contains the subArea
+     * @param[in] i The subArea index
+     * @param[in/out] objectCount the number of objects fixed up (accumulated)
+     */
+    void fixupSubAreaInPlace(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t& objectCount);
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
     void rebuildFreelist(MM_EnvironmentStandard *env);
@@ -326,6 +371,8 @@ public:
         , _markMap(markingScheme->getMarkMap())
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
+    	, _partialCompact(false)
+    	, _partialCompactNext(NULL)
     {
     	_typeId = __FUNCTION__;
     }
@@ -27,6 +27,7 @@
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentCardTable.hpp"
 #include "Debug.hpp"
+#include "Dispatcher.hpp"
 #include "EnvironmentStandard.hpp"
 #include "Heap.hpp"
 #include "HeapMapIterator.hpp"
@@ -453,7 +454,8 @@ bool
 MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *envModron, MM_Heap *heap)
 {
 	MM_EnvironmentStandard* env = MM_EnvironmentStandard::getEnvironment(envModron);
-	bool initialized = MM_CardTable::initialize(env, heap);
+	bool initialized = MM_CardTable::initialize(env, heap)
+		&& _releasedChunksLock.initialize(env, &_extensions->lnrlOptions, "MM_ConcurrentCardTable:_releasedChunksLock");
 	if (initialized) {
 		J9HookInterface** mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
 	
@@ -531,6 +533,7 @@ MM_ConcurrentCardTable::tearDown(MM_EnvironmentBase *env)
 		env->getForge()->free(_cleaningRanges);
 		_cleaningRanges = NULL;
 	}
+	_releasedChunksLock.tearDown();
 	MM_CardTable::tearDown(env);
 }
 
@@ -653,7 +656,7 @@ MM_ConcurrentCardTable::prepareCardsForCleaning(MM_EnvironmentStandard *env)
 
 		_firstCardInPhase = getCardTableStart();
 		/* Provided we are not already out of free storage we clean cards up to start of free list */
-		_lastCardInPhase = (firstFree > 0 )? heapAddrToCardAddr(env, firstFree) : _lastCard;
+		_lastCardInPhase = (NULL != firstFree)? heapAddrToCardAddr(env, firstFree) : _lastCard;
 
 		/* Save so we can do analysis of re-dirtied cards in finalCleanCards */
 		_firstCardInPhase2= _lastCardInPhase;
@@ -896,6 +899,10 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentStandard *env, bool isMutator,
 			/* yes..so return to process the refs pushed so far */
 			break;
 		}
+
+		if ((0 != _extensions->fvtest_concurrentCardCleaningMaxCards) && (cardsCleaned >= _extensions->fvtest_concurrentCardCleaningMaxCards)) {
+			break;
+		}
 	}
 
 	/**
@@ -908,6 +915,9 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentStandard *env, bool isMutator,
  	incConcurrentCleanedCards(cardsCleaned, currentCleaningPhase);
 	env->_threadCleaningCards = false;
 
+	/* Let other threads take over any cards this thread claimed but did not get to */
+	releaseCardsForCleaning(env);
+
 	/* If we ran out of cards to clean ...*/
 	if (NULL == nextDirtyCard) {
         currentCleaningPhase = _cardCleanPhase;
@@ -1099,7 +1109,8 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentStandard *env, uintptr_t *
 
 		/* Have we pushed enough new refs ?*/
 		if (env->_workStack.getPushCount() >= maxPushes) {
-			/* yes..so return to process the refs pushed so far */
+			/* yes..so return to process the refs pushed so far, letting another thread carry on with our cards */
+			releaseCardsForCleaning(env);
 			break;
 		}
 	}
@@ -1570,6 +1581,10 @@ MM_ConcurrentCardTable::determineCleaningRanges(MM_EnvironmentStandard *env)
 			/* ... and initialize to byte after last active range */
 			_lastCleaningRange = nextRange;
 
+			/* Cards claimed from the previous ranges are no longer valid */
+			MM_AtomicOperations::add(&_cleaningEpoch, 1);
+			_firstKeptCard = NULL;
+
 			initDone = true;
 
 		}
@@ -1592,146 +1607,219 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentStandard *env)
 		range->nextCard = range->baseCard;
 	}
 
+	/* Cards claimed from the ranges before the reset are no longer valid */
+	MM_AtomicOperations::add(&_cleaningEpoch, 1);
+	_firstKeptCard = NULL;
+
 	MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange,
 															(uintptr_t)_currentCleaningRange,
 															(uintptr_t)_cleaningRanges);
 }
 
 /**
- * Get the next dirty card in card table.
- *
- * Find the next dirty card (as defined by cardmask) in the card table.
+ * Claim the next chunk of cards to be cleaned for the calling thread.
  *
- * @param cardMask - mask to apply to cards to identify those cards the caller
- * 					 is interested in
+ * Cards are handed out from the next card of the current cleaning range, up to the last
+ * card to be cleaned in the current phase. Concurrent cleaning hands out small chunks, as
+ * a thread may stop cleaning (and keep the rest of its chunk) at any time. Final card cleaning
+ * sizes chunks from the cards remaining in the range, so that chunks get smaller as the range
+ * is used up and all threads run out of work at about the same time.
+ * Chunks released by threads that stopped cleaning are taken over before any new cards are handed out.
  *
- * @return Routine either returns address of next dirty card, NULL if no
- * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
- * for exclusive VM access.
+ * @return TRUE if a chunk was claimed; FALSE if there are no more cards to clean in this phase
  */
-Card*
-MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean)
+bool
+MM_ConcurrentCardTable::claimCardsForCleaning(MM_EnvironmentStandard *env, bool concurrentCardClean)
 {
-	/* Get a local copy of next current range being cleaned */
-	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
-
-	/* Have we finished already ? */
-	if (currentRange >= _lastCleaningRange ) {
-		/* Yes..we are already done */
-		return NULL;
+	if ((0 != _releasedChunkCount) && takeReleasedCards(env)) {
+		return true;
 	}
 
-	/* Get a local copy of next card to check */
-	Card *firstCard = (Card *)currentRange->nextCard;
-
-	while (NULL != firstCard) {
+	uintptr_t cleaningEpoch = _cleaningEpoch;
+	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
 
-		/* The last card we will process is either last card in current range or
-		 * the last card to be cleaned in this phase of card cleaning.
-		 */
+	while (currentRange < _lastCleaningRange) {
 		/* CMVC 132231 - cache _lastCardInPhase since it's volatile and min reads its arguments twice */
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
-		Card *nextDirtyCard, *currentCard;
-
-		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
-
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
+		Card *firstCard = (Card *)currentRange->nextCard;
+
+		if (firstCard < lastCardToClean) {
+			uintptr_t remainingCards = (uintptr_t)(lastCardToClean - firstCard);
+			uintptr_t chunkCards = CARD_CLEANING_CHUNK_MINIMUM;
+			if (!concurrentCardClean) {
+				uintptr_t guidedCards = remainingCards / (_dispatcher->activeThreadCount() * CARD_CLEANING_CHUNKS_PER_THREAD);
+				chunkCards = OMR_MAX(chunkCards, MM_Math::roundToCeiling(sizeof(uintptr_t), guidedCards));
+			}
+			/* end the chunk on a uintptr_t boundary so the next one can be searched a slot at a time from its start */
+			Card *chunkTop = (Card *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)(firstCard + chunkCards));
+			if ((chunkTop <= firstCard) || (chunkTop > lastCardToClean)) {
+				chunkTop = lastCardToClean;
+			}
 
-				if (currentCard >= lastCardToClean) {
-					break;
-				}
+			/* If we fail then another thread claimed these cards first so retry from the new next card */
+			if (firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+																					(uintptr_t)firstCard,
+																					(uintptr_t)chunkTop)) {
+				env->_cardCleaningNext = firstCard;
+				env->_cardCleaningTop = chunkTop;
+				env->_cardCleaningEpoch = cleaningEpoch;
+				return true;
 			}
+			currentRange = (CleaningRange *)_currentCleaningRange;
+		} else if (lastCardToClean == currentRange->topCard) {
+			/* Range complete so switch to next cleaning range */
+			CleaningRange *nextRange = currentRange + 1;
+			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange, (uintptr_t)currentRange, (uintptr_t)nextRange);
+			currentRange = (CleaningRange *)_currentCleaningRange;
+		} else {
+			/* We have reached the last card to be processed in this phase of card cleaning */
+			return false;
+		}
+	}
+
+	/* All ranges processed */
+	return false;
+}
+
+/**
+ * Take over a chunk of cards released by a thread that stopped cleaning.
+ *
+ * @return TRUE if a chunk was taken; FALSE if there are no released chunks of the current cleaning epoch
+ */
+bool
+MM_ConcurrentCardTable::takeReleasedCards(MM_EnvironmentStandard *env)
+{
+	bool taken = false;
+
+	_releasedChunksLock.acquire();
+	uintptr_t cleaningEpoch = _cleaningEpoch;
+	if (_releasedChunksEpoch != cleaningEpoch) {
+		/* The cards were handed out again when the cleaning ranges were reset */
+		_releasedChunkCount = 0;
+		_releasedChunksEpoch = cleaningEpoch;
+	} else if (0 != _releasedChunkCount) {
+		_releasedChunkCount -= 1;
+		env->_cardCleaningNext = _releasedChunks[_releasedChunkCount].nextCard;
+		env->_cardCleaningTop = _releasedChunks[_releasedChunkCount].topCard;
+		env->_cardCleaningEpoch = cleaningEpoch;
+		taken = true;
+	}
+	_releasedChunksLock.release();
 
-			/* Have we found a card of interest yet ? */
-			if (0 == (*currentCard & cardMask)) {
-				/* No..so get next card. */
-				continue;
+	return taken;
+}
+
+/**
+ * Hand back the unfinished part of the chunk claimed by a thread that stops cleaning, so that
+ * other threads can take it over rather than leave it until this thread resumes cleaning (or
+ * until final card cleaning, if it never does). If there is no room for it, the thread keeps
+ * the chunk and its first card is remembered, so that its cards are known to be unfinished.
+ */
+void
+MM_ConcurrentCardTable::releaseCardsForCleaning(MM_EnvironmentStandard *env)
+{
+	Card *nextCard = env->_cardCleaningNext;
+	if ((nextCard < env->_cardCleaningTop) && (env->_cardCleaningEpoch == _cleaningEpoch)) {
+		bool released = false;
+
+		_releasedChunksLock.acquire();
+		uintptr_t cleaningEpoch = _cleaningEpoch;
+		if (env->_cardCleaningEpoch == cleaningEpoch) {
+			if (_releasedChunksEpoch != cleaningEpoch) {
+				_releasedChunkCount = 0;
+				_releasedChunksEpoch = cleaningEpoch;
+			}
+			if (_releasedChunkCount < CARD_CLEANING_RELEASED_CHUNKS) {
+				_releasedChunks[_releasedChunkCount].nextCard = nextCard;
+				_releasedChunks[_releasedChunkCount].topCard = env->_cardCleaningTop;
+				_releasedChunkCount += 1;
+				env->_cardCleaningNext = env->_cardCleaningTop;
+				_cardTableStats.incReleasedCleaningChunks();
+				released = true;
 			}
+		}
+		_releasedChunksLock.release();
+
+		if (!released) {
+			Card *firstKeptCard = _firstKeptCard;
+			while (((NULL == firstKeptCard) || (nextCard < firstKeptCard))
+				&& (firstKeptCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_firstKeptCard, (uintptr_t)firstKeptCard, (uintptr_t)nextCard))
+			) {
+				firstKeptCard = _firstKeptCard;
+			}
+		}
+	}
+}
 
-			/* Yes..so check to see if another thread got to next dirty card before us ? */
-			if (firstCard != (Card *)currentRange->nextCard) {
-				/* Yes..so re-sync with race winner and start scan again */
-				break;
-			} else {
-				/* No .. so attempt to grab this card*/
-				nextDirtyCard = currentCard;
-				currentCard += 1;
+/**
+ * Find the first card that was not yet handed out for cleaning, or was handed out but not cleaned.
+ * Cards of the ranges before the current cleaning range have all been handed out, so only the
+ * chunks released or kept by threads that stopped cleaning can be unfinished below its next card.
+ * To be called only while no thread is cleaning cards.
+ *
+ * @return the first unfinished card, or _lastCard if all cards are cleaned
+ */
+Card *
+MM_ConcurrentCardTable::getFirstUnfinishedCard()
+{
+	Card *firstCard = _lastCard;
+
+	if (_currentCleaningRange < _lastCleaningRange) {
+		firstCard = OMR_MIN(firstCard, (Card *)_currentCleaningRange->nextCard);
+	}
+	if (_releasedChunksEpoch == _cleaningEpoch) {
+		for (uintptr_t i = 0; i < _releasedChunkCount; i++) {
+			firstCard = OMR_MIN(firstCard, _releasedChunks[i].nextCard);
+		}
+	}
+	if (NULL != _firstKeptCard) {
+		firstCard = OMR_MIN(firstCard, (Card *)_firstKeptCard);
+	}
+
+	return firstCard;
+}
+
+/**
+ * Get the next dirty card in card table.
+ *
+ * Find the next dirty card (as defined by cardmask) in the chunk of cards claimed by
+ * the calling thread, claiming further chunks as required. Each thread searches its own
+ * chunk, so the only shared update is the claim of a chunk.
+ *
+ * @param cardMask - mask to apply to cards to identify those cards the caller
+ * 					 is interested in
+ *
+ * @return Routine either returns address of next dirty card, NULL if no
+ * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
+ * for exclusive VM access.
+ */
+Card*
+MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean)
+{
+	do {
+		/* A chunk claimed before the cleaning ranges were last reset is stale; its cards are handed out again */
+		if (env->_cardCleaningEpoch == _cleaningEpoch) {
+			Card *topCard = env->_cardCleaningTop;
+			Card *nextDirtyCard = findDirtyCard(env->_cardCleaningNext, topCard, cardMask);
+			if (nextDirtyCard < topCard) {
 				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
+					/* leave the card to be found again if this thread resumes cleaning */
+					env->_cardCleaningNext = nextDirtyCard;
 					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
 				}
-
-				/* Update next card to clean for next caller of getNextDirtyCard. If we fail
-				 * then someone beat us to it so re-sync with race winner and start again
-				 */
-				if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-											  							  (uintptr_t)firstCard,
-											  							  (uintptr_t)currentCard)) {
-					break;
-				}
-				
+				env->_cardCleaningNext = nextDirtyCard + 1;
 				return nextDirtyCard;
 			}
-		} /* of currentCard < lastCardToClean */
-
-		/* We get here if we break out of FOR loop when another thread beat us to next
-		 * dirty card or we reach then end of the card table.
-		 *
-		 * Did we reach end of card table segment ?
-		 */
-		if (currentCard < lastCardToClean) {
-			/* No..so someone must have beat us to next dirty card. In which case we need
-			 * to restart scan. First though make sure no thread is waiting for exclusive access.
-			 */
-			if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
-				return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
-			}
-
-			firstCard = (Card *)currentRange->nextCard;
-		} else if (currentCard >= currentRange->topCard) {
-			assume0(currentCard == currentRange->topCard);
-			/* Range complete so set nextCard of cleaning range to top card to show cleaning range finsished */
-			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard, (uintptr_t)currentRange->nextCard, (uintptr_t)currentRange->topCard);
-			
-			/* Switch to next cleaning range */
-			CleaningRange *nextRange =  currentRange + 1;
-			MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_currentCleaningRange, (uintptr_t)currentRange, (uintptr_t)nextRange);
+			env->_cardCleaningNext = topCard;
+		}
 
-			currentRange = (CleaningRange *)_currentCleaningRange;
-			firstCard = currentRange < _lastCleaningRange ? (Card *)currentRange->nextCard : (Card *)NULL;
-		} else {
-			/* We have reached the last card to be processed in this phase
-			 * of card cleaning. We must update _next card to clean so when we start to clean
-			 * cards in next phase we start at last card in this phase. If we fail then
-			 * another thread beat us to it
-			 */
-			if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
-										  							  (uintptr_t)firstCard,
-										  							  (uintptr_t)currentCard)) {
-			}
-			return NULL;
+		if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
+			return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
 		}
-	}
+	} while (claimCardsForCleaning(env, concurrentCardClean));
 
-	/* All ranges processed, no more dirty cards */
+	/* No more dirty cards */
 	return NULL;
 }
 
@@ -27,6 +27,9 @@
 #include "Debug.hpp"
 #include "EnvironmentStandard.hpp"
 #include "GCExtensionsBase.hpp"
+#include "HeapMapWordScan.hpp"
+#include "LightweightNonReentrantLock.hpp"
+#include "Math.hpp"
 #include "MemoryManager.hpp"
 
 /**
@@ -62,6 +65,13 @@
 #define FINAL_CARD_CLEAN_MASK (CARD_DIRTY)
 
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
+
+/* Cleaning threads claim cards in chunks of at least this many cards (a multiple of sizeof(uintptr_t)) */
+#define CARD_CLEANING_CHUNK_MINIMUM ((uintptr_t)512)
+/* Final card cleaning hands each thread about 1/CARD_CLEANING_CHUNKS_PER_THREAD of its share of the remaining cards at a time */
+#define CARD_CLEANING_CHUNKS_PER_THREAD ((uintptr_t)4)
+/* Number of unfinished chunks that threads which stop cleaning can hand back, for other threads to take over */
+#define CARD_CLEANING_RELEASED_CHUNKS ((uintptr_t)64)
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
  
 /**
@@ -132,6 +142,11 @@ typedef struct {
 	uintptr_t numCards;
 } CleaningRange;
 
+typedef struct {
+	Card *nextCard;
+	Card *topCard;
+} CleaningChunk;
+
 /**
  * @todo Provide class documentation
  * @warn All card table functions assume EXCLUSIVE ranges, ie they take a base and top card where base card
@@ -162,6 +177,12 @@ protected:
 	CleaningRange * volatile _currentCleaningRange;
 	CleaningRange *_lastCleaningRange;
 	uintptr_t _maxCleaningRanges;
+	volatile uintptr_t _cleaningEpoch; /**< incremented whenever the cleaning ranges are reset, which invalidates all cards claimed by threads */
+	MM_LightweightNonReentrantLock _releasedChunksLock; /**< protects the released chunks */
+	CleaningChunk _releasedChunks[CARD_CLEANING_RELEASED_CHUNKS]; /**< unfinished chunks handed back by threads that stopped cleaning */
+	volatile uintptr_t _releasedChunkCount; /**< number of entries of _releasedChunks in use */
+	uintptr_t _releasedChunksEpoch; /**< cleaning epoch of the released chunks; they are discarded once it is stale */
+	Card * volatile _firstKeptCard; /**< lowest card of the unfinished chunks that could not be released, or NULL if there are none */
 	
 	Card _concurrentCardCleanMask;
 	Card _finalCardCleanMask;
@@ -227,6 +248,37 @@ protected:
 	
 	bool cleanSingleCard(MM_EnvironmentStandard *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
 	Card* getNextDirtyCard(MM_EnvironmentStandard *env, Card cardMask, bool concurrentCardClean);
+	bool claimCardsForCleaning(MM_EnvironmentStandard *env, bool concurrentCardClean);
+	bool takeReleasedCards(MM_EnvironmentStandard *env);
+	void releaseCardsForCleaning(MM_EnvironmentStandard *env);
+	Card *getFirstUnfinishedCard();
+
+	/**
+	 * Find the first card of interest in a range of cards. Clean cards are skipped a vector (or at least
+	 * a uintptr_t) at a time, on the premise that the card table is mostly clean.
+	 * @param card first card to examine
+	 * @param topCard end of the range (exclusive)
+	 * @param cardMask mask identifying the cards of interest
+	 * @return the first card of interest, or topCard if there is none in the range
+	 */
+	MMINLINE static Card *
+	findDirtyCard(Card *card, Card *topCard, Card cardMask)
+	{
+		Card *lastSlotCard = (Card *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)topCard);
+		while (card < topCard) {
+			if ((0 == ((uintptr_t)card % sizeof(uintptr_t))) && (card < lastSlotCard)) {
+				card = (Card *)MM_HeapMapWordScan::skipEmptyWords((uintptr_t *)card, (uintptr_t *)lastSlotCard);
+				if (card >= topCard) {
+					break;
+				}
+			}
+			if (0 != (*card & cardMask)) {
+				return card;
+			}
+			card += 1;
+		}
+		return topCard;
+	}
 	
 	bool cardHasMarkedObjects(MM_EnvironmentStandard *env, Card *card);
 	
@@ -489,6 +541,11 @@ public:
 		_currentCleaningRange(NULL),
 		_lastCleaningRange(NULL),
 		_maxCleaningRanges(0),
+		_cleaningEpoch(0),
+		_releasedChunksLock(),
+		_releasedChunkCount(0),
+		_releasedChunksEpoch(0),
+		_firstKeptCard(NULL),
 		_lastCard(NULL),
 		_firstCardInPhase(NULL),
 		_lastCardInPhase(NULL),
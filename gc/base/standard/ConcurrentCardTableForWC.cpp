@@ -419,13 +419,16 @@ MM_ConcurrentCardTableForWC::initializeFinalCardCleaning(MM_EnvironmentStandard
 {
 	/* Did we get as far as preparing the card table for cleaning ? */
 	if (_cardTablePreparedForCleaning ) {
-		/* Yes..So we must reverse any cards that got prepared */
-		if (_currentCleaningRange < _lastCleaningRange) {
+		/* Yes..So we must reverse any cards that got prepared but were not cleaned. Chunks that
+		 * threads stopped cleaning part way through may lie behind the next card of the current range.
+		 */
+		Card *firstUnfinishedCard = getFirstUnfinishedCard();
+		if (firstUnfinishedCard < _lastCard) {
 			/* Get assistance from all gc slave threads to do the work */ 
 			MM_ConcurrentPrepareCardTableTask prepareCardTableTask(env, 
 																  _dispatcher,
 																  this,
-																  (Card *)_currentCleaningRange->nextCard,
+																  firstUnfinishedCard,
 																  _lastCard,
 																  MARK_SAFE_CARD_DIRTY); 
 			_dispatcher->run(env, &prepareCardTableTask);
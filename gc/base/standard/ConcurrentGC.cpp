@@ -354,6 +354,7 @@ MM_ConcurrentGC::reportConcurrentCollectionStart(MM_EnvironmentStandard *env)
 			_stats->getMutatorsTraced(),
 			_stats->getConHelperTraced(),
 			cardTable->getCardTableStats()->getConcurrentCleanedCards(),
+			cardTable->getCardTableStats()->getReleasedCleaningChunks(),
 			_stats->getCardCleaningThreshold(),
 			_stats->getConcurrentWorkStackOverflowOcurred(),
 			_stats->getConcurrentWorkStackOverflowCount(),
@@ -1140,6 +1141,15 @@ MM_ConcurrentGC::conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t slaveID)
 			request = getConHelperRequest(env);
 		}
 
+		/* Under background mark mutators rarely trace, so the helpers must start card cleaning once tracing runs out */
+		if (isBackgroundMark()
+				&& (CONCURRENT_HELPER_MARK == request)
+				&& (CONCURRENT_TRACE_ONLY == _stats->getExecutionMode())
+				&& (_markingScheme->getWorkPackets()->tracingExhausted() || tracingRateDropped(env))
+				&& _stats->isRootTracingComplete()) {
+			kickoffCardCleaning(env, TRACING_COMPLETED);
+		}
+
 		spinLimiter.reset();
 
 		/* clean cards */
@@ -1508,6 +1518,7 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentStandard *env)
 	_pass2Started = false;
 
 	_alloc2ConHelperTraceRate = 0;
+	_conHelperTraceRateMeasured = false;
 	_lastConHelperTraceSizeCount = 0;
 	_lastAverageAlloc2TraceRate = 0;
 	_maxAverageAlloc2TraceRate = 0;
@@ -1764,27 +1775,39 @@ MM_ConcurrentGC::calculateTraceSize(MM_EnvironmentStandard *env, MM_AllocateDesc
 
 		thisTraceRate = (float)((traceTarget - workCompleteSoFar) / (float)(remainingFree));
 
-		if ( thisTraceRate > _allocToTraceRate) {
-	    /* The "over tracing" should not only adjust to the current ratio between
-	     * free space and estimated remaining tracing, but also try to do even more tracing, in
-	     * order to correct the ratio back to the required alloc to trace rate.
-	     */
-	    	thisTraceRate += ((thisTraceRate - _allocToTraceRate) * OVER_TRACING_BOOST_FACTOR);
-			/* Make sure its not now greater than max */
-			if(thisTraceRate > getAllocToTraceRateMax()) {
-				thisTraceRate = getAllocToTraceRateMax();
+		/* Under background mark the rate is not boosted, so the mutator is only taxed for the shortfall
+		 * between the work the helpers were measured to do per byte allocated (_alloc2ConHelperTraceRate,
+		 * see periodicalTuning()) and the rate needed to finish before free space runs out. It pays
+		 * nothing while the helpers keep up with allocation, or until the first tuning interval of the
+		 * cycle has measured them.
+		 */
+		if (isBackgroundMark()) {
+			if (!_conHelperTraceRateMeasured) {
+				return 0;
+			}
+		} else {
+			if ( thisTraceRate > _allocToTraceRate) {
+		    /* The "over tracing" should not only adjust to the current ratio between
+		     * free space and estimated remaining tracing, but also try to do even more tracing, in
+		     * order to correct the ratio back to the required alloc to trace rate.
+		     */
+		    	thisTraceRate += ((thisTraceRate - _allocToTraceRate) * OVER_TRACING_BOOST_FACTOR);
+				/* Make sure its not now greater than max */
+				if(thisTraceRate > getAllocToTraceRateMax()) {
+					thisTraceRate = getAllocToTraceRateMax();
+				}
+			} else 	if(thisTraceRate < getAllocToTraceRateMin()) {
+				thisTraceRate = getAllocToTraceRateMin();
 			}
-		} else 	if(thisTraceRate < getAllocToTraceRateMin()) {
-			thisTraceRate = getAllocToTraceRateMin();
-		}
 
-		if(_forcedKickoff) {
-			/* in case of external kickoff use at least default trace rate */
-			if( thisTraceRate < getAllocToTraceRateNormal()) {
-				thisTraceRate = getAllocToTraceRateNormal();
+			if(_forcedKickoff) {
+				/* in case of external kickoff use at least default trace rate */
+				if( thisTraceRate < getAllocToTraceRateNormal()) {
+					thisTraceRate = getAllocToTraceRateNormal();
+				}
 			}
-		} 
-		
+		}
+
 		/* Provided background thread is not already doing enough tracing ....*/
 		if (thisTraceRate > _alloc2ConHelperTraceRate) {
 			/* ..calculate tax for mutator taking into account any tracing being done by concurrent helpers */
@@ -1968,9 +1991,15 @@ MM_ConcurrentGC::periodicalTuning(MM_EnvironmentStandard *env, uintptr_t freeSiz
 			uintptr_t conTraced = _stats->getConHelperTraceSizeCount() +  _stats->getConHelperCardCleanCount();
 			newConHelperRate =  (float)(conTraced - _lastConHelperTraceSizeCount) / (float) (freeSpaceUsed);
 			_lastConHelperTraceSizeCount = conTraced;
-			_alloc2ConHelperTraceRate = MM_Math::weightedAverage(_alloc2ConHelperTraceRate,
-														newConHelperRate,
-														CONCURRENT_HELPER_HISTORY_WEIGHT);
+			if (isBackgroundMark() && !_conHelperTraceRateMeasured) {
+				/* the helpers were left all the work of the first interval, so there is no history to average with */
+				_alloc2ConHelperTraceRate = newConHelperRate;
+			} else {
+				_alloc2ConHelperTraceRate = MM_Math::weightedAverage(_alloc2ConHelperTraceRate,
+															newConHelperRate,
+															CONCURRENT_HELPER_HISTORY_WEIGHT);
+			}
+			_conHelperTraceRateMeasured = true;
 
 			totalTraced += conTraced;
 		}
@@ -2119,7 +2148,10 @@ MM_ConcurrentGC::concurrentMark(MM_EnvironmentStandard *env, MM_MemorySubSpace *
 		case CONCURRENT_TRACE_ONLY:
 		case CONCURRENT_CLEAN_TRACE:
 			sizeToTrace = calculateTraceSize(env, allocDescription);
-			if (sizeToTrace > 0) {
+			/* Under background mark a mutator which pays no tax still scans its stack, advances the
+			 * execution mode and resumes the helpers
+			 */
+			if ((sizeToTrace > 0) || isBackgroundMark()) {
 				sizeTraced = doConcurrentTrace(env, allocDescription, sizeToTrace, subspace, threadAtSafePoint);
 			}
 
@@ -254,6 +254,7 @@ private:
 	/* Background helper thread statistics */	
 	uintptr_t _lastConHelperTraceSizeCount;
 	float _alloc2ConHelperTraceRate; 
+	bool _conHelperTraceRateMeasured; /**< true once a tuning interval of this cycle has measured _alloc2ConHelperTraceRate */
 	
 	/* Concurrent card cleaning statistics */
 	float _cardCleaningFactorPass1;
@@ -279,6 +280,10 @@ private:
 	MMINLINE float getAllocToTraceRateMin() { return (float)(_allocToTraceRate * _allocToTraceRateMinFactor);};
 	MMINLINE float getAllocToTraceRateMax() { return (float)(_allocToTraceRate * _allocToTraceRateMaxFactor);};
 	MMINLINE float getAllocToTraceRateNormal() { return (float)_allocToTraceRateNormal;};
+	/**
+	 * @return true if concurrent marking is left to the background helpers, which needs at least one helper to be started
+	 */
+	MMINLINE bool isBackgroundMark() { return _extensions->concurrentBackgroundMark && (0 < _conHelpersStarted); };
 	
 	float interpolateInRange(float, float, float, uintptr_t);
 	void determineInitWork(MM_EnvironmentStandard *env);
@@ -508,6 +513,7 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_conHelperTraceRateMeasured(false)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_concurrentCycleState()
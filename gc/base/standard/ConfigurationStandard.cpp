@@ -169,7 +169,7 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	}
 
 	if (extensions->largeObjectArea) {
-		MM_MemoryPoolAddressOrderedListBase* memoryPoolLargeObjects = NULL;
+		MM_MemoryPoolAddressOrderedList* memoryPoolLargeObjects = NULL;
 		MM_MemoryPoolAddressOrderedListBase* memoryPoolSmallObjects = NULL;
 
 		/* create memory pools for SOA and LOA */
@@ -188,6 +188,7 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 			memoryPoolSmallObjects->kill(env);
 			return NULL;
 		}
+		memoryPoolLargeObjects->setPageAlignedAllocation(extensions->largeObjectPageAlignedMinimumSize, extensions->heap->getPageSize());
 
 		if (appendCollectorLargeAllocateStats) {
 			memoryPoolLargeObjects->appendCollectorLargeAllocateStats();
@@ -28,6 +28,7 @@
 #include "j9nongenerated.h"
 #include "omrport.h"
 #include "modronopt.h"
+#include "omrmodroncore.h"
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -54,9 +55,14 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _scavengerNodeIndex; /**< index of the NUMA node whose scan list and copy destinations this thread uses during a scavenge */
+	uintptr_t _hotFieldCopyDepth; /**< number of hot field copies currently nested on this thread's stack during a scavenge */
 
 	/* TODO: Temporary hiding place for thread specific GC structures */
 	bool _threadCleaningCards;
+	Card *_cardCleaningNext; /**< next card to search in the range of cards this thread has claimed for cleaning */
+	Card *_cardCleaningTop; /**< end (exclusive) of the range of cards this thread has claimed for cleaning */
+	uintptr_t _cardCleaningEpoch; /**< card table cleaning epoch in which the claimed range was handed out */
 
 protected:
 
@@ -82,7 +88,12 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_scavengerNodeIndex(0)
+		,_hotFieldCopyDepth(0)
 		,_threadCleaningCards(false)
+		,_cardCleaningNext(NULL)
+		,_cardCleaningTop(NULL)
+		,_cardCleaningEpoch(0)
 	{
 		_typeId = __FUNCTION__;
 	}
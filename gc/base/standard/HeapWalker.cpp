@@ -25,13 +25,18 @@
 #include "Dispatcher.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "ObjectIterator.hpp"
 #include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalkTask.hpp"
 #include "SlotObject.hpp"
 #include "SublistIterator.hpp"
 #include "SublistSlotIterator.hpp"
@@ -185,11 +190,19 @@ MM_HeapWalker::allObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlotFunc f
 }
 
 /**
- * Walk all objects in the heap in a single threaded linear fashion.
+ * Walk all objects in the heap in a linear fashion.
+ * If parallel is set the caller is one of the threads of a parallel task, and the heap is divided between
+ * the threads as by parallelAllObjectsDo(). The caches of the mutator threads must then have been flushed
+ * before the task started.
  */
 void
 MM_HeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk)
 {
+	if (parallel) {
+		parallelAllObjectsDo(env, function, userData, walkFlags);
+		return;
+	}
+
 	uintptr_t typeFlags = 0;
 
 	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
@@ -216,3 +229,123 @@ MM_HeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc fun
 		}
 	}
 }
+
+/**
+ * Find the first marked object starting in [base, top), or NULL if there is none.
+ */
+static MMINLINE omrobjectptr_t
+firstMarkedObject(MM_GCExtensionsBase *extensions, MM_MarkMap *markMap, void *base, void *top)
+{
+	MM_HeapMapIterator markedObjectIterator(extensions, markMap, (uintptr_t *)base, (uintptr_t *)top, false);
+	return markedObjectIterator.nextObject();
+}
+
+/**
+ * Walk this thread's share of the objects of the heap. The caller is one of the threads of a parallel task,
+ * and the caches of the mutator threads must have been flushed before the task started.
+ *
+ * Old regions are divided into chunks of parSweepChunkSize bytes, as the sweep divides them. The heap keeps no
+ * record of where the objects in a chunk start, so the work unit of a chunk begins at the first marked object
+ * in it and ends at the first marked object of a later chunk, or at the top of the region. The first unit of a
+ * region begins at its base. A chunk without marked objects adds nothing to the walk; its objects belong to the
+ * unit of the chunk before it.
+ * This relies on the set bits of the mark map being object starts (@see MM_ParallelGlobalGC::markMapHoldsObjectStarts()),
+ * which does not hold for new regions, nor after a compaction until the next mark has completed. Those regions,
+ * and the whole heap in that case, are walked a region at a time.
+ *
+ * @return the number of work units this thread walked
+ */
+uintptr_t
+MM_HeapWalker::parallelAllObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags)
+{
+	uintptr_t typeFlags = 0;
+	uintptr_t workUnitCount = 0;
+
+	if (walkFlags & J9_MU_WALK_NEW_AND_REMEMBERED_ONLY) {
+		typeFlags |= MEMORY_TYPE_NEW;
+	}
+
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MarkMap *markMap = NULL;
+	uintptr_t chunkSize = extensions->parSweepChunkSize;
+	if (extensions->isStandardGC() && (0 != chunkSize)) {
+		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+		if (globalCollector->markMapHoldsObjectStarts()) {
+			markMap = globalCollector->getMarkingScheme()->getMarkMap();
+		}
+	}
+
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (typeFlags != (region->getTypeFlags() & typeFlags)) {
+			continue;
+		}
+		uintptr_t regionLow = (uintptr_t)region->getLowAddress();
+		uintptr_t regionHigh = (uintptr_t)region->getHighAddress();
+		uintptr_t unitSize = regionHigh - regionLow;
+		if ((NULL != markMap) && (0 == (region->getTypeFlags() & MEMORY_TYPE_NEW))) {
+			unitSize = chunkSize;
+		}
+
+		for (uintptr_t chunkBase = regionLow; chunkBase < regionHigh; chunkBase += unitSize) {
+			if (!J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				continue;
+			}
+			uintptr_t chunkTop = OMR_MIN(chunkBase + unitSize, regionHigh);
+			omrobjectptr_t unitBase = (omrobjectptr_t)chunkBase;
+			omrobjectptr_t unitTop = (omrobjectptr_t)regionHigh;
+			if (chunkBase != regionLow) {
+				unitBase = firstMarkedObject(extensions, markMap, (void *)chunkBase, (void *)chunkTop);
+			}
+			if (NULL == unitBase) {
+				continue;
+			}
+			if (chunkTop != regionHigh) {
+				omrobjectptr_t nextUnitBase = firstMarkedObject(extensions, markMap, (void *)chunkTop, (void *)regionHigh);
+				if (NULL != nextUnitBase) {
+					unitTop = nextUnitBase;
+				}
+			}
+
+			/* Optimization to avoid virtual dispatch for every slot in the system */
+			omrobjectptr_t object = NULL;
+			GC_ObjectHeapIteratorAddressOrderedList liveObjectIterator(extensions, unitBase, unitTop, false);
+
+			while (NULL != (object = liveObjectIterator.nextObject())) {
+				function(omrVMThread, region, object, userData);
+			}
+			workUnitCount += 1;
+		}
+	}
+
+	return workUnitCount;
+}
+
+/**
+ * Walk all objects in the heap on all GC threads. The caller must have exclusive access to the heap, outside
+ * of a collection.
+ * The heap is divided into work units as by parallelAllObjectsDo(), which are handed out to the threads as
+ * they finish the previous one.
+ * Each thread calls threadStart (if not NULL) with userData before it walks, and passes the context it
+ * returns to function for every object it walks; without threadStart the context is userData. When its
+ * share of the heap has been walked the thread calls threadEnd (if not NULL) with userData and its context.
+ * threadEnd is called concurrently on several threads, so it must synchronize any shared state it updates.
+ *
+ * @return the number of work units walked
+ */
+uintptr_t
+MM_HeapWalker::parallelObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, MM_HeapWalkerThreadStartFunc threadStart, MM_HeapWalkerThreadEndFunc threadEnd, void *userData, uintptr_t walkFlags)
+{
+	MM_Dispatcher *dispatcher = env->getExtensions()->dispatcher;
+
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+
+	MM_ParallelHeapWalkTask walkTask(env, dispatcher, this, function, threadStart, threadEnd, userData, walkFlags);
+	dispatcher->run(env, &walkTask);
+
+	return walkTask.getWorkUnitCount();
+}
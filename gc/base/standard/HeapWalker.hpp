@@ -32,6 +32,8 @@ class MM_MemorySubSpace;
 
 typedef void (*MM_HeapWalkerObjectFunc)(OMR_VMThread *, MM_HeapRegionDescriptor *, omrobjectptr_t, void *);
 typedef void (*MM_HeapWalkerSlotFunc)(OMR_VM *, omrobjectptr_t *, void *, uint32_t);
+typedef void *(*MM_HeapWalkerThreadStartFunc)(OMR_VMThread *, void *);
+typedef void (*MM_HeapWalkerThreadEndFunc)(OMR_VMThread *, void *, void *);
 
 class MM_HeapWalker : public MM_BaseVirtual
 {
@@ -45,6 +47,8 @@ protected:
 public:
 	virtual void allObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlotFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
+	uintptr_t parallelAllObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags);
+	uintptr_t parallelObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, MM_HeapWalkerThreadStartFunc threadStart, MM_HeapWalkerThreadEndFunc threadEnd, void *userData, uintptr_t walkFlags);
 
 	static MM_HeapWalker *newInstance(MM_EnvironmentBase *env); 	
 	virtual void kill(MM_EnvironmentBase *env);
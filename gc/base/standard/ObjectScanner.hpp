@@ -164,6 +164,31 @@ public:
 		return NULL;
 	}
 
+	/**
+	 * Get the next non-NULL slot marked in the hot fields descriptor, if one is available. Bit n of the
+	 * descriptor maps to the n-th slot after the first slot of the object, so this must be used on a
+	 * freshly initialized scanner and not mixed with getNextSlot(). The descriptor is consumed as the
+	 * slots are returned.
+	 *
+	 * @return a pointer to a slot object encapsulating the next hot object slot, or NULL if no next hot slot
+	 */
+	MMINLINE GC_SlotObject *
+	getNextHotSlot()
+	{
+		while (0 != _hotFieldsDescriptor) {
+			fomrobject_t *slotPtr = _scanPtr;
+			bool isHot = (0 != (1 & _hotFieldsDescriptor));
+			_scanPtr += 1;
+			_hotFieldsDescriptor >>= 1;
+			if (isHot && (0 != *slotPtr)) {
+				_slotObject.writeAddressToSlot(slotPtr);
+				return &_slotObject;
+			}
+		}
+
+		return NULL;
+	}
+
 	/**
 	 * Informational, relating to scanning context (_flags)
 	 */
@@ -261,6 +261,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 
 	/* Mark */	
 	markAll(env, initMarkMap);
+	_markMapHoldsObjectStarts = true;
 
 	masterThreadReportObjectEvents(env);
 
@@ -281,6 +282,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 		}
 
 		masterThreadCompact(env, allocDescription, rebuildMarkBits);
+		_markMapHoldsObjectStarts = rebuildMarkBits;
 		_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
 	} else {
 		/* If a compaction was prevented, report the reason */
@@ -726,6 +728,18 @@ MM_ParallelGlobalGC::masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDes
 	MM_ParallelCompactTask compactTask(env, _dispatcher, _compactScheme, rebuildMarkBits, env->_cycleState->_gcCode.shouldAggressivelyCompact());
 	_dispatcher->run(env, &compactTask);
 	compactStats->_endTime = omrtime_hires_clock();
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+	if (0 != _extensions->largeObjectPageAlignedMinimumSize) {
+		/* the pools were reset when the compaction started, so their stats only count the objects it remapped */
+		MM_MemoryPool *memoryPool = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
+		memoryPool->mergeLargeObjectAllocateStats();
+		MM_LargeObjectAllocateStats *stats = memoryPool->getLargeObjectAllocateStats();
+		if (NULL != stats) {
+			compactStats->_remappedObjects = stats->getRemappedObjectCount();
+			compactStats->_remappedBytes = stats->getRemappedBytes();
+		}
+	}
+#endif /* defined(OMR_GC_LARGE_OBJECT_AREA) */
 	reportCompactEnd(env);
 	
 	/* Remember the gc count of the last compaction */ 
@@ -810,6 +824,8 @@ MM_ParallelGlobalGC::internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSp
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	_markingScheme->setMarkMap(objectMap->getObjectMap());
 	objectMap->setMarkMap(markMap);
+	/* the mark map swapped in was last used as the object map */
+	_markMapHoldsObjectStarts = false;
 #endif
 
 	env->_cycleState->_activeSubSpace = NULL;
@@ -1183,7 +1199,9 @@ MM_ParallelGlobalGC::completeConcurrentCycle(MM_EnvironmentBase *env)
 {
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/* ParallelGlobalGC or ConcurrentGC (STW phase) cannot start before Concurrent Scavenger cycle is in progress */
-	_extensions->scavenger->completeConcurrentScavenger(env);
+	if (NULL != _extensions->scavenger) {
+		_extensions->scavenger->completeConcurrentScavenger(env);
+	}
 #endif
 }
 
@@ -54,6 +54,7 @@ protected:
 
 private:
 	OMRPortLibrary *_portLibrary;
+	bool _markMapHoldsObjectStarts; /**< every set bit of the mark map is the start of an object, from the end of a mark until compaction reuses the mark map */
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactScheme *_compactScheme;
@@ -291,6 +292,17 @@ public:
 	{
 		return _markingScheme;
 	}
+
+	/**
+	 * Outside of a collection, a set bit of the mark map is the start of an object in an old region once a mark has
+	 * completed, until a compaction stores its tables in the mark map. A mark map cleared for the next collection
+	 * only holds fewer of them. Objects in new regions move at every scavenge, so their bits go stale.
+	 * @return true if the set bits of the mark map in old regions are object starts
+	 */
+	bool markMapHoldsObjectStarts()
+	{
+		return _markMapHoldsObjectStarts;
+	}
 	
 #if defined(OMR_GC_MODRON_COMPACTION)
 	MM_CompactScheme *
@@ -305,6 +317,7 @@ public:
 		: MM_GlobalCollector(env, cli)
 		, _extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM()))
 		, _portLibrary(env->getPortLibrary())
+		, _markMapHoldsObjectStarts(false)
 #if defined(OMR_GC_MODRON_COMPACTION)
 		, _compactScheme(NULL)
 		, _compactThisCycle(false)
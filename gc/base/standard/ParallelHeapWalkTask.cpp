@@ -0,0 +1,42 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+
+#include "ParallelHeapWalkTask.hpp"
+
+void
+MM_ParallelHeapWalkTask::run(MM_EnvironmentBase *env)
+{
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+	void *threadUserData = _userData;
+
+	if (NULL != _threadStart) {
+		threadUserData = _threadStart(omrVMThread, _userData);
+	}
+
+	uintptr_t workUnitCount = _heapWalker->parallelAllObjectsDo(env, _function, threadUserData, _walkFlags);
+	MM_AtomicOperations::add(&_workUnitCount, workUnitCount);
+
+	if (NULL != _threadEnd) {
+		_threadEnd(omrVMThread, _userData, threadUserData);
+	}
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(PARALLELHEAPWALKTASK_HPP_)
+#define PARALLELHEAPWALKTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "HeapWalker.hpp"
+#include "ParallelTask.hpp"
+
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+
+/**
+ * Walks the objects of the heap on all GC threads, each thread taking chunks of the old regions, and whole new
+ * regions, as work units.
+ * @see MM_HeapWalker::parallelObjectsDo()
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelHeapWalkTask : public MM_ParallelTask
+{
+private:
+	MM_HeapWalker *_heapWalker;
+	MM_HeapWalkerObjectFunc _function; /**< called for every object, with the walking thread's context */
+	MM_HeapWalkerThreadStartFunc _threadStart; /**< creates the context of a walking thread, or NULL to pass _userData */
+	MM_HeapWalkerThreadEndFunc _threadEnd; /**< consumes the context of a walking thread, or NULL */
+	void *_userData;
+	uintptr_t _walkFlags;
+	volatile uintptr_t _workUnitCount; /**< work units walked by all threads */
+
+public:
+	virtual uintptr_t getVMStateID() { return J9VMSTATE_GC_HEAP_WALK; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	uintptr_t getWorkUnitCount() { return _workUnitCount; }
+
+	/**
+	 * Create a ParallelHeapWalkTask object
+	 */
+	MM_ParallelHeapWalkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_HeapWalker *heapWalker, MM_HeapWalkerObjectFunc function,
+			MM_HeapWalkerThreadStartFunc threadStart, MM_HeapWalkerThreadEndFunc threadEnd, void *userData, uintptr_t walkFlags) :
+		MM_ParallelTask(env, dispatcher),
+		_heapWalker(heapWalker),
+		_function(function),
+		_threadStart(threadStart),
+		_threadEnd(threadEnd),
+		_userData(userData),
+		_walkFlags(walkFlags),
+		_workUnitCount(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* PARALLELHEAPWALKTASK_HPP_ */
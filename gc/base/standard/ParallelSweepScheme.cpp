@@ -44,6 +44,7 @@
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
 #include "HeapMapWordIterator.hpp"
+#include "HeapMapWordScan.hpp"
 #include "ObjectModel.hpp"
 #include "Math.hpp"
 
@@ -190,6 +191,17 @@ MM_ParallelSweepScheme::initialize(MM_EnvironmentBase *env)
 	if (0 != omrthread_monitor_init_with_name(&_mutexSweepPoolState, 0, "SweepPoolState Monitor")) {
 		return false;
 	}
+
+	if (extensions->parallelSweepConnect) {
+		_connectSegmentCount = _connectSegmentsPerThread * OMR_MAX(extensions->gcThreadCount, 1);
+		_connectSegments = (ConnectSegment *)env->getForge()->allocate(sizeof(ConnectSegment) * _connectSegmentCount, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _connectSegments) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _connectSegmentCount; i++) {
+			new(&_connectSegments[i]) ConnectSegment();
+		}
+	}
 	
 	return true;
 }
@@ -216,6 +228,11 @@ MM_ParallelSweepScheme::tearDown(MM_EnvironmentBase *env)
 	if (0 != _mutexSweepPoolState) {
 		omrthread_monitor_destroy(_mutexSweepPoolState);
 	}
+
+	if (NULL != _connectSegments) {
+		env->getForge()->free(_connectSegments);
+		_connectSegments = NULL;
+	}
 }
 
 /**
@@ -337,14 +354,7 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 		markMapFreeHead = markMapCurrent;
 		heapSlotFreeHead = heapSlotFreeCurrent;
 
-		markMapCurrent += 1;
-
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
-		}
+		markMapCurrent = MM_HeapMapWordScan::skipEmptyWords(markMapCurrent + 1, markMapChunkTop);
 
 		/* Find the number of slots we've walked
 		 * (pointer math makes this the number of slots)
@@ -574,6 +584,8 @@ MM_ParallelSweepScheme::sweepChunk(MM_EnvironmentBase *env, MM_ParallelSweepChun
 		}
 	}
 
+	sweepChunk->_liveObjectFound = liveObjectFound;
+
 	return liveObjectFound;
 }
 
@@ -687,6 +699,170 @@ MM_ParallelSweepScheme::connectAllChunks(MM_EnvironmentBase *env, uintptr_t tota
 	flushAllFinalChunks(env);
 }
 
+/**
+ * Determine whether the free lists can be connected in parallel segments for the current sweep.
+ * @return true if parallel connect is enabled and supported by the sweep pool managers of all memory pools
+ */
+bool
+MM_ParallelSweepScheme::canConnectChunksInParallel(MM_EnvironmentBase *env)
+{
+	if (NULL == _connectSegments) {
+		return false;
+	}
+
+	uintptr_t poolCount = 0;
+	MM_MemoryPool *memoryPool;
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+
+	while(NULL != (memoryPool = poolIterator.nextPool())) {
+		if (!memoryPool->getSweepPoolManager()->canConnectSublists()) {
+			return false;
+		}
+		poolCount += 1;
+	}
+
+	return poolCount <= _connectSublistsPerSegment;
+}
+
+/**
+ * Find the sublist of the given memory pool in a parallel connect segment.
+ * @return the sublist, or NULL if no chunk of the pool has been connected in the segment yet
+ */
+MM_SweepPoolSublistState *
+MM_ParallelSweepScheme::findSublist(ConnectSegment *segment, MM_MemoryPool *memoryPool)
+{
+	for (uintptr_t i = 0; i < segment->_sublistCount; i++) {
+		if (segment->_sublists[i]._memoryPool == memoryPool) {
+			return &segment->_sublists[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Connect the chunks of the parallel connect segments claimed by the calling thread, building one sublist per memory pool.
+ * Segments hold about the same number of chunks. A segment starts at the first chunk at or after its nominal start
+ * that follows a chunk with a marked object: neither a projection nor the previous free entry of its pool can reach
+ * into such a chunk, so the sublists may start empty. Only the trailing free space of the preceding chunk is carried
+ * over, if both chunks belong to the same pool. Chunks are only read outside of the segment, and all threads walk
+ * all chunks, so they agree on the segment boundaries without synchronizing.
+ *
+ * @param totalChunkCount total number of chunks to be connected
+ */
+void
+MM_ParallelSweepScheme::connectAllSegments(MM_EnvironmentBase *env, uintptr_t totalChunkCount)
+{
+	MM_SweepHeapSectioningIterator sectioningIterator(_sweepHeapSectioning);
+	MM_ParallelSweepChunk *previousChunk = NULL;
+	MM_MemoryPool *statsMemoryPool = NULL;
+	ConnectSegment *segment = NULL;
+	uintptr_t nextSegmentIndex = 0;
+	uintptr_t pendingSegmentIndex = _connectSegmentCount;
+	bool pendingSegmentClaimed = false;
+
+	for (uintptr_t chunkNum = 0; chunkNum < totalChunkCount; chunkNum++) {
+		MM_ParallelSweepChunk *chunk = sectioningIterator.nextChunk();
+		Assert_MM_true(chunk != NULL);  /* Should never return NULL */
+
+		/* Claim the segments whose nominal start has been reached. A segment still pending when the next one is due remains empty */
+		while ((nextSegmentIndex < _connectSegmentCount) && (((nextSegmentIndex * totalChunkCount) / _connectSegmentCount) <= chunkNum)) {
+			pendingSegmentIndex = nextSegmentIndex;
+			pendingSegmentClaimed = J9MODRON_HANDLE_NEXT_WORK_UNIT(env);
+			nextSegmentIndex += 1;
+		}
+
+		if ((pendingSegmentIndex < _connectSegmentCount) && ((NULL == previousChunk) || previousChunk->_liveObjectFound)) {
+			segment = NULL;
+			if (pendingSegmentClaimed) {
+				segment = &_connectSegments[pendingSegmentIndex];
+				segment->_firstChunk = chunk;
+				env->_sweepStats.connectSegments += 1;
+			}
+			pendingSegmentIndex = _connectSegmentCount;
+		}
+
+		if (NULL != segment) {
+			MM_MemoryPool *memoryPool = chunk->memoryPool;
+			MM_SweepPoolSublistState *sublist = findSublist(segment, memoryPool);
+			if (NULL == sublist) {
+				Assert_MM_true(segment->_sublistCount < _connectSublistsPerSegment);
+				MM_ParallelSweepChunk *seedChunk = NULL;
+				if ((chunk == segment->_firstChunk) && (NULL != previousChunk) && (previousChunk->memoryPool == memoryPool)) {
+					seedChunk = previousChunk;
+				}
+				sublist = &segment->_sublists[segment->_sublistCount];
+				sublist->initializeForSegment(env, memoryPool, seedChunk);
+				segment->_sublistCount += 1;
+			}
+
+			/* if we are changing memory pool, flush the thread local stats and set them up for the new pool as sweepAllChunks() does */
+			if (statsMemoryPool != memoryPool) {
+				if (NULL != statsMemoryPool) {
+					statsMemoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+				}
+				MM_MemoryPool *topLevelMemoryPool = memoryPool->getParent();
+				if (NULL == topLevelMemoryPool) {
+					topLevelMemoryPool = memoryPool;
+				}
+				env->_freeEntrySizeClassStats.initializeFrequentAllocation(topLevelMemoryPool->getLargeObjectAllocateStats());
+				statsMemoryPool = memoryPool;
+			}
+
+			memoryPool->getSweepPoolManager()->connectChunkToSublist(env, chunk, sublist);
+			segment->_lastChunk = chunk;
+			env->_sweepStats.connectChunks += 1;
+		}
+
+		previousChunk = chunk;
+	}
+
+	/* flush the remaining stats (since the the last pool switch) */
+	if (NULL != statsMemoryPool) {
+		statsMemoryPool->getLargeObjectAllocateStats()->getFreeEntrySizeClassStats()->mergeLocked(&env->_freeEntrySizeClassStats);
+	}
+}
+
+/**
+ * Splice the sublists of all parallel connect segments into the free lists of their pools, in address order,
+ * then flush the final chunks.
+ * @note called by the master thread only
+ */
+void
+MM_ParallelSweepScheme::spliceAllSegments(MM_EnvironmentBase *env)
+{
+	initializeSweepStates(env);
+
+	for (uintptr_t i = 0; i < _connectSegmentCount; i++) {
+		ConnectSegment *segment = &_connectSegments[i];
+		for (uintptr_t j = 0; j < segment->_sublistCount; j++) {
+			MM_SweepPoolSublistState *sublist = &segment->_sublists[j];
+			sublist->_memoryPool->getSweepPoolManager()->spliceSublist(env, sublist);
+		}
+	}
+
+	flushAllFinalChunks(env);
+}
+
+/**
+ * Let the sweep pool managers fix up the chunks of the parallel connect segments claimed by the calling thread,
+ * now that the connect state preceding every sublist is known.
+ */
+void
+MM_ParallelSweepScheme::postProcessAllSegments(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < _connectSegmentCount; i++) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			ConnectSegment *segment = &_connectSegments[i];
+			MM_ParallelSweepChunk *chunk = segment->_firstChunk;
+			while (NULL != chunk) {
+				MM_SweepPoolSublistState *sublist = findSublist(segment, chunk->memoryPool);
+				chunk->memoryPool->getSweepPoolManager()->sublistChunkPostProcess(env, chunk, sublist);
+				chunk = (chunk == segment->_lastChunk) ? NULL : chunk->_next;
+			}
+		}
+	}
+}
+
 /**
  * Initialize all global garbage collect sweep information in all memory pools
  * @note This routine should only be called once for every sweep cycle.
@@ -763,33 +939,81 @@ MM_ParallelSweepScheme::internalSweep(MM_EnvironmentBase *env)
 		_extensions->heap->resetLargestFreeEntry();
 		
 		_chunksPrepared = prepareAllChunks(env);
+
+		_connectInParallel = !_forceSerialConnect && canConnectChunksInParallel(env);
+		if ((NULL != _connectSegments) && !_forceSerialConnect && !_connectInParallel) {
+			/* parallel connect is enabled, but not supported by the memory pools of this heap */
+			env->_sweepStats.connectSerialFallbacks += 1;
+		}
+		if (_connectInParallel) {
+			for (uintptr_t i = 0; i < _connectSegmentCount; i++) {
+				_connectSegments[i]._firstChunk = NULL;
+				_connectSegments[i]._lastChunk = NULL;
+				_connectSegments[i]._sublistCount = 0;
+			}
+		}
 		
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
 	/* ..all threads now join in to do actual sweep */
 	sweepAllChunks(env, _chunksPrepared);
-	
-	/* ..and then master thread finishes off by connecting all the chunks */
-	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+
+	if (_connectInParallel) {
+		/* ..all threads connect the chunks of their segments */
+		env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+		connectAllSegments(env, _chunksPrepared);
+
+		/* ..master thread links the segments together */
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
-		uint64_t mergeStartTime, mergeEndTime;
-		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
-		
-		mergeStartTime = omrtime_hires_clock();
+			uint64_t mergeStartTime, mergeEndTime;
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+			mergeStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+			spliceAllSegments(env);
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			mergeEndTime = omrtime_hires_clock();
+			env->_sweepStats.addToMergeTime(mergeStartTime, mergeEndTime);
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+
+		/* ..all threads fix up the chunks of their segments */
+		postProcessAllSegments(env);
+
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+			_extensions->splitFreeListNumberChunksPrepared = _chunksPrepared;
+			allPoolsPostProcess(env);
+
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
+	} else {
+		/* ..and then master thread finishes off by connecting all the chunks */
+		if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			uint64_t mergeStartTime, mergeEndTime;
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			
+			mergeStartTime = omrtime_hires_clock();
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
-		connectAllChunks(env, _chunksPrepared);
+			connectAllChunks(env, _chunksPrepared);
 
-		_extensions->splitFreeListNumberChunksPrepared = _chunksPrepared;
-		allPoolsPostProcess(env);
+			_extensions->splitFreeListNumberChunksPrepared = _chunksPrepared;
+			allPoolsPostProcess(env);
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
-		mergeEndTime = omrtime_hires_clock();
-		env->_sweepStats.addToMergeTime(mergeStartTime, mergeEndTime);
+			mergeEndTime = omrtime_hires_clock();
+			env->_sweepStats.addToMergeTime(mergeStartTime, mergeEndTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
-		env->_currentTask->releaseSynchronizedGCThreads(env);
+			env->_currentTask->releaseSynchronizedGCThreads(env);
+		}
 	}
 }
 
@@ -806,9 +1030,66 @@ void
 MM_ParallelSweepScheme::sweep(MM_EnvironmentBase *env)
 {
 	setupForSweep(env);
+
+	bool verifyParallelConnect = _extensions->fvtest_verifyParallelSweepConnect && canConnectChunksInParallel(env);
+	if (verifyParallelConnect) {
+		sweepForSerialConnectReference(env);
+	}
 	
 	MM_ParallelSweepTask sweepTask(env, _extensions->dispatcher, this);
 	_extensions->dispatcher->run(env, &sweepTask);
+
+	if (verifyParallelConnect) {
+		MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+		getPoolFreeMemory(env, &sweepStats->connectFreeBytes, &sweepStats->connectFreeEntryCount);
+		sweepStats->connectVerified = true;
+	}
+}
+
+/**
+ * Sweep with the serial connect and record the free memory of all pools, then empty the pools again.
+ * Sweeping only depends on the mark map, so the sweep which follows must connect exactly the same free memory.
+ * The sweep stats of the reference sweep are discarded.
+ */
+void
+MM_ParallelSweepScheme::sweepForSerialConnectReference(MM_EnvironmentBase *env)
+{
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	MM_SweepStats savedSweepStats = *sweepStats;
+
+	_forceSerialConnect = true;
+	MM_ParallelSweepTask sweepTask(env, _extensions->dispatcher, this);
+	_extensions->dispatcher->run(env, &sweepTask);
+	_forceSerialConnect = false;
+
+	uintptr_t freeBytes = 0;
+	uintptr_t freeEntryCount = 0;
+	getPoolFreeMemory(env, &freeBytes, &freeEntryCount);
+
+	*sweepStats = savedSweepStats;
+	sweepStats->serialConnectFreeBytes = freeBytes;
+	sweepStats->serialConnectFreeEntryCount = freeEntryCount;
+
+	_extensions->heap->resetSpacesForGarbageCollect(env);
+}
+
+/**
+ * Sum the free memory of all memory pools.
+ * @param[out] freeBytes free bytes of all pools
+ * @param[out] freeEntryCount free entries of all pools
+ */
+void
+MM_ParallelSweepScheme::getPoolFreeMemory(MM_EnvironmentBase *env, uintptr_t *freeBytes, uintptr_t *freeEntryCount)
+{
+	MM_MemoryPool *memoryPool;
+	MM_HeapMemoryPoolIterator poolIterator(env, _extensions->heap);
+
+	*freeBytes = 0;
+	*freeEntryCount = 0;
+	while(NULL != (memoryPool = poolIterator.nextPool())) {
+		*freeBytes += memoryPool->getActualFreeMemorySize();
+		*freeEntryCount += memoryPool->getActualFreeEntryCount();
+	}
 }
 
 /**
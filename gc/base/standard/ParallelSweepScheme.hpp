@@ -35,6 +35,7 @@
 #include "GCExtensionsBase.hpp"
 #include "MemoryPool.hpp"
 #include "ParallelTask.hpp"
+#include "SweepPoolSublistState.hpp"
 
 class MM_AllocateDescription;
 class MM_Dispatcher;
@@ -91,7 +92,35 @@ class MM_ParallelSweepScheme : public MM_BaseVirtual
 	 * Data members
 	 */
 private:
+	enum {
+		_connectSegmentsPerThread = 4, /**< number of parallel connect segments per GC thread */
+		_connectSublistsPerSegment = 8 /**< maximum number of memory pools for which the free lists are connected in parallel */
+	};
+
+	/**
+	 * A run of address ordered chunks connected by one thread in a parallel connect, into one sublist per memory pool.
+	 */
+	class ConnectSegment : public MM_Base {
+	public:
+		MM_ParallelSweepChunk *_firstChunk; /**< first chunk of the segment, NULL if the segment is empty */
+		MM_ParallelSweepChunk *_lastChunk; /**< last chunk of the segment */
+		uintptr_t _sublistCount; /**< number of entries of _sublists in use */
+		MM_SweepPoolSublistState _sublists[_connectSublistsPerSegment]; /**< sublists of the memory pools found in the segment, in order of first appearance */
+
+		ConnectSegment() :
+			MM_Base(),
+			_firstChunk(NULL),
+			_lastChunk(NULL),
+			_sublistCount(0)
+		{
+		}
+	};
+
 	uintptr_t _chunksPrepared; 
+	ConnectSegment *_connectSegments; /**< parallel connect segments, NULL unless parallelSweepConnect is enabled */
+	uintptr_t _connectSegmentCount; /**< number of entries in _connectSegments */
+	bool _connectInParallel; /**< true if the current sweep connects the free lists in parallel segments */
+	bool _forceSerialConnect; /**< true while sweeping for the serial connect reference of fvtest_verifyParallelSweepConnect */
 
 protected:
 	MM_GCExtensionsBase *_extensions;
@@ -129,6 +158,14 @@ protected:
 	virtual void connectChunk(MM_EnvironmentBase *env, MM_ParallelSweepChunk *chunk);
 	void connectAllChunks(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
 
+	bool canConnectChunksInParallel(MM_EnvironmentBase *env);
+	void connectAllSegments(MM_EnvironmentBase *env, uintptr_t totalChunkCount);
+	void spliceAllSegments(MM_EnvironmentBase *env);
+	void postProcessAllSegments(MM_EnvironmentBase *env);
+	MM_SweepPoolSublistState *findSublist(ConnectSegment *segment, MM_MemoryPool *memoryPool);
+	void sweepForSerialConnectReference(MM_EnvironmentBase *env);
+	void getPoolFreeMemory(MM_EnvironmentBase *env, uintptr_t *freeBytes, uintptr_t *freeEntryCount);
+
 	void initializeSweepStates(MM_EnvironmentBase *env);
 
 	void flushFinalChunk(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool);
@@ -211,6 +248,10 @@ public:
 	MM_ParallelSweepScheme(MM_EnvironmentBase *env)
 		: MM_BaseVirtual()
 		, _chunksPrepared(0)
+		, _connectSegments(NULL)
+		, _connectSegmentCount(0)
+		, _connectInParallel(false)
+		, _forceSerialConnect(false)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _currentMarkMap(NULL)
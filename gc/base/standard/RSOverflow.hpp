@@ -73,6 +73,12 @@ public:
 		return _markedObjectIterator.nextObject();
 	}
 
+	/**
+	 * Get the mark map stolen from the global collector, for callers which mark and search it themselves
+	 * @return the cleared mark map
+	 */
+	MMINLINE MM_MarkMap *getMarkMap() { return _markMap; }
+
 	/**
 	 * Construct a new RSOverflow
 	 */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include <string.h>
+
+#include "RSOverflowCardTable.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+
+MM_RSOverflowCardTable *
+MM_RSOverflowCardTable::newInstance(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
+{
+	MM_RSOverflowCardTable *cardTable = (MM_RSOverflowCardTable *)env->getForge()->allocate(sizeof(MM_RSOverflowCardTable), MM_AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL != cardTable) {
+		new(cardTable) MM_RSOverflowCardTable();
+		if (!cardTable->initialize(env, heapBase, heapTop)) {
+			cardTable->kill(env);
+			cardTable = NULL;
+		}
+	}
+	return cardTable;
+}
+
+bool
+MM_RSOverflowCardTable::initialize(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
+{
+	_heapBase = heapBase;
+	_heapTop = heapTop;
+	_cardCount = (((uintptr_t)heapTop - (uintptr_t)heapBase) + CARD_SIZE - 1) >> CARD_SIZE_SHIFT;
+
+	_cards = (volatile uintptr_t *)env->getForge()->allocate(_cardCount * sizeof(uintptr_t), MM_AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _cards) {
+		return false;
+	}
+	clear();
+
+	return true;
+}
+
+void
+MM_RSOverflowCardTable::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+void
+MM_RSOverflowCardTable::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _cards) {
+		env->getForge()->free((void *)_cards);
+		_cards = NULL;
+	}
+}
+
+void
+MM_RSOverflowCardTable::clear()
+{
+	memset((void *)_cards, 0, _cardCount * sizeof(uintptr_t));
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(RSOVERFLOWCARDTABLE_HPP_)
+#define RSOVERFLOWCARDTABLE_HPP_
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+/**
+ * Records the tenured objects which could not be added to the remembered set list once it overflowed,
+ * so that the scavenger only has to walk the parts of tenure holding them instead of all of tenure.
+ * The heap is divided into cards of CARD_SIZE bytes and each card holds the lowest address of the
+ * objects recorded on it, or NULL: since the heap is walkable from any object, a dirty card is processed
+ * by walking the objects from the one recorded up to the end of the card.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RSOverflowCardTable : public MM_BaseVirtual
+{
+/*
+ * Data members
+ */
+public:
+	enum {
+		CARD_SIZE_SHIFT = 12,
+		CARD_SIZE = 1 << CARD_SIZE_SHIFT
+	};
+
+protected:
+private:
+	void *_heapBase; /**< lowest address covered by the cards */
+	void *_heapTop; /**< address following the highest address covered by the cards */
+	uintptr_t _cardCount; /**< number of cards */
+	volatile uintptr_t *_cards; /**< for each card, the lowest address of the objects recorded on it or 0 */
+
+/*
+ * Function members
+ */
+public:
+	static MM_RSOverflowCardTable *newInstance(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getCardCount() { return _cardCount; }
+
+	/**
+	 * Record an object on its card. May be called by several threads at once.
+	 * @param objectPtr[in] a tenured object which is remembered but not in the remembered set list
+	 */
+	MMINLINE void
+	rememberObject(omrobjectptr_t objectPtr)
+	{
+		Assert_MM_true((objectPtr >= _heapBase) && (objectPtr < _heapTop));
+		volatile uintptr_t *card = &_cards[((uintptr_t)objectPtr - (uintptr_t)_heapBase) >> CARD_SIZE_SHIFT];
+		uintptr_t oldValue = *card;
+		while ((0 == oldValue) || ((uintptr_t)objectPtr < oldValue)) {
+			uintptr_t result = MM_AtomicOperations::lockCompareExchange(card, oldValue, (uintptr_t)objectPtr);
+			if (result == oldValue) {
+				break;
+			}
+			oldValue = result;
+		}
+	}
+
+	/**
+	 * @return the lowest object recorded on the card, or NULL if the card is clean
+	 */
+	MMINLINE omrobjectptr_t getFirstObject(uintptr_t cardIndex) { return (omrobjectptr_t)_cards[cardIndex]; }
+
+	/**
+	 * Clean a card. An object may be recorded on the card again as soon as this returns.
+	 * @return the lowest object which was recorded on the card, or NULL if the card was clean
+	 */
+	MMINLINE omrobjectptr_t
+	cleanCard(uintptr_t cardIndex)
+	{
+		uintptr_t oldValue = _cards[cardIndex];
+		while (0 != oldValue) {
+			uintptr_t result = MM_AtomicOperations::lockCompareExchange(&_cards[cardIndex], oldValue, 0);
+			if (result == oldValue) {
+				break;
+			}
+			oldValue = result;
+		}
+		return (omrobjectptr_t)oldValue;
+	}
+
+	/**
+	 * @return the address following the last byte covered by the card
+	 */
+	MMINLINE void *
+	getCardTop(uintptr_t cardIndex)
+	{
+		return (void *)((uintptr_t)_heapBase + ((cardIndex + 1) << CARD_SIZE_SHIFT));
+	}
+
+	/**
+	 * Clean every card.
+	 * @note assumes no other thread is using the cards.
+	 */
+	void clear();
+
+	MM_RSOverflowCardTable() :
+		MM_BaseVirtual()
+		, _heapBase(NULL)
+		, _heapTop(NULL)
+		, _cardCount(0)
+		, _cards(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, void *heapBase, void *heapTop);
+	void tearDown(MM_EnvironmentBase *env);
+private:
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* RSOVERFLOWCARDTABLE_HPP_ */
@@ -56,8 +56,12 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "MarkMap.hpp"
+#include "MemoryManager.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -73,6 +77,7 @@
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
 #include "RSOverflow.hpp"
+#include "RSOverflowCardTable.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
 #include "ScavengerRootScanner.hpp"
@@ -95,8 +100,17 @@
 #define TENURE_BYTES_HISTORY_WEIGHT ((float)0.8)
 
 #define FLIP_TENURE_LARGE_SCAN 4
+
+/* Work, in copied bytes, which scanning one remembered object is counted as under adaptive GC threading */
+#define REMEMBERED_OBJECT_WORK_BYTES 256
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* number of optimally sized copy caches a NUMA node slice is refilled with */
+#define NODE_SLICE_CACHE_COUNT 8
+
+/* number of remembered set overflow cards processed as one work unit */
+#define RS_OVERFLOW_CARDS_PER_WORK_UNIT 256
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -112,10 +126,6 @@
 #define HOTFIELD_SHOULD_ALIGN(descriptor) (0x1 == (0x1 & (descriptor)))
 #define HOTFIELD_ALIGNMENT_BIAS(descriptor, heapObjectAlignment) (((descriptor) >> 1) * (heapObjectAlignment))
 
-extern "C" {
-	uintptr_t allocateMemoryForSublistFragment(void *vmThreadRawPtr, J9VMGC_SublistFragment *fragmentPrimitive);
-}
-
 uintptr_t
 MM_Scavenger::getVMStateID()
 {
@@ -213,9 +223,54 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
-	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount)) {
+	/* NUMA-local scavenging splits the scan work and copy destinations across affinity leaders.
+	 * Concurrent Scavenger lets mutators copy as well, so it always works with a single node.
+	 */
+	_scavengeNodeCount = 1;
+	bool numaLocal = _extensions->scavengerNUMALocal;
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	numaLocal = numaLocal && !_extensions->concurrentScavenger;
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	if (numaLocal) {
+		_scavengeNodeCount = OMR_MAX(_extensions->_numaManager.getAffinityLeaderCount(), 1);
+	}
+
+	_scavengeCacheScanLists = (MM_CopyScanCacheList *)env->getForge()->allocate(sizeof(MM_CopyScanCacheList) * _scavengeNodeCount, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _scavengeCacheScanLists) {
 		return false;
 	}
+	for (uintptr_t node = 0; node < _scavengeNodeCount; node++) {
+		new(&_scavengeCacheScanLists[node]) MM_CopyScanCacheList();
+	}
+	for (uintptr_t node = 0; node < _scavengeNodeCount; node++) {
+		/* all lists share the same non-empty count, so termination detection is unaffected by the split */
+		if (!_scavengeCacheScanLists[node].initialize(env, &_cachedEntryCount)) {
+			return false;
+		}
+	}
+
+	if (1 < _scavengeNodeCount) {
+		uintptr_t sliceCount = 2 * _scavengeNodeCount;
+		_survivorNodeSlices = (NodeAllocationSlice *)env->getForge()->allocate(sizeof(NodeAllocationSlice) * sliceCount, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _survivorNodeSlices) {
+			return false;
+		}
+		memset((void *)_survivorNodeSlices, 0, sizeof(NodeAllocationSlice) * sliceCount);
+		_tenureNodeSlices = _survivorNodeSlices + _scavengeNodeCount;
+		for (uintptr_t i = 0; i < sliceCount; i++) {
+			if (!_survivorNodeSlices[i]._lock.initialize(env, &_extensions->lnrlOptions, "MM_Scavenger:_nodeSlices[]._lock")) {
+				return false;
+			}
+		}
+
+		MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+		scavengerStats->_nodeStats = (MM_ScavengerStats::NodeStats *)env->getForge()->allocate(sizeof(MM_ScavengerStats::NodeStats) * _scavengeNodeCount, MM_AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == scavengerStats->_nodeStats) {
+			return false;
+		}
+		memset((void *)scavengerStats->_nodeStats, 0, sizeof(MM_ScavengerStats::NodeStats) * _scavengeNodeCount);
+		scavengerStats->_nodeStatsCount = _scavengeNodeCount;
+	}
 
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
@@ -283,7 +338,30 @@ void
 MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 {
 	_scavengeCacheFreeList.tearDown(env);
-	_scavengeCacheScanList.tearDown(env);
+	if (NULL != _rememberedSetOverflowCards) {
+		_rememberedSetOverflowCards->kill(env);
+		_rememberedSetOverflowCards = NULL;
+	}
+	if (NULL != _scavengeCacheScanLists) {
+		for (uintptr_t node = 0; node < _scavengeNodeCount; node++) {
+			_scavengeCacheScanLists[node].tearDown(env);
+		}
+		env->getForge()->free(_scavengeCacheScanLists);
+		_scavengeCacheScanLists = NULL;
+	}
+	if (NULL != _survivorNodeSlices) {
+		for (uintptr_t i = 0; i < (2 * _scavengeNodeCount); i++) {
+			_survivorNodeSlices[i]._lock.tearDown();
+		}
+		env->getForge()->free(_survivorNodeSlices);
+		_survivorNodeSlices = NULL;
+		_tenureNodeSlices = NULL;
+	}
+	if (NULL != _extensions->scavengerStats._nodeStats) {
+		env->getForge()->free(_extensions->scavengerStats._nodeStats);
+		_extensions->scavengerStats._nodeStats = NULL;
+		_extensions->scavengerStats._nodeStatsCount = 0;
+	}
 
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
@@ -396,6 +474,7 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_tenureMemorySubSpace->mergeHeapStats(&heapStatsTenureSpace);
 	scavengerStats->_tenureSpaceAllocBytesAcumulation += heapStatsTenureSpace._allocBytes;
 	scavengerStats->_semiSpaceAllocBytesAcumulation += heapStatsSemiSpace._allocBytes;
+	_allocatedBytes = heapStatsSemiSpace._allocBytes;
 
 	/* Record the tenure mask */
 	_tenureMask = calculateTenureMask();
@@ -405,6 +484,19 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (NULL != _survivorNodeSlices) {
+		splitSurvivorIntoNodeRanges(env);
+	}
+
+	if (_extensions->scavengerRememberedSetOverflowCards && (NULL == _rememberedSetOverflowCards)) {
+		/* The cards cover the whole reserved heap so tenure can expand under them. Objects which overflowed
+		 * before they existed are not on them, so they can only be used once the overflow has been pruned.
+		 * If they can not be allocated, overflow is handled by walking tenure.
+		 */
+		_rememberedSetOverflowCards = MM_RSOverflowCardTable::newInstance(env, _heapBase, _heapTop);
+		_rememberedSetOverflowCardsValid = !isRememberedSetInOverflowState();
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
@@ -443,6 +535,36 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_false(env->_loaAllocation);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderBase);
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
+
+	env->_scavengerNodeIndex = (1 < _scavengeNodeCount) ? selectScavengeNode(env) : 0;
+}
+
+uintptr_t
+MM_Scavenger::selectScavengeNode(MM_EnvironmentStandard *env)
+{
+	/* spread threads evenly across nodes unless the thread already has an affinity */
+	uintptr_t nodeIndex = env->getSlaveID() % _scavengeNodeCount;
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+
+	if (numaManager->isPhysicalNUMASupported()) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const *leaders = numaManager->getAffinityLeaders(&leaderCount);
+		uintptr_t j9NodeNumber = env->getNumaAffinity();
+		if (0 != j9NodeNumber) {
+			for (uintptr_t i = 0; i < OMR_MIN(leaderCount, _scavengeNodeCount); i++) {
+				if (leaders[i].j9NodeNumber == j9NodeNumber) {
+					nodeIndex = i;
+					break;
+				}
+			}
+		} else if ((0 != env->getSlaveID()) && (nodeIndex < leaderCount)) {
+			/* slave threads belong to the GC, so keep them on their node from now on; the master may be a mutator thread and is left alone */
+			j9NodeNumber = leaders[nodeIndex].j9NodeNumber;
+			env->setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+
+	return nodeIndex;
 }
 
 /**
@@ -452,9 +574,18 @@ void
 MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
-	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
+	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState, getRecommendedScavengeThreads(env));
 	_dispatcher->run(env, &scavengeTask);
 
+	if (_survivorNodeRangesActive) {
+		returnSurvivorNodeRanges(env);
+	}
+
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+	scavengerStats->_gcThreadCount = scavengeTask.getThreadCount();
+	_previousAllocatedBytes = _allocatedBytes;
+	_previousCopiedBytes = scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
 
@@ -462,6 +593,23 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 	Assert_MM_true(0 == _cachedEntryCount);
 }
 
+uintptr_t
+MM_Scavenger::getRecommendedScavengeThreads(MM_EnvironmentStandard *env)
+{
+	if (!_extensions->adaptiveGCThreading || (0 == _previousAllocatedBytes) || isRememberedSetInOverflowState()) {
+		return UDATA_MAX;
+	}
+
+	uintptr_t expectedCopiedBytes = _allocatedBytes;
+	if (_previousCopiedBytes < _previousAllocatedBytes) {
+		expectedCopiedBytes = (uintptr_t)(((double)_allocatedBytes * (double)_previousCopiedBytes) / (double)_previousAllocatedBytes);
+	}
+	uintptr_t expectedWork = expectedCopiedBytes + (_extensions->rememberedSet.countElements() * REMEMBERED_OBJECT_WORK_BYTES);
+	uintptr_t workPerThread = OMR_MAX(_extensions->adaptiveGCThreadingWorkPerThread, 1);
+
+	return OMR_MAX((expectedWork + workPerThread - 1) / workPerThread, 1);
+}
+
 void
 MM_Scavenger::reportScavengeStart(MM_EnvironmentStandard *env)
 {
@@ -676,6 +824,7 @@ MM_Scavenger::mergeGCStats(MM_EnvironmentStandard *env)
 
 	finalGCStats->_rememberedSetOverflow |= scavStats->_rememberedSetOverflow;
 	finalGCStats->_causedRememberedSetOverflow |= scavStats->_causedRememberedSetOverflow;
+	finalGCStats->_rememberedSetOverflowCardsScanned += scavStats->_rememberedSetOverflowCardsScanned;
 	finalGCStats->_scanCacheOverflow |= scavStats->_scanCacheOverflow;
 	finalGCStats->_scanCacheAllocationFromHeap |= scavStats->_scanCacheAllocationFromHeap;
 	finalGCStats->_scanCacheAllocationDurationDuringSavenger = OMR_MAX(finalGCStats->_scanCacheAllocationDurationDuringSavenger, scavStats->_scanCacheAllocationDurationDuringSavenger);
@@ -696,6 +845,14 @@ MM_Scavenger::mergeGCStats(MM_EnvironmentStandard *env)
 	finalGCStats->_failedFlipCount += scavStats->_failedFlipCount;
 	finalGCStats->_failedFlipBytes += scavStats->_failedFlipBytes;
 
+	if (NULL != finalGCStats->_nodeStats) {
+		MM_ScavengerStats::NodeStats *nodeStats = &finalGCStats->_nodeStats[env->_scavengerNodeIndex];
+		nodeStats->_copyBytes += scavStats->_localNodeStats._copyBytes;
+		nodeStats->_remoteCopyBytes += scavStats->_localNodeStats._remoteCopyBytes;
+		nodeStats->_scanCount += scavStats->_localNodeStats._scanCount;
+		nodeStats->_stealCount += scavStats->_localNodeStats._stealCount;
+	}
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	finalGCStats->_acquireFreeListCount += scavStats->_acquireFreeListCount;
 	finalGCStats->_releaseFreeListCount += scavStats->_releaseFreeListCount;
@@ -753,6 +910,7 @@ MM_Scavenger::mergeGCStats(MM_EnvironmentStandard *env)
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_hotFieldCopyCount += scavStats->_hotFieldCopyCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -897,21 +1055,29 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 				env->_survivorTLHRemainderBase = NULL;
 				env->_survivorTLHRemainderTop = NULL;
 			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
-				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
-
-				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
-					allocateResult = true;
+				if (_survivorNodeRangesActive) {
+					allocateResult = allocateFromSurvivorNodeRanges(env, cacheSize, cacheSize, 0, addrBase, addrTop);
+				} else {
+					MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
+
+					addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
+					}
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_survivorNodeRangesActive) {
+					allocateResult = allocateFromSurvivorNodeRanges(env, cacheSize, scanCacheSize, _extensions->tlhSurvivorDiscardThreshold, addrBase, addrTop);
+				} else {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1019,13 +1185,18 @@ MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env,
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				allocDescription.setCollectorAllocateExpandOnFailure(true);
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (NULL != _tenureNodeSlices) {
+					allocateResult = allocateFromNodeSlice(env, &_tenureNodeSlices[env->_scavengerNodeIndex], _tenureMemorySubSpace, &allocDescription,
+							cacheSize, scanCacheSize, _extensions->tlhTenureDiscardThreshold, addrBase, addrTop, &satisfiedInLOA);
+				} else {
+					allocateResult = (NULL != _tenureMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
 
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
-				if (allocateResult && allocDescription.isLOAAllocation()) {
-					satisfiedInLOA = true;
-				}
+					if (allocateResult && allocDescription.isLOAAllocation()) {
+						satisfiedInLOA = true;
+					}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
+				}
 				env->_scavengerStats._tenureSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -1088,6 +1259,170 @@ MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env,
 	return copyCache;
 }
 
+void
+MM_Scavenger::bindToScavengeNode(MM_EnvironmentStandard *env, uintptr_t nodeIndex, void *base, void *top)
+{
+	MM_NUMAManager *numaManager = &_extensions->_numaManager;
+
+	if (numaManager->isPhysicalNUMASupported()) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const *leaders = numaManager->getAffinityLeaders(&leaderCount);
+		if (nodeIndex < leaderCount) {
+			uintptr_t pageSize = _extensions->heap->getPageSize();
+			uintptr_t low = MM_Math::roundToCeiling(pageSize, (uintptr_t)base);
+			uintptr_t high = MM_Math::roundToFloor(pageSize, (uintptr_t)top);
+			if (low < high) {
+				/* placement is only a preference, so a failure to bind leaves the pages wherever the kernel puts them */
+				_extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)_extensions->heap)->getVmemHandle(), leaders[nodeIndex].j9NodeNumber, (void *)low, high - low);
+			}
+		}
+	}
+}
+
+void
+MM_Scavenger::splitSurvivorIntoNodeRanges(MM_EnvironmentStandard *env)
+{
+	MM_MemoryPool *survivorPool = _survivorMemorySubSpace->getMemoryPool();
+	uintptr_t survivorSize = (uintptr_t)_survivorSpaceTop - (uintptr_t)_survivorSpaceBase;
+
+	_survivorNodeRangesActive = (0 != survivorSize)
+			&& (1 == survivorPool->getActualFreeEntryCount())
+			&& (survivorPool->getActualFreeMemorySize() == survivorSize);
+	if (_survivorNodeRangesActive) {
+		/* The pool holds the whole survivor space as a single free entry. Take it out so that no copy cache can
+		 * come from anywhere but the node ranges, which are given back to the pool at the end of the scavenge.
+		 */
+		survivorPool->contractWithRange(env, survivorSize, _survivorSpaceBase, _survivorSpaceTop);
+
+		uintptr_t pageSize = _extensions->heap->getPageSize();
+		uintptr_t rangeSize = MM_Math::roundToCeiling(pageSize, survivorSize / _scavengeNodeCount);
+		void *rangeBase = _survivorSpaceBase;
+		for (uintptr_t node = 0; node < _scavengeNodeCount; node++) {
+			void *rangeTop = _survivorSpaceTop;
+			if ((node + 1) < _scavengeNodeCount) {
+				rangeTop = (void *)((uintptr_t)rangeBase + OMR_MIN(rangeSize, (uintptr_t)_survivorSpaceTop - (uintptr_t)rangeBase));
+			}
+			_survivorNodeSlices[node]._base = rangeBase;
+			_survivorNodeSlices[node]._top = rangeTop;
+			bindToScavengeNode(env, node, rangeBase, rangeTop);
+			rangeBase = rangeTop;
+		}
+	}
+}
+
+void
+MM_Scavenger::returnSurvivorNodeRanges(MM_EnvironmentStandard *env)
+{
+	MM_MemoryPool *survivorPool = _survivorMemorySubSpace->getMemoryPool();
+
+	for (uintptr_t node = 0; node < _scavengeNodeCount; node++) {
+		NodeAllocationSlice *range = &_survivorNodeSlices[node];
+		if (range->_base < range->_top) {
+			survivorPool->expandWithRange(env, (uintptr_t)range->_top - (uintptr_t)range->_base, range->_base, range->_top, true);
+		}
+		range->_base = NULL;
+		range->_top = NULL;
+	}
+	_survivorNodeRangesActive = false;
+}
+
+bool
+MM_Scavenger::allocateFromSurvivorNodeRanges(MM_EnvironmentStandard *env, uintptr_t cacheSize, uintptr_t preferredSize, uintptr_t discardThreshold, void* &addrBase, void* &addrTop)
+{
+	bool result = false;
+	uintptr_t nodeIndex = env->_scavengerNodeIndex;
+
+	/* only take memory from a remote node once the local range is used up */
+	for (uintptr_t i = 0; !result && (i < _scavengeNodeCount); i++) {
+		NodeAllocationSlice *range = &_survivorNodeSlices[nodeIndex];
+		uintptr_t size = 0;
+
+		range->_lock.acquire();
+		uintptr_t available = (uintptr_t)range->_top - (uintptr_t)range->_base;
+		if (available >= cacheSize) {
+			size = OMR_MIN(OMR_MAX(preferredSize, cacheSize), available);
+			if ((available - size) < discardThreshold) {
+				/* not worth keeping what would be left */
+				size = available;
+			}
+			addrBase = range->_base;
+			addrTop = (void *)((uintptr_t)addrBase + size);
+			range->_base = addrTop;
+		}
+		range->_lock.release();
+
+		if (0 != size) {
+			if (0 == i) {
+				env->_scavengerStats._localNodeStats._copyBytes += size;
+			} else {
+				env->_scavengerStats._localNodeStats._remoteCopyBytes += size;
+			}
+			result = true;
+		}
+
+		nodeIndex += 1;
+		if (nodeIndex == _scavengeNodeCount) {
+			nodeIndex = 0;
+		}
+	}
+
+	return result;
+}
+
+bool
+MM_Scavenger::allocateFromNodeSlice(MM_EnvironmentStandard *env, NodeAllocationSlice *slice, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uintptr_t cacheSize, uintptr_t scanCacheSize, uintptr_t discardThreshold, void* &addrBase, void* &addrTop, bool *loaAllocation)
+{
+	bool result = false;
+
+	slice->_lock.acquire();
+
+	if (((uintptr_t)slice->_top - (uintptr_t)slice->_base) < cacheSize) {
+		/* The slice can not hold the object - give the rest back and take a new slice for the node */
+		if (NULL != slice->_base) {
+			subSpace->abandonHeapChunk(slice->_base, slice->_top);
+			slice->_base = NULL;
+			slice->_top = NULL;
+		}
+		void *sliceBase = NULL;
+		void *sliceTop = NULL;
+		if (NULL != subSpace->collectorAllocateTLH(env, this, allocDescription, scanCacheSize * NODE_SLICE_CACHE_COUNT, sliceBase, sliceTop)) {
+			bindToScavengeNode(env, env->_scavengerNodeIndex, sliceBase, sliceTop);
+			slice->_base = sliceBase;
+			slice->_top = sliceTop;
+			slice->_loaAllocation = false;
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+			slice->_loaAllocation = allocDescription->isLOAAllocation();
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+		}
+	}
+
+	uintptr_t available = (uintptr_t)slice->_top - (uintptr_t)slice->_base;
+	if (available >= cacheSize) {
+		uintptr_t size = OMR_MIN(OMR_MAX(scanCacheSize, cacheSize), available);
+		if ((available - size) < discardThreshold) {
+			/* not worth keeping what would be left */
+			size = available;
+		}
+		addrBase = slice->_base;
+		addrTop = (void *)((uintptr_t)addrBase + size);
+		*loaAllocation = slice->_loaAllocation;
+		slice->_base = addrTop;
+		if (slice->_base == slice->_top) {
+			slice->_base = NULL;
+			slice->_top = NULL;
+		}
+		result = true;
+	}
+
+	slice->_lock.release();
+
+	if (result) {
+		env->_scavengerStats._localNodeStats._copyBytes += (uintptr_t)addrTop - (uintptr_t)addrBase;
+	}
+
+	return result;
+}
+
 /**
  * Update the given slot to point at the new location of the object, after copying
  * the object if it was not already.
@@ -1138,6 +1473,9 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
 					/* Update the slot */
 					*objectPtrIndirect = destinationObjectPtr;
 					toReturn = isObjectInNewSpace(destinationObjectPtr);
+					if (0 != _extensions->scavengerHotFieldCopyDepth) {
+						depthCopyHotFields(env, destinationObjectPtr);
+					}
 				}
 			}
 		} else if (isObjectInNewSpace(objectPtr)) {
@@ -1159,6 +1497,43 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
 	return toReturn;
 }
 
+/**
+ * Copy the objects referenced through the hot fields of an object that has just been copied, so that
+ * they are laid down right behind it in the copy cache rather than when the scan of the cache reaches
+ * the object. Hot children are copied depth first, up to scavengerHotFieldCopyDepth levels below the
+ * object the scan is working on; cold fields and deeper objects are left to the scan. The parent's hot
+ * slots are found already forwarded when it is scanned, so remembering is unaffected.
+ *
+ * @param objectPtr the new location of the copied object
+ */
+void
+MM_Scavenger::depthCopyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	if (env->_hotFieldCopyDepth < _extensions->scavengerHotFieldCopyDepth) {
+		GC_ObjectScannerState objectScannerState;
+		GC_ObjectScanner *objectScanner = getObjectScanner(env, objectPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+		if ((NULL != objectScanner) && !objectScanner->isIndexableObject()) {
+			/* the caller checks the cache that received objectPtr for aliasing once this returns */
+			MM_CopyScanCacheStandard *effectiveCopyScanCache = env->_effectiveCopyScanCache;
+			GC_SlotObject *slotObject = NULL;
+			env->_hotFieldCopyDepth += 1;
+			while (NULL != (slotObject = objectScanner->getNextHotSlot())) {
+				copyAndForward(env, slotObject);
+				/* only count children actually copied, and into the cache which received their parent */
+				if ((NULL != effectiveCopyScanCache) && (effectiveCopyScanCache == env->_effectiveCopyScanCache)) {
+					env->_scavengerStats._hotFieldCopyCount += 1;
+				}
+			}
+			env->_hotFieldCopyDepth -= 1;
+			/* the copies may have filled the cache that received objectPtr and retired it; it must not be aliased then */
+			if ((effectiveCopyScanCache != env->_survivorCopyScanCache) && (effectiveCopyScanCache != env->_tenureCopyScanCache)) {
+				effectiveCopyScanCache = NULL;
+			}
+			env->_effectiveCopyScanCache = effectiveCopyScanCache;
+		}
+	}
+}
+
 /**
  * Update the given slot to point at the new location of the object, after copying
  * the object if it was not already.
@@ -1510,7 +1885,7 @@ MM_Scavenger::updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanne
 	env->_scavengerStats._slotsCopied += slotsCopied;
 	uint64_t updateResult = _extensions->copyScanRatio.update(env, &(env->_scavengerStats._slotsScanned), &(env->_scavengerStats._slotsCopied), _waitingCount);
 	if (0 != updateResult) {
-		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, getApproximateScanListEntryCount());
 	}
 }
 
@@ -2046,6 +2421,7 @@ MM_Scavenger::workThreadGarbageCollect(MM_EnvironmentStandard *env)
 
 	addCopyCachesToFreeList(env);
 	abandonTLHRemainders(env);
+	abandonNodeSlices(env);
 
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
@@ -2112,13 +2488,20 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
-		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
+		/* There wasn't enough room in the current fragment - allocate a new one. The overflow state is set here rather
+		 * than by allocateMemoryForSublistFragment(), as the object is recorded on the overflow cards.
+		 */
+		MM_SublistFragment fragment((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+		MM_SublistFragment::flush((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+		if(!((MM_SublistPool *)env->_scavengerRememberedSet.parentList)->allocate(env, &fragment)) {
 			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
 			if(!isRememberedSetInOverflowState()) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
 			}
 			setRememberedSetOverflowState();
+			if (NULL != _rememberedSetOverflowCards) {
+				_rememberedSetOverflowCards->rememberObject(objectPtr);
+			}
 			return ;
 		}
 	}
@@ -2309,6 +2692,90 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::scavengeRememberedSetOverflowCards(MM_EnvironmentStandard *env)
+{
+	/* Reset the local remembered set fragment */
+	env->_scavengerRememberedSet.fragmentCurrent = NULL;
+	env->_scavengerRememberedSet.fragmentTop = NULL;
+	env->_scavengerRememberedSet.fragmentSize = (uintptr_t)J9_SCV_REMSET_FRAGMENT_SIZE;
+	env->_scavengerRememberedSet.parentList = &_extensions->rememberedSet;
+
+	/* Record the objects of the list on the cards too, so that every remembered object is found once from the cards */
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			if (NULL != *slotPtr) {
+				_rememberedSetOverflowCards->rememberObject(*slotPtr);
+			}
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		omrtty_printf("{SCAV: Scavenge remembered set overflow cards}\n");
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+		clearRememberedSetLists(env);
+
+		/* Creation of this class will Abort Global Collector */
+		MM_RSOverflow rememberedSetOverflow(env);
+		_rememberedSetOverflowMarkMap = rememberedSetOverflow.getMarkMap();
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Mark the remembered objects of the dirty cards. Nothing has been copied yet, so tenure can be walked. */
+	void *tenureTop = (void *)((uintptr_t)_extensions->heapBaseForBarrierRange0 + _extensions->heapSizeForBarrierRange0);
+	uintptr_t cardCount = _rememberedSetOverflowCards->getCardCount();
+	for (uintptr_t chunk = 0; chunk < cardCount; chunk += RS_OVERFLOW_CARDS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t chunkTop = OMR_MIN(chunk + RS_OVERFLOW_CARDS_PER_WORK_UNIT, cardCount);
+			for (uintptr_t card = chunk; card < chunkTop; card++) {
+				omrobjectptr_t firstObject = _rememberedSetOverflowCards->getFirstObject(card);
+				if (NULL != firstObject) {
+					void *cardTop = OMR_MIN(_rememberedSetOverflowCards->getCardTop(card), tenureTop);
+					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObject, (omrobjectptr_t)cardTop, false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = objectIterator.nextObject())) {
+						if (_extensions->objectModel.isRemembered(objectPtr)) {
+							_rememberedSetOverflowMarkMap->atomicSetBit(objectPtr);
+						}
+					}
+					env->_scavengerStats._rememberedSetOverflowCardsScanned += 1;
+				}
+			}
+		}
+	}
+
+	/* Objects may be copied into tenure as soon as any thread starts scanning */
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
+
+	/*
+	 * Scan the marked objects, but don't adjust their remembered bit.
+	 * Objects that no longer need remembering will be pruned at the end of the scavenge.
+	 */
+	for (uintptr_t chunk = 0; chunk < cardCount; chunk += RS_OVERFLOW_CARDS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t chunkTop = OMR_MIN(chunk + RS_OVERFLOW_CARDS_PER_WORK_UNIT, cardCount);
+			for (uintptr_t card = chunk; card < chunkTop; card++) {
+				if (NULL != _rememberedSetOverflowCards->getFirstObject(card)) {
+					uintptr_t *cardBase = (uintptr_t *)((uintptr_t)_rememberedSetOverflowCards->getCardTop(card) - MM_RSOverflowCardTable::CARD_SIZE);
+					MM_HeapMapIterator markedObjectIterator(_extensions, _rememberedSetOverflowMarkMap, cardBase, (uintptr_t *)_rememberedSetOverflowCards->getCardTop(card));
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+						scavengeRememberedObject(env, objectPtr);
+					}
+				}
+			}
+		}
+	}
+}
+
 MMINLINE void
 MM_Scavenger::flushRememberedSet(MM_EnvironmentStandard *env)
 {
@@ -2321,12 +2788,51 @@ void
 MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
 	if(isRememberedSetInOverflowState()) {
-		pruneRememberedSetOverflow(env);
+		checkRememberedSetOverflowCards();
+		if (_rememberedSetOverflowCardsValid) {
+			pruneRememberedSetOverflowCards(env);
+		} else {
+			pruneRememberedSetOverflow(env);
+		}
+	} else if (0 != _extensions->scavengerRememberedSetRangeSlots) {
+		pruneRememberedSetRanges(env);
 	} else {
 		pruneRememberedSetList(env);
 	}
 }
 
+MMINLINE void
+MM_Scavenger::pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* Check if object still has nursery references, direct or indirect */
+	bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/* Unconditionally remember object if it was recently referenced */
+	if (!shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+		Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+		shouldBeRemembered = true;
+	}
+#endif /* !defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
+	if(shouldBeRemembered) {
+		/* Tenured object remains flagged as remembered */
+		/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
+		addToRememberedSetFragment(env, objectPtr);
+	} else {
+		/* Tenured object remembered flags can be cleared */
+		_extensions->objectModel.clearRemembered(objectPtr);
+#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
+		/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
+		 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
+		 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
+		 * in a more generic spot when object is scavenged and is unnecessary to do it here.
+		 */
+		TRIGGER_J9HOOK_MM_PRIVATE_OLD_TO_OLD_REFERENCE_CREATED(_extensions->privateHookInterface, env->getOmrVMThread(), objectPtr);
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	}
+}
+
 void
 MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 {
@@ -2347,6 +2853,12 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
 
+		/* Every remembered object is found by the walk, so the overflow cards can be used from here on */
+		if (NULL != _rememberedSetOverflowCards) {
+			_rememberedSetOverflowCards->clear();
+			_rememberedSetOverflowCardsValid = true;
+		}
+
 		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
 		MM_HeapRegionDescriptorStandard *region = NULL;
 		GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
@@ -2356,33 +2868,7 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 			omrobjectptr_t objectPtr;
 			while((objectPtr = objectIterator.nextObject()) != NULL) {
 				if(_extensions->objectModel.isRemembered(objectPtr)) {
-					/* Check if object still has nursery references, direct or indirect */
-					bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
-
-#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
-					/* Unconditionally remember object if it was recently referenced */
-					if (!shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
-						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
-						shouldBeRemembered = true;
-					}
-#endif /* !defined(OMR_GC_CONCURRENT_SCAVENGER) */
-
-					if(shouldBeRemembered) {
-						/* Tenured object remains flagged as remembered */
-						/* Add tenured object to the thread's remembered set list if possible. Otherwise, this will force setRememberedSetOverflowState(). */
-						addToRememberedSetFragment(env, objectPtr);
-					} else {
-						/* Tenured object remembered flags can be cleared */
-						_extensions->objectModel.clearRemembered(objectPtr);
-#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
-						/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
-						 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
-						 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
-						 * in a more generic spot when object is scavenged and is unnecessary to do it here.
-						 */
-						TRIGGER_J9HOOK_MM_PRIVATE_OLD_TO_OLD_REFERENCE_CREATED(_extensions->privateHookInterface, env->getOmrVMThread(), objectPtr);
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
-					}
+					pruneRememberedObject(env, objectPtr);
 				}
 			}
 		}
@@ -2402,12 +2888,140 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 	}
 }
 
+void
+MM_Scavenger::pruneRememberedSetOverflowCards(MM_EnvironmentStandard *env)
+{
+	/* Reset the local remembered set fragment */
+	env->_scavengerRememberedSet.fragmentCurrent = NULL;
+	env->_scavengerRememberedSet.fragmentTop = NULL;
+	env->_scavengerRememberedSet.fragmentSize = (uintptr_t)J9_SCV_REMSET_FRAGMENT_SIZE;
+	env->_scavengerRememberedSet.parentList = &_extensions->rememberedSet;
+
+	/* Record the objects of the list on the cards too, so that rebuilding the list from the cards
+	 * finds every remembered object exactly once.
+	 */
+	GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				omrobjectptr_t objectPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+				if (NULL != objectPtr) {
+					_rememberedSetOverflowCards->rememberObject(objectPtr);
+				}
+			}
+		}
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		omrtty_printf("{SCAV: Prune remembered set overflow cards}\n");
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+		/* Clear the overflow state. Objects which still do not fit are recorded on the cards again. */
+		clearRememberedSetOverflowState();
+		clearRememberedSetLists(env);
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Rebuild the list from the remembered objects of the dirty cards. A card is cleaned before it is walked,
+	 * so an object which overflows the list again is left recorded on it for the next scavenge.
+	 */
+	void *tenureTop = (void *)((uintptr_t)_extensions->heapBaseForBarrierRange0 + _extensions->heapSizeForBarrierRange0);
+	uintptr_t cardCount = _rememberedSetOverflowCards->getCardCount();
+	for (uintptr_t chunk = 0; chunk < cardCount; chunk += RS_OVERFLOW_CARDS_PER_WORK_UNIT) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t chunkTop = OMR_MIN(chunk + RS_OVERFLOW_CARDS_PER_WORK_UNIT, cardCount);
+			for (uintptr_t card = chunk; card < chunkTop; card++) {
+				omrobjectptr_t firstObject = _rememberedSetOverflowCards->cleanCard(card);
+				if (NULL != firstObject) {
+					void *cardTop = OMR_MIN(_rememberedSetOverflowCards->getCardTop(card), tenureTop);
+					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, firstObject, (omrobjectptr_t)cardTop, false);
+					omrobjectptr_t objectPtr = NULL;
+					while (NULL != (objectPtr = objectIterator.nextObject())) {
+						if (_extensions->objectModel.isRemembered(objectPtr)) {
+							pruneRememberedObject(env, objectPtr);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/* Objects may have been remembered during scan, fragment must be flushed */
+	flushRememberedSet(env);
+}
+
+MMINLINE bool
+MM_Scavenger::pruneRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
+{
+	bool removeSlot = false;
+	omrobjectptr_t objectPtr = *slotPtr;
+
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+	if((uintptr_t)objectPtr & DEFERRED_RS_REMOVE_FLAG) {
+		/* Is slot flagged for deferred removal ? */
+		/* Yes..so first remove tag bit from object address */
+		objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		/* The object did not have Nursery references at initial RS scan, but one could have been added during CS cycle by a mutator.
+		 */
+		if (!shouldRememberObject(env, objectPtr)) {
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+			omrtty_printf("{SCAV: REMOVED remembered set object %p}\n", objectPtr);
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+			/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
+			_extensions->objectModel.clearRemembered(objectPtr);
+			removeSlot = true;
+#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
+			/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
+			 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
+			 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
+			 * in a more generic spot when object is scavenged and is unnecessary to do it here.
+			 */
+			 TRIGGER_J9HOOK_MM_PRIVATE_OLD_TO_OLD_REFERENCE_CREATED(_extensions->privateHookInterface, env->getOmrVMThread(), objectPtr);
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		} else {
+			/* We are not removing it after all, since the object has Nursery references => reset the deferred flag.
+			 * todo: consider doing double remembering, if remembered during CS cycle, to avoid the rescan of the object
+			 */
+			*slotPtr = objectPtr;
+		}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+	} else {
+		/* Retain remembered object */
+#if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+		omrtty_printf("{SCAV: Remembered set object %p}\n", objectPtr);
+#endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+
+#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
+		if (processRememberedThreadReference(env, objectPtr)) {
+			/* the object was tenured from the stack on a previous scavenge -- keep it around for a bit longer */
+			Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+		}
+#endif
+	}
+
+	return removeSlot;
+}
+
 void
 MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 {
 	/* Remembered set walk */
 	omrobjectptr_t *slotPtr;
-	omrobjectptr_t objectPtr;
 	MM_SublistPuddle *puddle;
 
 #if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
@@ -2420,64 +3034,84 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			GC_SublistSlotIterator remSetSlotIterator(puddle);
 			while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-				objectPtr = *slotPtr;
-
-				if (NULL == objectPtr) {
+				if ((NULL == *slotPtr) || pruneRememberedSetSlot(env, slotPtr)) {
 					remSetSlotIterator.removeSlot();
-				} else if((uintptr_t)objectPtr & DEFERRED_RS_REMOVE_FLAG) {
-					/* Is slot flagged for deferred removal ? */
-					/* Yes..so first remove tag bit from object address */
-					objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
-					/* The object did not have Nursery references at initial RS scan, but one could have been added during CS cycle by a mutator.
-					 */
-					if (!shouldRememberObject(env, objectPtr)) {
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+				}
+			} /* while non-null slots */
+		}
+	}
 #if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
-						omrtty_printf("{SCAV: REMOVED remembered set object %p}\n", objectPtr);
+	omrtty_printf("{SCAV: End prune remembered set list; count = %lld}\n", _extensions->rememberedSet.countElements());
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
+}
 
-						/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
-						_extensions->objectModel.clearRemembered(objectPtr);
-						remSetSlotIterator.removeSlot();
-#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
-						/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set.
-						 * In non-concurrent Scavenger this is the only way to create an old-to-old reference, that has parent object being marked.
-						 * In Concurrent Scavenger, it can be created even with parent object that was not in RS to start with. So this is handled
-						 * in a more generic spot when object is scavenged and is unnecessary to do it here.
-						 */
-						 TRIGGER_J9HOOK_MM_PRIVATE_OLD_TO_OLD_REFERENCE_CREATED(_extensions->privateHookInterface, env->getOmrVMThread(), objectPtr);
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
-					} else {
-						/* We are not removing it after all, since the object has Nursery references => reset the deferred flag.
-						 * todo: consider doing double remembering, if remembered during CS cycle, to avoid the rescan of the object
-						 */
-						*slotPtr = objectPtr;
-					}
-#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+void
+MM_Scavenger::pruneRememberedSetRanges(MM_EnvironmentStandard *env)
+{
+	uintptr_t rangeSlots = _extensions->scavengerRememberedSetRangeSlots;
+	MM_SublistPuddle *puddle = NULL;
 
-				} else {
-					/* Retain remembered object */
 #if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
-					omrtty_printf("{SCAV: Remembered set object %p}\n", objectPtr);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	omrtty_printf("{SCAV: Begin prune remembered set ranges; count = %lld}\n", _extensions->rememberedSet.countElements());
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 
-#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
-					if (processRememberedThreadReference(env, objectPtr)) {
-						/* the object was tenured from the stack on a previous scavenge -- keep it around for a bit longer */
-						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+	/* Each range of each puddle is a work unit. Removed objects have their slot cleared rather than
+	 * being swapped with the last element, and the thread completing the last range of a puddle
+	 * removes the cleared slots.
+	 */
+	GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
+	while (NULL != (puddle = remSetIterator.nextList())) {
+		uintptr_t rangeCount = puddle->getRangeCount(rangeSlots);
+		for (uintptr_t range = 0; range < rangeCount; range++) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				uintptr_t *rangeBase = NULL;
+				uintptr_t *rangeTop = NULL;
+				uintptr_t removedCount = 0;
+				puddle->getRange(rangeSlots, range, &rangeBase, &rangeTop);
+				for (omrobjectptr_t *slotPtr = (omrobjectptr_t *)rangeBase; slotPtr < (omrobjectptr_t *)rangeTop; slotPtr++) {
+					if ((NULL != *slotPtr) && pruneRememberedSetSlot(env, slotPtr)) {
+						*slotPtr = NULL;
+						removedCount += 1;
 					}
-#endif
 				}
-			} /* while non-null slots */
+				_extensions->rememberedSet.decrementCount(removedCount);
+				if (puddle->rangeProcessed(rangeCount)) {
+					puddle->removeNullSlots();
+				}
+			}
 		}
 	}
+
 #if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
-	omrtty_printf("{SCAV: End prune remembered set list; count = %lld}\n", _extensions->rememberedSet.countElements());
+	omrtty_printf("{SCAV: End prune remembered set ranges; count = %lld}\n", _extensions->rememberedSet.countElements());
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
+MMINLINE void
+MM_Scavenger::scavengeRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+
+	/* First assume the object will not be remembered.
+	 * This is helpful for work completion ordering of split arrays.
+	 * Flag slot for later removal if we complete scavenge OK
+	 */
+	*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
+	bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
+	if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
+		shouldBeRemembered |= _cli->scavenger_scavengeIndirectObjectSlots(env, objectPtr);
+	}
+#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
+	shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
+#endif
+	if (shouldBeRemembered) {
+		/* We want to remember this object after all; clear the flag for removal. */
+		*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+	}
+}
+
 void
 MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -2491,28 +3125,9 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
 		omrobjectptr_t *slotPtr;
 		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-			omrobjectptr_t objectPtr = *slotPtr;
-
-			if(NULL != objectPtr) {
-				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+			if(NULL != *slotPtr) {
 				numElements += 1;
-
-				/* First assume the object will not be remembered.
-				 * This is helpful for work completion ordering of split arrays.
-				 * Flag slot for later removal if we complete scavenge OK
-				 */
-				*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
-				bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
-				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
-					shouldBeRemembered |= _cli->scavenger_scavengeIndirectObjectSlots(env, objectPtr);
-				}
-#if !defined(OMR_GC_CONCURRENT_SCAVENGER)
-				shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
-#endif
-				if (shouldBeRemembered) {
-					/* We want to remember this object after all; clear the flag for removal. */
-					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
-				}
+				scavengeRememberedSetSlot(env, slotPtr);
 			} else {
 				remSetSlotIterator.removeSlot();
 			}
@@ -2524,7 +3139,29 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
-/* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
+void
+MM_Scavenger::scavengeRememberedSetRanges(MM_EnvironmentStandard *env)
+{
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
+
+	/* Remembered set walk. Slots can not be removed here, as the puddle of a range may be shared
+	 * with other threads: NULL slots are left for pruning.
+	 */
+	uintptr_t rangeSlots = _extensions->scavengerRememberedSetRangeSlots;
+	uintptr_t *rangeBase = NULL;
+	uintptr_t *rangeTop = NULL;
+	while (_extensions->rememberedSet.popPreviousRange(rangeSlots, &rangeBase, &rangeTop)) {
+		for (omrobjectptr_t *slotPtr = (omrobjectptr_t *)rangeBase; slotPtr < (omrobjectptr_t *)rangeTop; slotPtr++) {
+			if (NULL != *slotPtr) {
+				scavengeRememberedSetSlot(env, slotPtr);
+			}
+		}
+	}
+
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
+}
+
+/* NOTE - only  scavengeRememberedSetOverflow ends with a sync point (scavengeRememberedSetOverflowCards has sync points, but does not end with one).
  * Callers of this function must not assume that there is a sync point
  */
 void
@@ -2532,7 +3169,14 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 {
 	if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
-		scavengeRememberedSetOverflow(env);
+		checkRememberedSetOverflowCards();
+		if (_rememberedSetOverflowCardsValid) {
+			scavengeRememberedSetOverflowCards(env);
+		} else {
+			scavengeRememberedSetOverflow(env);
+		}
+	} else if (0 != _extensions->scavengerRememberedSetRangeSlots) {
+		scavengeRememberedSetRanges(env);
 	} else {
 		scavengeRememberedSetList(env);
 	}
@@ -2913,6 +3557,24 @@ MM_Scavenger::abandonTLHRemainders(MM_EnvironmentStandard *env)
 	abandonTenureTLHRemainder(env);
 }
 
+void
+MM_Scavenger::abandonNodeSlices(MM_EnvironmentStandard *env)
+{
+	/* the survivor ranges are returned to their pool by the master once all threads are done */
+	if (NULL != _tenureNodeSlices) {
+		NodeAllocationSlice *tenureSlice = &_tenureNodeSlices[env->_scavengerNodeIndex];
+		tenureSlice->_lock.acquire();
+		if (NULL != tenureSlice->_base) {
+			env->_scavengerStats._tenureDiscardBytes += (uintptr_t)tenureSlice->_top - (uintptr_t)tenureSlice->_base;
+			_tenureMemorySubSpace->abandonHeapChunk(tenureSlice->_base, tenureSlice->_top);
+			tenureSlice->_base = NULL;
+			tenureSlice->_top = NULL;
+			tenureSlice->_loaAllocation = false;
+		}
+		tenureSlice->_lock.release();
+	}
+}
+
 void
 MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 {
@@ -2939,7 +3601,7 @@ MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	_scavengeCacheScanLists[env->_scavengerNodeIndex].pushCache(env, newCacheEntry);
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3007,8 +3669,36 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	uintptr_t nodeIndex = env->_scavengerNodeIndex;
+	MM_CopyScanCacheStandard *cache = _scavengeCacheScanLists[nodeIndex].popCache(env);
+	if (NULL != cache) {
+		env->_scavengerStats._localNodeStats._scanCount += 1;
+	} else {
+		/* only take work from a remote node once the local list is exhausted */
+		for (uintptr_t i = 1; (NULL == cache) && (i < _scavengeNodeCount); i++) {
+			nodeIndex += 1;
+			if (nodeIndex == _scavengeNodeCount) {
+				nodeIndex = 0;
+			}
+			cache = _scavengeCacheScanLists[nodeIndex].popCache(env);
+		}
+		if (NULL != cache) {
+			env->_scavengerStats._localNodeStats._stealCount += 1;
+		}
+	}
+
+	return cache;
+}
+
+uintptr_t
+MM_Scavenger::getApproximateScanListEntryCount()
+{
+	uintptr_t count = 0;
+	for (uintptr_t node = 0; node < _scavengeNodeCount; node++) {
+		count += _scavengeCacheScanLists[node].getApproximateEntryCount();
 	}
+	return count;
+}
 
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getDeferredCopyCache(MM_EnvironmentStandard *env)
@@ -3436,8 +4126,10 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		/* 1) Flush copy scan caches */
 		MM_CopyScanCacheStandard *cache = NULL;
 
-		while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
-			flushCache(env, cache);
+		for (uintptr_t node = 0; node < _scavengeNodeCount; node++) {
+			while (NULL != (cache = _scavengeCacheScanLists[node].popCache(env))) {
+				flushCache(env, cache);
+			}
 		}
 #endif
 		Assert_MM_true(0 == _cachedEntryCount);
@@ -3504,6 +4196,8 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			/* ii) Walk old space and build up the overflow list */
 			/* the list is built because after reverse fwd ptrs are installed, the heap becomes unwalkable */
 			clearRememberedSetLists(env);
+			/* the objects of the list are not on the overflow cards */
+			_rememberedSetOverflowCardsValid = false;
 
 			MM_RSOverflow rememberedSetOverflow(env);
 			addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
@@ -4174,6 +4868,13 @@ MM_Scavenger::globalCollectionComplete(MM_EnvironmentBase *env)
 	_extensions->scavengerStats._nextScavengeWillPercolate = false;
 	setFailedTenureLargestObject(0);
 	_countSinceForcingGlobalGC = 0;
+
+	/* The global collection may have freed, and reused, memory that objects recorded on the overflow cards were
+	 * walked from: the next remembered set overflow processing must walk tenure.
+	 */
+	if (isRememberedSetInOverflowState()) {
+		_rememberedSetOverflowCardsValid = false;
+	}
 }
 
 void
@@ -4644,11 +5345,15 @@ MM_Scavenger::scavengeComplete(MM_EnvironmentBase *envBase)
 		MM_EnvironmentStandard *threadEnvironment = MM_EnvironmentStandard::getEnvironment(walkThread);
 		if (MUTATOR_THREAD == threadEnvironment->getThreadType()) {
 			mutatorFinalReleaseCopyCaches(env, threadEnvironment);
+			if (!isMutatorThreadInSyncWithCycle(threadEnvironment)) {
+				_unswitchedThreadRootsPending = true;
+			}
 		}
 	}
 
 	MM_ConcurrentScavengeTask scavengeTask(env, _dispatcher, this, MM_ConcurrentScavengeTask::SCAVENGE_COMPLETE, U_64_MAX, NULL, env->_cycleState);
 	_dispatcher->run(env, &scavengeTask);
+	_unswitchedThreadRootsPending = false;
 
 	return false;
 }
@@ -4759,6 +5464,12 @@ MM_Scavenger::workThreadComplete(MM_EnvironmentStandard *env)
 {
 	MM_ScavengerRootScanner rootScanner(env, this);
 
+	/* Every thread reads the same value, set before the task was dispatched, so either all or none of them synchronize */
+	if (_unswitchedThreadRootsPending && env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		scanUnswitchedThreadRoots(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
 	/* Complete scan loop regardless if we already aborted. If so, the scan operation will just fix up pointers that still point to forwarded objects.
 	 * This is important particularly for Tenure space where recovery procedure will not walk the Tenure space for exhaustive fixup.
 	 */
@@ -4772,6 +5483,7 @@ MM_Scavenger::workThreadComplete(MM_EnvironmentStandard *env)
 
 	addCopyCachesToFreeList(env);
 	abandonTLHRemainders(env);
+	abandonNodeSlices(env);
 
 	/* If -Xgc:fvtest=forceScavengerBackout has been specified, set backout flag every 3rd scavenge */
 	if(_extensions->fvtest_forceScavengerBackout) {
@@ -4854,10 +5566,34 @@ MM_Scavenger::switchConcurrentForThread(MM_EnvironmentBase *env)
 	if (env->_concurrentScavengerSwitchCount != _concurrentScavengerSwitchCount) {
 		Trc_MM_Scavenger_switchConcurrent(env->getLanguageVMThread(), _concurrentState, _concurrentScavengerSwitchCount, env->_concurrentScavengerSwitchCount);
 		env->_concurrentScavengerSwitchCount = _concurrentScavengerSwitchCount;
+		if (isConcurrentInProgress()) {
+			/* A cycle has started. Thread roots are not scanned in the STW start phase; each thread scans its own at this safe point */
+			MM_ScavengerRootScanner rootScanner(env, this);
+			rootScanner.scanThreadRoots(MM_EnvironmentStandard::getEnvironment(env), env->getOmrVMThread());
+		}
 		_cli->scavenger_switchConcurrentForThread(env);
 	}
 }
 
+void
+MM_Scavenger::scanUnswitchedThreadRoots(MM_EnvironmentStandard *env)
+{
+	MM_ScavengerRootScanner rootScanner(env, this);
+	GC_OMRVMThreadListIterator threadIterator(_extensions->getOmrVM());
+	OMR_VMThread *walkThread = NULL;
+
+	while((walkThread = threadIterator.nextOMRVMThread()) != NULL) {
+		MM_EnvironmentStandard *threadEnvironment = MM_EnvironmentStandard::getEnvironment(walkThread);
+		if ((MUTATOR_THREAD == threadEnvironment->getThreadType()) && !isMutatorThreadInSyncWithCycle(threadEnvironment)) {
+			/* The thread has not reached a safe point since the cycle started, so scan its roots on its behalf.
+			 * Bring it in sync, so that it only switches for the end of the cycle.
+			 */
+			rootScanner.scanThreadRoots(env, walkThread);
+			threadEnvironment->_concurrentScavengerSwitchCount = _concurrentScavengerSwitchCount;
+		}
+	}
+}
+
 void
 MM_Scavenger::triggerConcurrentScavengerTransition(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription)
 {
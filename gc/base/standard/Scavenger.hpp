@@ -33,6 +33,7 @@
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MasterGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
@@ -43,11 +44,13 @@ class MM_CollectorLanguageInterface;
 class MM_Dispatcher;
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
+class MM_MarkMap;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
 class MM_PhysicalSubArena;
 class MM_RSOverflow;
+class MM_RSOverflowCardTable;
 class MM_SublistPool;
 
 struct OMR_VM;
@@ -64,6 +67,9 @@ class MM_Scavenger : public MM_Collector
 private:
 	const uintptr_t _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
 	bool _isRememberedSetInOverflowAtTheBeginning; /**< Cached RS Overflow flag at the beginning of the scavenge */
+	MM_RSOverflowCardTable *_rememberedSetOverflowCards; /**< cards recording the remembered objects which did not fit in an overflowed remembered set, NULL unless scavengerRememberedSetOverflowCards is set */
+	volatile bool _rememberedSetOverflowCardsValid; /**< true if every remembered object missing from the remembered set list is recorded on _rememberedSetOverflowCards */
+	MM_MarkMap *_rememberedSetOverflowMarkMap; /**< mark map borrowed from the global collector to find the remembered objects of the dirty overflow cards */
 
 	MM_GCExtensionsBase *_extensions;
 	
@@ -90,11 +96,29 @@ private:
 	uintptr_t _minTenureFailureSize;
 	uintptr_t _minSemiSpaceFailureSize;
 
+	uintptr_t _allocatedBytes; /**< bytes allocated in the nursery since the previous scavenge, for adaptive GC threading */
+	uintptr_t _previousAllocatedBytes; /**< bytes allocated in the nursery before the previous scavenge */
+	uintptr_t _previousCopiedBytes; /**< bytes flipped and tenured by the previous scavenge */
+
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics;  /** Common collect stats (memory, time etc.) */
 
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
-	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
+	MM_CopyScanCacheList *_scavengeCacheScanLists; /**< scan lists, one per NUMA node (a single list unless NUMA-local scavenging is enabled) */
+	uintptr_t _scavengeNodeCount; /**< number of NUMA nodes the scavenge work is split across (number of entries in _scavengeCacheScanLists) */
+
+	/**
+	 * A contiguous piece of survivor or tenure memory, bound to one NUMA node, shared by the copy caches of all threads on that node
+	 */
+	struct NodeAllocationSlice {
+		MM_LightweightNonReentrantLock _lock; /**< protects the slice bounds */
+		void *_base; /**< start of the unused part of the slice */
+		void *_top; /**< end of the slice */
+		bool _loaAllocation; /**< true if the slice was allocated in the LOA */
+	};
+	NodeAllocationSlice *_survivorNodeSlices; /**< per-node survivor ranges, NULL unless NUMA-local scavenging is enabled */
+	NodeAllocationSlice *_tenureNodeSlices; /**< per-node tenure slices, NULL unless NUMA-local scavenging is enabled */
+	bool _survivorNodeRangesActive; /**< true while the survivor space is taken out of its pool and split across _survivorNodeSlices for the current scavenge */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
@@ -130,6 +154,7 @@ private:
 	} _concurrentState;
 	
 	uint64_t _concurrentScavengerSwitchCount; /**< global counter of cycle start and cycle end transitions */
+	bool _unswitchedThreadRootsPending; /**< true if some mutator threads have not scanned their own roots by the STW end phase of a cycle */
 	
 	/* TODO: put it parent Collector class and share with Balanced? */ 
 	volatile bool _forceConcurrentTermination;
@@ -199,6 +224,8 @@ public:
 
 	MMINLINE bool copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_t *objectPtrIndirect);
 
+	void depthCopyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
 	MMINLINE omrobjectptr_t copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader);
 
 	MMINLINE void updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanned, uint64_t slotsCopied);
@@ -216,12 +243,41 @@ public:
 	MMINLINE void incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, MM_CopyScanCacheStandard* scanCache, MM_CopyScanCacheStandard **nextScanCache);
 
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+	MMINLINE void scavengeRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
+	/**
+	 * Process a remembered set slot which is not NULL at the end of a scavenge.
+	 * @param env The environment.
+	 * @param slotPtr The remembered set slot.
+	 * @return true if the object is no longer remembered and its slot must be removed.
+	 */
+	MMINLINE bool pruneRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
+
+	/**
+	 * Keep a remembered tenured object which is not in the remembered set list remembered, adding it to the list,
+	 * if it still has nursery references or was recently referenced from a thread; otherwise clear its remembered state.
+	 */
+	MMINLINE void pruneRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Scavenge and prune the remembered set list in ranges of scavengerRememberedSetRangeSlots slots rather than
+	 * whole puddles, so that large puddles are shared between threads.
+	 */
+	void scavengeRememberedSetRanges(MM_EnvironmentStandard *env);
+	void pruneRememberedSetRanges(MM_EnvironmentStandard *env);
+
+	/**
+	 * Scavenge and prune the remembered set in overflow when the objects which are not in the list are all
+	 * recorded on _rememberedSetOverflowCards: only the dirty cards are walked, in parallel.
+	 */
+	void scavengeRememberedSetOverflowCards(MM_EnvironmentStandard *env);
+	void pruneRememberedSetOverflowCards(MM_EnvironmentStandard *env);
+
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -276,6 +332,78 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+
+	/**
+	 * @return the approximate number of caches on the scan lists of all nodes
+	 */
+	uintptr_t getApproximateScanListEntryCount();
+
+	/**
+	 * Determine the NUMA node whose scan list and allocation slices the given thread uses during a scavenge.
+	 * With physical NUMA support a GC slave thread without node affinity is bound to the node it is assigned to.
+	 * @param env - current thread environment
+	 * @return index of the node in the range [0, _scavengeNodeCount)
+	 */
+	uintptr_t selectScavengeNode(MM_EnvironmentStandard *env);
+
+	/**
+	 * Bind the pages wholly inside the given range to the NUMA node with the given index.
+	 * Does nothing without physical NUMA support. The binding is a placement preference for pages not yet touched.
+	 * @param env - current thread environment
+	 * @param nodeIndex index of the node in the range [0, _scavengeNodeCount)
+	 * @param base start of the range
+	 * @param top end of the range
+	 */
+	void bindToScavengeNode(MM_EnvironmentStandard *env, uintptr_t nodeIndex, void *base, void *top);
+
+	/**
+	 * Take the survivor space out of its memory pool and split it into one range per node, each bound to its node.
+	 * Only done if the survivor space is entirely free, otherwise copy caches come from the pool for this scavenge.
+	 * @param env - master thread environment
+	 */
+	void splitSurvivorIntoNodeRanges(MM_EnvironmentStandard *env);
+
+	/**
+	 * Give the unused part of each node's survivor range back to the survivor memory pool.
+	 * Must only be called once no thread can copy any more objects.
+	 * @param env - master thread environment
+	 */
+	void returnSurvivorNodeRanges(MM_EnvironmentStandard *env);
+
+	/**
+	 * Carve copy cache memory out of the survivor range of the current thread's node, or out of another node's range once it is used up.
+	 * @param env - current thread environment
+	 * @param cacheSize minimum number of bytes required
+	 * @param preferredSize preferred number of bytes
+	 * @param discardThreshold a range remainder smaller than this is given away with the cache instead of kept
+	 * @param[out] addrBase base of the allocated memory
+	 * @param[out] addrTop top of the allocated memory
+	 * @return true if memory was allocated
+	 */
+	bool allocateFromSurvivorNodeRanges(MM_EnvironmentStandard *env, uintptr_t cacheSize, uintptr_t preferredSize, uintptr_t discardThreshold, void* &addrBase, void* &addrTop);
+
+	/**
+	 * Carve copy cache memory out of the slice of the current thread's node, replacing the slice if it cannot hold the object.
+	 * @param env - current thread environment
+	 * @param slice the node slice to allocate from
+	 * @param subSpace the memory subspace the slice belongs to
+	 * @param allocDescription description used to allocate a new slice
+	 * @param cacheSize minimum number of bytes required
+	 * @param scanCacheSize preferred number of bytes
+	 * @param discardThreshold a slice remainder smaller than this is given away with the cache instead of kept
+	 * @param[out] addrBase base of the allocated memory
+	 * @param[out] addrTop top of the allocated memory
+	 * @param[out] loaAllocation set to true if the memory is in the LOA
+	 * @return true if memory was allocated
+	 */
+	bool allocateFromNodeSlice(MM_EnvironmentStandard *env, NodeAllocationSlice *slice, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uintptr_t cacheSize, uintptr_t scanCacheSize, uintptr_t discardThreshold, void* &addrBase, void* &addrTop, bool *loaAllocation);
+
+	/**
+	 * Return the unused part of the current thread's node tenure slice to its memory pool.
+	 * Must only be called once no thread can copy any more objects.
+	 * @param env - current thread environment
+	 */
+	void abandonNodeSlices(MM_EnvironmentStandard *env);
 	MMINLINE MM_CopyScanCacheStandard *getSurvivorCopyCache(MM_EnvironmentStandard *env);
 	MMINLINE MM_CopyScanCacheStandard *getDeferredCopyCache(MM_EnvironmentStandard *env);
 
@@ -395,6 +523,18 @@ public:
 	MMINLINE void setRememberedSetOverflowState() { _extensions->setRememberedSetOverflowState(); }
 	MMINLINE void clearRememberedSetOverflowState() { _extensions->clearRememberedSetOverflowState(); }
 
+	/**
+	 * Stop trusting the overflow cards if objects overflowed the remembered set without being recorded on them.
+	 * The cards are trusted again once the overflow has been pruned by a tenure walk.
+	 */
+	MMINLINE void
+	checkRememberedSetOverflowCards()
+	{
+		if (_extensions->isRememberedSetOverflowUncarded()) {
+			_rememberedSetOverflowCardsValid = false;
+		}
+	}
+
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/* Auto-remember stack objects so JIT can omit generational barriers */
 	void rescanThreadSlots(MM_EnvironmentStandard *env);
@@ -425,6 +565,13 @@ public:
 	void calcGCStats(MM_EnvironmentStandard *env);
 
 	void scavenge(MM_EnvironmentBase *env);
+
+	/**
+	 * Under adaptive GC threading, estimate how many threads the scavenge can keep busy: the nursery is
+	 * expected to survive at the rate of the previous scavenge, and each remembered object is a root to scan.
+	 * @return the recommended thread count, or UDATA_MAX if there is no basis for an estimate
+	 */
+	uintptr_t getRecommendedScavengeThreads(MM_EnvironmentStandard *env);
 	bool scavengeCompletedSuccessfully(MM_EnvironmentStandard *env);
 	virtual	void masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap = false, bool rebuildMarkBits = false);
 
@@ -564,9 +711,16 @@ public:
 	}
 
 	/**
-	 * Enabled/disable approriate thread local resources when starting or finishing Concurrent Scavenger Cycle
+	 * Enabled/disable approriate thread local resources when starting or finishing Concurrent Scavenger Cycle.
+	 * On cycle start, the thread also scans its own roots, since these are not scanned in the STW start phase.
 	 */ 
 	void switchConcurrentForThread(MM_EnvironmentBase *env);	
+
+	/**
+	 * Scan the roots of the mutator threads that have not reached a safe point (and so not switched) since
+	 * the cycle started. Called by a single thread in the STW end phase.
+	 */
+	void scanUnswitchedThreadRoots(MM_EnvironmentStandard *env);
 #endif
 
 	/**
@@ -694,6 +848,9 @@ public:
 		MM_Collector(cli)
 		, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
 		, _isRememberedSetInOverflowAtTheBeginning(false)
+		, _rememberedSetOverflowCards(NULL)
+		, _rememberedSetOverflowCardsValid(false)
+		, _rememberedSetOverflowMarkMap(NULL)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _doneIndex(0)
@@ -712,8 +869,16 @@ public:
 		, _expandTenureOnFailedAllocate(true)
 		, _minTenureFailureSize(UDATA_MAX)
 		, _minSemiSpaceFailureSize(UDATA_MAX)
+		, _allocatedBytes(0)
+		, _previousAllocatedBytes(0)
+		, _previousCopiedBytes(0)
 		, _cycleState()
 		, _collectionStatistics()
+		, _scavengeCacheScanLists(NULL)
+		, _scavengeNodeCount(1)
+		, _survivorNodeSlices(NULL)
+		, _tenureNodeSlices(NULL)
+		, _survivorNodeRangesActive(false)
 		, _cachedEntryCount(0)
 		, _cachesPerThread(0)
 		, _scanCacheMonitor(NULL)
@@ -732,6 +897,7 @@ public:
 		, _masterGCThread(env)
 		, _concurrentState(concurrent_state_idle)
 		, _concurrentScavengerSwitchCount(0)
+		, _unswitchedThreadRootsPending(false)
 		, _forceConcurrentTermination(false)
 #endif		
 		, _omrVM(env->getOmrVM())
@@ -0,0 +1,340 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+#include "Packet.hpp"
+#include "Task.hpp"
+#include "WorkPacketsStealing.hpp"
+
+/**
+ * Instantiate a MM_WorkPacketsStealing
+ * @return pointer to the new object
+ */
+MM_WorkPacketsStealing *
+MM_WorkPacketsStealing::newInstance(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketsStealing *workPackets;
+
+	workPackets = (MM_WorkPacketsStealing *)env->getForge()->allocate(sizeof(MM_WorkPacketsStealing), MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL != workPackets) {
+		new(workPackets) MM_WorkPacketsStealing(env);
+		if (!workPackets->initialize(env)) {
+			workPackets->kill(env);
+			workPackets = NULL;
+		}
+	}
+
+	return workPackets;
+}
+
+/**
+ * Initialize a MM_WorkPacketsStealing object
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkPacketsStealing::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_WorkPacketsStandard::initialize(env)) {
+		return false;
+	}
+
+	_dequeCount = OMR_MAX(_extensions->gcThreadCount, 1);
+	_deques = (MM_PacketDeque *)env->getForge()->allocate(sizeof(MM_PacketDeque) * _dequeCount, MM_AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _deques) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		/* any distinct non-zero seed will do */
+		_deques[i].initialize((i + 1) * 0x9E3779B9);
+	}
+
+	return true;
+}
+
+/**
+ * Destroy the resources a MM_WorkPacketsStealing is responsible for
+ */
+void
+MM_WorkPacketsStealing::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _deques) {
+		env->getForge()->free(_deques);
+		_deques = NULL;
+	}
+
+	MM_WorkPacketsStandard::tearDown(env);
+}
+
+/**
+ * Determine whether any deque holds a packet
+ * @return true if yes, false if no
+ */
+bool
+MM_WorkPacketsStealing::dequePacketAvailable()
+{
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		if (!_deques[i].isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Steal a packet from the deque of another thread, starting at a random victim.
+ * @param ownDeque the deque of the calling thread, used to pick victims
+ * @return a packet, or NULL if every deque appeared empty or all steal attempts lost their race
+ */
+MM_Packet *
+MM_WorkPacketsStealing::stealPacket(MM_EnvironmentBase *env, MM_PacketDeque *ownDeque)
+{
+	MM_Packet *packet = NULL;
+	uintptr_t victim = ownDeque->nextVictim(_dequeCount);
+
+	for (uintptr_t i = 0; (NULL == packet) && (i < _dequeCount); i++) {
+		MM_PacketDeque *deque = &_deques[victim];
+		if ((deque != ownDeque) && !deque->isEmpty()) {
+			packet = deque->steal();
+		}
+		victim += 1;
+		if (victim == _dequeCount) {
+			victim = 0;
+		}
+	}
+
+	if (NULL != packet) {
+		env->_workPacketStats._packetsStolen += 1;
+	}
+
+	return packet;
+}
+
+/**
+ * Take a packet from the calling thread's own deque, or failing that steal one from another thread.
+ * @param ownDeque the deque of the calling thread
+ * @return a packet, or NULL if none could be taken
+ */
+MM_Packet *
+MM_WorkPacketsStealing::takePacket(MM_EnvironmentBase *env, MM_PacketDeque *ownDeque)
+{
+	MM_Packet *packet = ownDeque->pop();
+
+	if (NULL != packet) {
+		env->_workPacketStats._packetsPopped += 1;
+	} else {
+		packet = stealPacket(env, ownDeque);
+	}
+
+	return packet;
+}
+
+/**
+ * Determine whether an input packet is available
+ * @return true if yes, false if no
+ */
+bool
+MM_WorkPacketsStealing::inputPacketAvailable(MM_EnvironmentBase *env)
+{
+	return dequePacketAvailable() || MM_WorkPacketsStandard::inputPacketAvailable(env);
+}
+
+/**
+ * Get an input packet if one is available. The calling thread's own deque is tried first,
+ * then the deques of the other threads, then the shared lists.
+ *
+ * @return pointer to a packet, or NULL if none available
+ */
+MM_Packet *
+MM_WorkPacketsStealing::getInputPacketNoWait(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	MM_PacketDeque *ownDeque = getOwnDeque(env);
+
+	if (NULL != ownDeque) {
+		packet = takePacket(env, ownDeque);
+	}
+
+	if (NULL != packet) {
+		packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	} else {
+		packet = MM_WorkPacketsStandard::getInputPacketNoWait(env);
+	}
+
+	return packet;
+}
+
+/**
+ * Get an input packet, or wait until all threads of the task have run out of work.
+ * Termination is detected without the input list monitor: a thread going idle atomically increments
+ * the idle count in _idleState, and the last thread to do so advances the epoch instead, which every
+ * idle thread observes while polling for work. An idle thread that sees new work decrements the count
+ * again, provided the epoch has not moved on.
+ *
+ * @return Pointer to an input packet, or NULL once all threads are done
+ */
+MM_Packet *
+MM_WorkPacketsStealing::getInputPacket(MM_EnvironmentBase *env)
+{
+	if (NULL == getOwnDeque(env)) {
+		return MM_WorkPacketsStandard::getInputPacket(env);
+	}
+
+	const uintptr_t idleCountMask = ((uintptr_t)1 << _idleEpochShift) - 1;
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	bool mustSyncThreadsAndExit = env->_currentTask->shouldYieldFromTask(env);
+	MM_Packet *packet = NULL;
+
+	while (true) {
+		if (!mustSyncThreadsAndExit) {
+			while (inputPacketAvailable(env)) {
+				if (NULL != (packet = getInputPacketNoWait(env))) {
+					return packet;
+				}
+			}
+		}
+
+		/* Go idle, or terminate if this is the last thread still looking for work */
+		uintptr_t oldState = _idleState;
+		uintptr_t epoch = oldState >> _idleEpochShift;
+		uintptr_t newState = oldState + 1;
+		if ((newState & idleCountMask) == threadCount) {
+			if (!mustSyncThreadsAndExit && inputPacketAvailable(env)) {
+				continue;
+			}
+			newState = (epoch + 1) << _idleEpochShift;
+		}
+		if (oldState != MM_AtomicOperations::lockCompareExchange(&_idleState, oldState, newState)) {
+			continue;
+		}
+		if (0 == (newState & idleCountMask)) {
+			return NULL;
+		}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t waitStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		/* Poll until either another thread terminates the epoch or new work shows up */
+		bool terminated = false;
+		uintptr_t spins = 0;
+		while (true) {
+			uintptr_t state = _idleState;
+			if (epoch != (state >> _idleEpochShift)) {
+				terminated = true;
+				break;
+			}
+			if (!mustSyncThreadsAndExit && inputPacketAvailable(env)) {
+				if (state == MM_AtomicOperations::lockCompareExchange(&_idleState, state, state - 1)) {
+					break;
+				}
+			} else if (spins < _idleSpinLimit) {
+				spins += 1;
+				MM_AtomicOperations::yieldCPU();
+			} else {
+				omrthread_yield();
+			}
+		}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (terminated) {
+			env->_workPacketStats.addToCompleteStallTime(waitStartTime, omrtime_hires_clock());
+		} else {
+			env->_workPacketStats.addToWorkStallTime(waitStartTime, omrtime_hires_clock());
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		if (terminated) {
+			return NULL;
+		}
+	}
+}
+
+/**
+ * Put a packet back. Non-empty packets returned by a GC thread during a task go to its own deque;
+ * everything else, or anything that does not fit, goes to the shared lists.
+ *
+ * @param packet The packet to put back
+ */
+void
+MM_WorkPacketsStealing::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	MM_PacketDeque *ownDeque = getOwnDeque(env);
+
+	if ((NULL != ownDeque) && !packet->isEmpty()) {
+		packet->resetOwner();
+		if (ownDeque->push(packet)) {
+			/* idle threads poll the deques, so there is nobody to notify */
+			env->_workPacketStats._packetsPushed += 1;
+			return;
+		}
+	}
+
+	MM_WorkPacketsStandard::putPacket(env, packet);
+}
+
+/**
+ * Get a packet by emptying a full packet. Full packets normally sit in the deques rather than on the
+ * shared full list, so if the shared lists have nothing to offer one of the deques is emptied to overflow.
+ *
+ * @return pointer to a packet, or NULL
+ */
+MM_Packet *
+MM_WorkPacketsStealing::getPacketByOverflowing(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = MM_WorkPacketsStandard::getPacketByOverflowing(env);
+
+	if (NULL == packet) {
+		MM_PacketDeque *ownDeque = getOwnDeque(env);
+		if (NULL != ownDeque) {
+			packet = takePacket(env, ownDeque);
+			if (NULL != packet) {
+				packet->setOwner(env);
+				emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
+			}
+		}
+	}
+
+	return packet;
+}
+
+/**
+ * Move the packets left in the deques to the shared lists, then reset all packets.
+ */
+void
+MM_WorkPacketsStealing::resetAllPackets(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		MM_Packet *packet = NULL;
+		while (NULL != (packet = _deques[i].steal())) {
+			MM_WorkPacketsStandard::putPacket(env, packet);
+		}
+		Assert_MM_true(_deques[i].isEmpty());
+	}
+
+	MM_WorkPacketsStandard::resetAllPackets(env);
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(WORKPACKETSSTEALING_HPP_)
+#define WORKPACKETSSTEALING_HPP_
+
+#include "ModronAssertions.h"
+#include "PacketDeque.hpp"
+#include "WorkPacketsStandard.hpp"
+
+/**
+ * Work packets that hand non-empty packets between GC threads through per-thread work-stealing deques.
+ * A GC thread returns the packets it fills to its own deque and takes them back from there first, so
+ * the common exchange never touches the locked shared lists. An idle thread steals the oldest packet
+ * of a randomly chosen victim. Empty packets, overflow and packets returned outside of a task still
+ * go through the shared lists. Idle threads spin on a single atomic word rather than waiting on the
+ * input list monitor, so neither termination nor new work requires a notify. Every thread of a task
+ * has a deque, so they all terminate through that word; only a thread outside of any task (which has
+ * nobody to terminate with) uses the shared lists alone.
+ */
+class MM_WorkPacketsStealing : public MM_WorkPacketsStandard
+{
+/*
+ * Data members
+ */
+private:
+	enum {
+		_idleEpochShift = sizeof(uintptr_t) * 4, /**< the high half of _idleState is the epoch, the low half the idle thread count */
+		_idleSpinLimit = 64 /**< number of polls with yieldCPU() before an idle thread starts yielding to the OS */
+	};
+
+	MM_PacketDeque *_deques; /**< one deque per GC thread, indexed by slave ID */
+	uintptr_t _dequeCount; /**< number of entries in _deques */
+	volatile uintptr_t _idleState; /**< termination epoch and number of task threads currently idle in getInputPacket() */
+
+protected:
+
+public:
+
+/*
+ * Function members
+ */
+private:
+	/**
+	 * @return the deque owned by the calling thread, or NULL if it is not running a task
+	 */
+	MMINLINE MM_PacketDeque *
+	getOwnDeque(MM_EnvironmentBase *env)
+	{
+		MM_PacketDeque *deque = NULL;
+		if (NULL != env->_currentTask) {
+			/* slave IDs range up to the GC thread count, which the deques are sized for */
+			uintptr_t slaveID = env->getSlaveID();
+			Assert_MM_true(slaveID < _dequeCount);
+			deque = &_deques[slaveID];
+		}
+		return deque;
+	}
+
+	MM_Packet *takePacket(MM_EnvironmentBase *env, MM_PacketDeque *ownDeque);
+	MM_Packet *stealPacket(MM_EnvironmentBase *env, MM_PacketDeque *ownDeque);
+	bool dequePacketAvailable();
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+	virtual MM_Packet *getPacketByOverflowing(MM_EnvironmentBase *env);
+
+public:
+	static MM_WorkPacketsStealing *newInstance(MM_EnvironmentBase *env);
+
+	virtual MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
+	virtual MM_Packet *getInputPacket(MM_EnvironmentBase *env);
+	virtual void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	virtual bool inputPacketAvailable(MM_EnvironmentBase *env);
+	virtual void resetAllPackets(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a WorkPackets object.
+	 */
+	MM_WorkPacketsStealing(MM_EnvironmentBase *env) :
+		MM_WorkPacketsStandard(env)
+		,_deques(NULL)
+		,_dequeCount(0)
+		,_idleState(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* WORKPACKETSSTEALING_HPP_ */
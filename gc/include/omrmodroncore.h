@@ -99,6 +99,7 @@ enum {
 #define J9VMSTATE_GC_PERFORM_RESIZE (J9VMSTATE_GC | 0x0021)
 #define J9VMSTATE_GC_DISPATCHER_IDLE (J9VMSTATE_GC | 0x0025)
 #define J9VMSTATE_GC_CONCURRENT_SCAVENGER (J9VMSTATE_GC | 0x0026)
+#define J9VMSTATE_GC_HEAP_WALK (J9VMSTATE_GC | 0x0027)
 #define J9VMSTATE_GC_CARD_CLEANER_FOR_MARKING (J9VMSTATE_GC | 0x0101)
 
 /**
@@ -30,6 +30,7 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhMaxAllocationRate = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -63,6 +64,14 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 		MM_AtomicOperations::lockCompareExchange(
 			&_tlhMaxAbandonedListSize, prevMax, stats->_tlhMaxAbandonedListSize);
 	}
+	/* looping to set a maximum value in _tlhMaxAllocationRate */
+	for (
+			uintptr_t prevMax = _tlhMaxAllocationRate;
+			prevMax < stats->_tlhMaxAllocationRate;
+			prevMax = _tlhMaxAllocationRate) {
+		MM_AtomicOperations::lockCompareExchange(
+			&_tlhMaxAllocationRate, prevMax, stats->_tlhMaxAllocationRate);
+	}
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -37,6 +37,7 @@ public:
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhMaxAllocationRate; /**< The highest allocation rate, in bytes per millisecond, measured for a thread by adaptive TLH sizing. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 #if defined(OMR_GC_ARRAYLETS)
@@ -84,6 +85,7 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhMaxAllocationRate(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 #if defined(OMR_GC_ARRAYLETS)
 		_arrayletLeafAllocationCount(0),
@@ -46,6 +46,9 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _windowBytes; /**< heap bytes a partial compaction evacuated objects from, 0 if the whole heap was compacted */
+	uintptr_t _remappedObjects; /**< moved objects whose pages were remapped rather than copied */
+	uintptr_t _remappedBytes; /**< bytes of the moved objects that were remapped rather than copied */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
@@ -46,6 +46,8 @@ public:
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
 	
+	volatile uintptr_t releasedCleaningChunks;
+	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
 		MM_AtomicOperations::set((uintptr_t *)&counter,(uintptr_t)count);
@@ -71,6 +73,9 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+		
+		/* Unfinished chunks handed back by threads that stopped cleaning */
+		setCount(releasedCleaningChunks, 0);
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -115,6 +120,12 @@ public:
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
 	
+	MMINLINE uintptr_t getReleasedCleaningChunks() { return releasedCleaningChunks; };
+	MMINLINE void incReleasedCleaningChunks()
+	{
+		incrementCount(releasedCleaningChunks, 1);
+	};
+	
 	/**
 	 * Create a CardTableStats object.
 	 */   
@@ -125,7 +136,8 @@ public:
 		finalCleanedCardsPhase1(0),
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
-		concurrentCleanedCardsPhase3(0)
+		concurrentCleanedCardsPhase3(0),
+		releasedCleaningChunks(0)
 	{};
 };
 
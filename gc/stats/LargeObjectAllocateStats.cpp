@@ -635,6 +635,12 @@ MM_LargeObjectAllocateStats::resetCurrent()
 {
 	spaceSavingClear(_spaceSavingSizes);
 	spaceSavingClear(_spaceSavingSizeClasses);
+
+	_pageAlignedAllocateCount = 0;
+	_pageAlignedAllocateBytes = 0;
+	_pageAlignedDiscardedBytes = 0;
+	_remappedObjectCount = 0;
+	_remappedBytes = 0;
 }
 
 void
@@ -662,6 +668,13 @@ MM_LargeObjectAllocateStats::allocateObject(uintptr_t allocateSize)
 	}
 }
 
+void
+MM_LargeObjectAllocateStats::remapObject(uintptr_t remappedSize)
+{
+	MM_AtomicOperations::add(&_remappedObjectCount, 1);
+	MM_AtomicOperations::add(&_remappedBytes, remappedSize);
+}
+
 void
 MM_LargeObjectAllocateStats::mergeCurrent(MM_LargeObjectAllocateStats *statsToMerge)
 {
@@ -682,6 +695,13 @@ MM_LargeObjectAllocateStats::mergeCurrent(MM_LargeObjectAllocateStats *statsToMe
 	for(i = 0; i < spaceSavingGetCurSize(spaceSavingToMerge); i++ ){
 		spaceSavingUpdate(_spaceSavingSizeClasses, spaceSavingGetKthMostFreq(spaceSavingToMerge, i + 1), spaceSavingGetKthMostFreqCount(spaceSavingToMerge, i + 1));
 	}
+
+	/* merge page granular allocation and remapping counts */
+	_pageAlignedAllocateCount += statsToMerge->_pageAlignedAllocateCount;
+	_pageAlignedAllocateBytes += statsToMerge->_pageAlignedAllocateBytes;
+	_pageAlignedDiscardedBytes += statsToMerge->_pageAlignedDiscardedBytes;
+	_remappedObjectCount += statsToMerge->_remappedObjectCount;
+	_remappedBytes += statsToMerge->_remappedBytes;
 }
 
 void
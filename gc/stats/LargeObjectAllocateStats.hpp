@@ -178,6 +178,12 @@ private:
 	uintptr_t _TLHSizeClassIndex; /**< preserved next value of sizeClassIndex on last invocation of simulateAllocateTLHs */
 	uintptr_t _TLHFrequentAllocationSize;/**< preserved next value of FrequentAllocationSize on last invocation of simulateAllocateTLHs */
 
+	uintptr_t _pageAlignedAllocateCount; /**< number of objects allocated at page granularity */
+	uintptr_t _pageAlignedAllocateBytes; /**< bytes of the objects allocated at page granularity */
+	uintptr_t _pageAlignedDiscardedBytes; /**< bytes below page aligned objects which were too small to be kept on the free list */
+	volatile uintptr_t _remappedObjectCount; /**< number of objects compaction moved by remapping their pages */
+	volatile uintptr_t _remappedBytes; /**< bytes compaction moved by remapping pages rather than copying them */
+
 	MMINLINE uintptr_t getNextSizeClass(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
 	MMINLINE bool isFirstIterationCompleteForCurrentStride(uintptr_t sizeClassIndex, uintptr_t maxSizeClasses);
 
@@ -231,6 +237,25 @@ public:
 	 */
 	void allocateObject(uintptr_t allocateSize);
 
+	/**
+	 * Invoked by allocator to notify about a successful allocation made at page granularity (in addition to allocateObject()).
+	 * @param allocateSize size that was just allocated
+	 * @param discardedSize size of the range skipped to align the object, which could not be kept on the free list
+	 */
+	void allocatePageAlignedObject(uintptr_t allocateSize, uintptr_t discardedSize)
+	{
+		_pageAlignedAllocateCount += 1;
+		_pageAlignedAllocateBytes += allocateSize;
+		_pageAlignedDiscardedBytes += discardedSize;
+	}
+
+	/**
+	 * Invoked by compaction to notify about an object moved by remapping its pages.
+	 * Safe in multi-threaded environment.
+	 * @param remappedSize bytes of the object moved by remapping (the rest of it was copied)
+	 */
+	void remapObject(uintptr_t remappedSize);
+
 	/**
 	 * Merge CURRENT this/these stats with provided stats. The result is stored back into this stats
      * @param statsToMerge to be added to this stats
@@ -320,6 +345,11 @@ public:
 	void resetRemainingFreeMemoryAfterEstimate() { _remainingFreeMemoryAfterEstimate= 0; }
 	uintptr_t getFreeMemoryBeforeEstimate() { return _freeMemoryBeforeEstimate; }
 	uintptr_t getMaxHeapSize() {return _maxHeapSize; }
+	uintptr_t getPageAlignedAllocateCount() { return _pageAlignedAllocateCount; }
+	uintptr_t getPageAlignedAllocateBytes() { return _pageAlignedAllocateBytes; }
+	uintptr_t getPageAlignedDiscardedBytes() { return _pageAlignedDiscardedBytes; }
+	uintptr_t getRemappedObjectCount() { return _remappedObjectCount; }
+	uintptr_t getRemappedBytes() { return _remappedBytes; }
 
 	MM_LargeObjectAllocateStats() :
 		_portLibrary(NULL),
@@ -345,7 +375,12 @@ public:
 		_freeMemoryBeforeEstimate(0),
 		_maxHeapSize(0),
 		_TLHSizeClassIndex(0),
-		_TLHFrequentAllocationSize(0)
+		_TLHFrequentAllocationSize(0),
+		_pageAlignedAllocateCount(0),
+		_pageAlignedAllocateBytes(0),
+		_pageAlignedDiscardedBytes(0),
+		_remappedObjectCount(0),
+		_remappedBytes(0)
 	{
 	}
 
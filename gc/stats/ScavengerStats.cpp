@@ -30,6 +30,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	_gcCount(UDATA_MAX)
 	,_rememberedSetOverflow(0)
 	,_causedRememberedSetOverflow(0)
+	,_rememberedSetOverflowCardsScanned(0)
 	,_scanCacheOverflow(0)
 	,_scanCacheAllocationFromHeap(0)
 	,_scanCacheAllocationDurationDuringSavenger(0)
@@ -79,13 +80,18 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
+	,_gcThreadCount(0)
 	,_leafObjectCount(0)
+	,_hotFieldCopyCount(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
+	,_nodeStats(NULL)
+	,_nodeStatsCount(0)
 
 	,_flipHistoryNewIndex(0)
 {
+	memset(&_localNodeStats, 0, sizeof(_localNodeStats));
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
@@ -117,6 +123,7 @@ MM_ScavengerStats::clear()
 	
 	_rememberedSetOverflow = 0;
 	_causedRememberedSetOverflow = 0;
+	_rememberedSetOverflowCardsScanned = 0;
 	_scanCacheOverflow = 0;
 	_scanCacheAllocationFromHeap = 0;
 	_scanCacheAllocationDurationDuringSavenger = 0;
@@ -168,10 +175,19 @@ MM_ScavengerStats::clear()
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
 
+	_gcThreadCount = 0;
+
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 	_leafObjectCount = 0;
+	_hotFieldCopyCount = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+
+	/* _nodeStats and _nodeStatsCount are owned by the scavenger and persist across cycles, only the counts are cleared */
+	memset(&_localNodeStats, 0, sizeof(_localNodeStats));
+	if (NULL != _nodeStats) {
+		memset(_nodeStats, 0, sizeof(NodeStats) * _nodeStatsCount);
+	}
 };
@@ -50,9 +50,20 @@ public:
 		uintptr_t _tenureBytes[OBJECT_HEADER_AGE_MAX+2]; /**< The historical number of bytes tenured in each age group */
 	};
 
+	/**
+	 * NUMA-local scavenging counts for one node (the threads of that node while a scavenge runs)
+	 */
+	struct NodeStats {
+		uintptr_t _copyBytes; /**< bytes of copy cache memory taken from the node's own survivor range and tenure slice */
+		uintptr_t _remoteCopyBytes; /**< bytes of copy cache memory taken from another node's survivor range */
+		uintptr_t _scanCount; /**< caches taken from the node's own scan list */
+		uintptr_t _stealCount; /**< caches taken from another node's scan list */
+	};
+
 	uintptr_t _gcCount;  /**< Count of the number of GC cycles that have occurred */
 	uintptr_t _rememberedSetOverflow;
 	uintptr_t _causedRememberedSetOverflow;
+	uintptr_t _rememberedSetOverflowCardsScanned; /**< dirty overflow cards walked to find the remembered objects */
 	uintptr_t _scanCacheOverflow;
 	uintptr_t _scanCacheAllocationFromHeap;
 	uint64_t  _scanCacheAllocationDurationDuringSavenger;
@@ -124,7 +135,10 @@ public:
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
+	uintptr_t _gcThreadCount; /**< The number of threads which ran the collection */
+
 	uint64_t _leafObjectCount;
+	uint64_t _hotFieldCopyCount; /**< objects copied immediately after their parent through a hot field */
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_sum;
@@ -132,6 +146,10 @@ public:
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
 
+	NodeStats _localNodeStats; /**< the thread's counts for the node it scavenged on */
+	NodeStats *_nodeStats; /**< per-node totals, set by the scavenger only while NUMA-local scavenging splits the work across nodes (NULL otherwise) */
+	uintptr_t _nodeStatsCount; /**< number of entries in _nodeStats */
+
 
 protected:
 
@@ -35,11 +35,28 @@ MM_SweepStats::clear()
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	unsweptRegions = 0;
+	lazySweptRegionsByAllocation = 0;
+	lazySweptRegionsInBackground = 0;
+	lazySweptRegionsByCollector = 0;
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	idleTime = 0;
 	mergeTime = 0;
 	sweepChunksProcessed = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */			
+
+	connectSegments = 0;
+	connectChunks = 0;
+	connectSerialFallbacks = 0;
+
+	connectVerified = false;
+	connectFreeBytes = 0;
+	connectFreeEntryCount = 0;
+	serialConnectFreeBytes = 0;
+	serialConnectFreeEntryCount = 0;
 }
 	
 void
@@ -49,12 +66,24 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	unsweptRegions += statsToMerge->unsweptRegions;
+	lazySweptRegionsByAllocation += statsToMerge->lazySweptRegionsByAllocation;
+	lazySweptRegionsInBackground += statsToMerge->lazySweptRegionsInBackground;
+	lazySweptRegionsByCollector += statsToMerge->lazySweptRegionsByCollector;
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
 	idleTime += statsToMerge->idleTime;
 	mergeTime += statsToMerge->mergeTime;
 	sweepChunksProcessed += statsToMerge->sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	connectSegments += statsToMerge->connectSegments;
+	connectChunks += statsToMerge->connectChunks;
+	connectSerialFallbacks += statsToMerge->connectSerialFallbacks;
+	/* the connect check is recorded by the master thread directly in the global stats */
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
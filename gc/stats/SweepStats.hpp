@@ -40,6 +40,13 @@ public:
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t unsweptRegions; /**< Number of small regions the sweep left unswept (see segregatedLazySweep) */
+	uintptr_t lazySweptRegionsByAllocation; /**< Number of the regions left unswept by the previous collection that allocating threads swept */
+	uintptr_t lazySweptRegionsInBackground; /**< Number of the regions left unswept by the previous collection that the background sweeper swept */
+	uintptr_t lazySweptRegionsByCollector; /**< Number of the regions left unswept by the previous collection that this collection swept before marking */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uint64_t idleTime;
 	uint64_t mergeTime;
@@ -48,6 +55,16 @@ public:
 	uintptr_t sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	uintptr_t connectSegments; /**< Number of parallel connect segments which connected at least one chunk */
+	uintptr_t connectChunks; /**< Number of chunks connected by the parallel connect */
+	uintptr_t connectSerialFallbacks; /**< Number of sweeps connected serially although parallelSweepConnect is enabled, because a memory pool does not support it */
+
+	bool connectVerified; /**< True if the parallel connect was checked against a serial connect of the same sweep (see fvtest_verifyParallelSweepConnect) */
+	uintptr_t connectFreeBytes; /**< Free bytes of all memory pools after the parallel connect, only set if connectVerified */
+	uintptr_t connectFreeEntryCount; /**< Free entries of all memory pools after the parallel connect, only set if connectVerified */
+	uintptr_t serialConnectFreeBytes; /**< Free bytes of all memory pools after the serial connect, only set if connectVerified */
+	uintptr_t serialConnectFreeEntryCount; /**< Free entries of all memory pools after the serial connect, only set if connectVerified */
+
 	uint64_t _startTime;	/**< Sweep start time */
 	uint64_t _endTime;		/**< Sweep end time */
 
@@ -39,6 +39,9 @@ class MM_WorkPacketStats
 {
 public:
 	uintptr_t _gcCount;  /**< Count of the number of GC cycles that have occurred */
+	uintptr_t _packetsPushed; /**< The number of packets put on the work-stealing deque of the owning thread */
+	uintptr_t _packetsPopped; /**< The number of packets taken back by the owning thread from its own work-stealing deque */
+	uintptr_t _packetsStolen; /**< The number of packets the owning thread stole from the work-stealing deque of another thread */
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
@@ -61,6 +64,9 @@ public:
 		_stwWorkStackOverflowCount = 0;
 		_stwWorkStackOverflowOccured = false;
 		_stwWorkpacketCountAtOverflow = 0;
+		_packetsPushed = 0;
+		_packetsPopped = 0;
+		_packetsStolen = 0;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		_workStallCount = 0;
 		_completeStallCount = 0;
@@ -77,6 +83,9 @@ public:
 		_stwWorkStackOverflowCount += statsToMerge->_stwWorkStackOverflowCount;
 		_stwWorkStackOverflowOccured = (_stwWorkStackOverflowOccured || statsToMerge->_stwWorkStackOverflowOccured);
 		_stwWorkpacketCountAtOverflow = OMR_MAX(_stwWorkpacketCountAtOverflow, statsToMerge->_stwWorkpacketCountAtOverflow);
+		_packetsPushed += statsToMerge->_packetsPushed;
+		_packetsPopped += statsToMerge->_packetsPopped;
+		_packetsStolen += statsToMerge->_packetsStolen;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		/* It may not ever be useful to merge these stats, but do it anyways */
@@ -140,6 +149,9 @@ public:
 
 	MM_WorkPacketStats() :
 		_gcCount(UDATA_MAX)
+		,_packetsPushed(0)
+		,_packetsPopped(0)
+		,_packetsStolen(0)
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
@@ -50,7 +50,8 @@ allocateMemoryForSublistFragment(void *vmThreadRawPtr, J9VMGC_SublistFragment *f
 		return 0;
 	} else {
 #if defined(OMR_GC_MODRON_SCAVENGER)
-		env->getExtensions()->setRememberedSetOverflowState();
+		/* The caller remembers the object by its remembered bit alone */
+		env->getExtensions()->setRememberedSetOverflowUncardedState();
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		return 1;
 	}
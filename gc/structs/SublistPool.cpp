@@ -387,6 +387,8 @@ MM_SublistPool::clear(MM_EnvironmentBase *env)
 	_list = NULL;
 	_allocPuddle = NULL;
 	_previousList = NULL;
+	_previousRangeCurrent = NULL;
+	_previousRangeTop = NULL;
 	_count = 0;
 }
 
@@ -428,17 +430,7 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 
 	/* return returnedPuddle to the list of used puddles */
 	if (NULL != returnedPuddle) {
-		Assert_MM_true(NULL == returnedPuddle->getNext());
-		returnedPuddle->setNext(_list);
-		_list = returnedPuddle;
-
-		/* It's illegal to have a non-empty list without an _allocPuddle. If 
-		 * this is the only puddle in the pool, make it the _allocPuddle. 
-		 */
-		if (NULL == _allocPuddle) {
-			_allocPuddle = returnedPuddle;
-			Assert_MM_true(NULL == _allocPuddle->getNext());
-		}
+		returnPuddle(returnedPuddle);
 	}
 
 	/* pop an element from the previous list */
@@ -452,3 +444,61 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 	
 	return result;
 }
+
+bool
+MM_SublistPool::popPreviousRange(uintptr_t rangeSlots, uintptr_t **rangeBase, uintptr_t **rangeTop)
+{
+	bool result = false;
+
+	omrthread_monitor_enter(_mutex);
+
+	while (!result && (NULL != _previousList)) {
+		MM_SublistPuddle *puddle = _previousList;
+		if (NULL == _previousRangeCurrent) {
+			/* Start on the next puddle - it can not grow while it is on the previous list */
+			_previousRangeCurrent = puddle->_listBase;
+			_previousRangeTop = puddle->_listCurrent;
+		}
+
+		uintptr_t remainingSlots = _previousRangeTop - _previousRangeCurrent;
+		if (0 != remainingSlots) {
+			*rangeBase = _previousRangeCurrent;
+			_previousRangeCurrent += OMR_MIN(remainingSlots, rangeSlots);
+			*rangeTop = _previousRangeCurrent;
+			result = true;
+		}
+
+		if (_previousRangeCurrent == _previousRangeTop) {
+			/* Every slot of the puddle has been handed out, return it to the list of used puddles */
+			_previousList = puddle->getNext();
+			puddle->setNext(NULL);
+			returnPuddle(puddle);
+			_previousRangeCurrent = NULL;
+			_previousRangeTop = NULL;
+		}
+	}
+
+	omrthread_monitor_exit(_mutex);
+
+	return result;
+}
+
+/**
+ * Return a puddle taken from the list of previous puddles to the list of used puddles.
+ * @note the caller must hold _mutex.
+ */
+void
+MM_SublistPool::returnPuddle(MM_SublistPuddle *puddle)
+{
+	Assert_MM_true(NULL == puddle->getNext());
+	puddle->setNext(_list);
+	_list = puddle;
+
+	/* It's illegal to have a non-empty list without an _allocPuddle. If
+	 * this is the only puddle in the pool, make it the _allocPuddle.
+	 */
+	if (NULL == _allocPuddle) {
+		_allocPuddle = puddle;
+		Assert_MM_true(NULL == _allocPuddle->getNext());
+	}
+}
@@ -61,6 +61,8 @@ private:
 	MM_AllocationCategory::Enum _allocCategory;
 	
 	MM_SublistPuddle *_previousList; /**< A list of the non-empty puddles when #startProcessingSublist() was called */
+	uintptr_t *_previousRangeCurrent; /**< Next slot of the head of _previousList to be handed out by #popPreviousRange(), NULL if none has been */
+	uintptr_t *_previousRangeTop; /**< End of the slots of the head of _previousList to be handed out by #popPreviousRange() */
 	
 protected:
 public:
@@ -70,6 +72,7 @@ public:
  */
 private:
 	MM_SublistPuddle *createNewPuddle(MM_EnvironmentBase *env);
+	void returnPuddle(MM_SublistPuddle *puddle);
 
 protected:
 public:
@@ -120,6 +123,20 @@ public:
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
 	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+
+	/**
+	 * Take the next range of at most rangeSlots slots from the puddles which were active when #startProcessingSublist()
+	 * was called, so that a large puddle can be processed by several threads. Once all of its slots have been handed out
+	 * a puddle is returned to the list of puddles, though other threads may still be processing its last ranges: slots
+	 * must therefore not be removed (only cleared) while the previous puddles are being processed this way.
+	 * This is protected by a lock, so may safely be called by multiple threads. It must not be mixed with #popPreviousPuddle().
+	 *
+	 * @param rangeSlots[in] largest number of slots to return
+	 * @param rangeBase[out] first slot of the range
+	 * @param rangeTop[out] slot following the range
+	 * @return true if a range was returned, false if every slot has been handed out
+	 */
+	bool popPreviousRange(uintptr_t rangeSlots, uintptr_t **rangeBase, uintptr_t **rangeTop);
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -131,6 +148,8 @@ public:
 		, _count(0)
 		, _allocCategory(MM_AllocationCategory::OTHER)
 		, _previousList(NULL)
+		, _previousRangeCurrent(NULL)
+		, _previousRangeTop(NULL)
 	{}
 
 	friend class GC_SublistIterator;
@@ -184,5 +184,26 @@ MM_SublistPuddle::merge(MM_SublistPuddle *sourcePuddle)
 	sourcePuddle->_listCurrent = (uintptr_t *) (((uint8_t *)sourcePuddle->_listCurrent) - copySize);
 }
 
+/**
+ * Remove the NULL slots of the puddle, moving the remaining elements towards the base in order.
+ * Elements of the puddle which have been removed in place (by clearing their slot) are reclaimed this way
+ * once every range of the puddle is done with; the parent pool count is not changed, since cleared slots
+ * have already been subtracted from it.
+ * @note assumes no other thread is accessing the puddle.
+ */
+void
+MM_SublistPuddle::removeNullSlots()
+{
+	uintptr_t *destination = _listBase;
+	uintptr_t *listCurrent = _listCurrent;
 
-
+	for (uintptr_t *source = _listBase; source < listCurrent; source++) {
+		if (0 != *source) {
+			*destination = *source;
+			destination += 1;
+		}
+	}
+	/* Fragments require preinitialized slots */
+	memset((void *)destination, 0, ((uintptr_t)listCurrent) - ((uintptr_t)destination));
+	_listCurrent = destination;
+}
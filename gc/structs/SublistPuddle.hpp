@@ -57,6 +57,7 @@ private:
 	uintptr_t *_listTop;
 
 	uintptr_t _size;
+	volatile uintptr_t _rangesProcessed; /**< number of slot ranges processed since the puddle last had its NULL slots removed */
 
 protected:
 public:
@@ -83,6 +84,43 @@ public:
 	MMINLINE uintptr_t freeSize() { return ((uintptr_t)_listTop) - ((uintptr_t)_listCurrent); }
 	MMINLINE uintptr_t totalSize() { return ((uintptr_t)_listTop) - ((uintptr_t)_listBase); }
 
+	/**
+	 * Get the bounds of a range of slots of the puddle, for processing ranges of one puddle in parallel.
+	 * Ranges are counted over the capacity of the puddle, so the count does not change as elements are
+	 * added or removed; ranges beyond the consumed part of the puddle are empty.
+	 * @param rangeSlots[in] number of slots in a range
+	 * @param rangeIndex[in] index of the range
+	 * @param rangeBase[out] first slot of the range
+	 * @param rangeTop[out] slot following the range
+	 */
+	MMINLINE void
+	getRange(uintptr_t rangeSlots, uintptr_t rangeIndex, uintptr_t **rangeBase, uintptr_t **rangeTop)
+	{
+		uintptr_t *listCurrent = _listCurrent;
+		uintptr_t *base = _listBase + (rangeSlots * rangeIndex);
+		uintptr_t *top = base + rangeSlots;
+		*rangeBase = (base < listCurrent) ? base : listCurrent;
+		*rangeTop = (top < listCurrent) ? top : listCurrent;
+	}
+
+	MMINLINE uintptr_t getRangeCount(uintptr_t rangeSlots) { return ((totalSize() / sizeof(uintptr_t)) + rangeSlots - 1) / rangeSlots; }
+
+	/**
+	 * Record that one of the rangeCount ranges of the puddle has been processed.
+	 * @return true if this was the last range, in which case the count is reset for the next pass
+	 */
+	MMINLINE bool
+	rangeProcessed(uintptr_t rangeCount)
+	{
+		if (rangeCount == MM_AtomicOperations::add(&_rangesProcessed, 1)) {
+			_rangesProcessed = 0;
+			return true;
+		}
+		return false;
+	}
+
+	void removeNullSlots();
+
 	MMINLINE MM_SublistPool *getParent() {return _parent; }
 
 	void merge(MM_SublistPuddle *sourcePuddle);
@@ -94,6 +132,7 @@ public:
 
 	friend class GC_SublistIterator;
 	friend class GC_SublistSlotIterator;
+	friend class MM_SublistPool;
 };
 
 #endif /* SUBLISTPUDDLE_HPP_ */
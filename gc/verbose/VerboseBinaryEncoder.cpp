@@ -0,0 +1,527 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "VerboseBinaryEncoder.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#define BINARY_ENCODER_INITIAL_SIZE 512
+
+/**
+ * Encode an unsigned LEB128 varint.
+ * @return the number of bytes written, at most VERBOSE_BINARY_VARINT_MAXIMUM
+ */
+static MMINLINE uintptr_t
+encodeVarint(uint8_t *bytes, uint64_t value)
+{
+	uintptr_t count = 0;
+	while (value >= 0x80) {
+		bytes[count++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	bytes[count++] = (uint8_t)value;
+	return count;
+}
+
+MM_VerboseBinaryEncoder *
+MM_VerboseBinaryEncoder::newInstance(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseBinaryEncoder *encoder = (MM_VerboseBinaryEncoder *)extensions->getForge()->allocate(sizeof(MM_VerboseBinaryEncoder), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != encoder) {
+		new(encoder) MM_VerboseBinaryEncoder();
+		if (!encoder->initialize(env)) {
+			encoder->kill(env);
+			encoder = NULL;
+		}
+	}
+	return encoder;
+}
+
+void
+MM_VerboseBinaryEncoder::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	extensions->getForge()->free(this);
+}
+
+bool
+MM_VerboseBinaryEncoder::initialize(MM_EnvironmentBase *env)
+{
+	MM_Forge *forge = env->getExtensions()->getForge();
+
+	if (!ensureCapacity(env, &_records, BINARY_ENCODER_INITIAL_SIZE) || !ensureCapacity(env, &_line, BINARY_ENCODER_INITIAL_SIZE)) {
+		return false;
+	}
+
+	_formatSlots = (FormatSlot *)forge->allocate(sizeof(FormatSlot) * TABLE_SLOTS, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_formats = (const char **)forge->allocate(sizeof(const char *) * TABLE_ENTRIES, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_stringSlots = (StringSlot *)forge->allocate(sizeof(StringSlot) * TABLE_SLOTS, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_strings = (const char **)forge->allocate(sizeof(const char *) * TABLE_ENTRIES, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_stringArena = (char *)forge->allocate(STRING_ARENA_SIZE, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if ((NULL == _formatSlots) || (NULL == _formats) || (NULL == _stringSlots) || (NULL == _strings) || (NULL == _stringArena)) {
+		return false;
+	}
+	memset(_formatSlots, 0, sizeof(FormatSlot) * TABLE_SLOTS);
+	memset(_stringSlots, 0, sizeof(StringSlot) * TABLE_SLOTS);
+
+	return true;
+}
+
+void
+MM_VerboseBinaryEncoder::tearDown(MM_EnvironmentBase *env)
+{
+	MM_Forge *forge = env->getExtensions()->getForge();
+
+	forge->free(_records.bytes);
+	_records.bytes = NULL;
+	forge->free(_line.bytes);
+	_line.bytes = NULL;
+	forge->free(_formatSlots);
+	_formatSlots = NULL;
+	forge->free((void *)_formats);
+	_formats = NULL;
+	forge->free(_stringSlots);
+	_stringSlots = NULL;
+	forge->free((void *)_strings);
+	_strings = NULL;
+	forge->free(_stringArena);
+	_stringArena = NULL;
+}
+
+/**
+ * Ensure that there are at least spaceNeeded bytes left in the buffer.
+ * @return true on success, false if the buffer could not be expanded
+ */
+bool
+MM_VerboseBinaryEncoder::ensureCapacity(MM_EnvironmentBase *env, ByteBuffer *buffer, uintptr_t spaceNeeded)
+{
+	if ((buffer->capacity - buffer->length) < spaceNeeded) {
+		MM_Forge *forge = env->getExtensions()->getForge();
+		uintptr_t newLength = buffer->length + spaceNeeded;
+		uintptr_t newCapacity = newLength + (newLength / 2);
+		uint8_t *newBytes = (uint8_t *)forge->allocate(newCapacity, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == newBytes) {
+			return false;
+		}
+		if (0 != buffer->length) {
+			memcpy(newBytes, buffer->bytes, buffer->length);
+		}
+		forge->free(buffer->bytes);
+		buffer->bytes = newBytes;
+		buffer->capacity = newCapacity;
+	}
+	return true;
+}
+
+/**
+ * Append a varint. The caller must have ensured there is room for VERBOSE_BINARY_VARINT_MAXIMUM bytes.
+ */
+void
+MM_VerboseBinaryEncoder::putVarint(ByteBuffer *buffer, uint64_t value)
+{
+	buffer->length += encodeVarint(buffer->bytes + buffer->length, value);
+}
+
+bool
+MM_VerboseBinaryEncoder::putBytes(MM_EnvironmentBase *env, ByteBuffer *buffer, const void *bytes, uintptr_t length)
+{
+	if (!ensureCapacity(env, buffer, length)) {
+		return false;
+	}
+	memcpy(buffer->bytes + buffer->length, bytes, length);
+	buffer->length += length;
+	return true;
+}
+
+/**
+ * Append a text, format or string record. The id is only written for format and string records.
+ */
+bool
+MM_VerboseBinaryEncoder::putRecord(MM_EnvironmentBase *env, ByteBuffer *buffer, uint8_t type, uintptr_t id, const char *bytes, uintptr_t length)
+{
+	uint8_t recordHeader[1 + VERBOSE_BINARY_VARINT_MAXIMUM];
+	uintptr_t recordHeaderLength = 0;
+
+	recordHeader[recordHeaderLength++] = type;
+	if (VERBOSE_BINARY_RECORD_TEXT != type) {
+		recordHeaderLength += encodeVarint(recordHeader + recordHeaderLength, id);
+	}
+
+	if (!ensureCapacity(env, buffer, VERBOSE_BINARY_VARINT_MAXIMUM + recordHeaderLength + length)) {
+		return false;
+	}
+	putVarint(buffer, recordHeaderLength + length);
+	memcpy(buffer->bytes + buffer->length, recordHeader, recordHeaderLength);
+	buffer->length += recordHeaderLength;
+	memcpy(buffer->bytes + buffer->length, bytes, length);
+	buffer->length += length;
+	return true;
+}
+
+/**
+ * Find the id of a format, defining it if this is its first use.
+ * @return the id, or UDATA_MAX if the table is full or the definition could not be buffered
+ */
+uintptr_t
+MM_VerboseBinaryEncoder::formatId(MM_EnvironmentBase *env, const char *format)
+{
+	uintptr_t slot = (((uintptr_t)format >> 2) * 2654435761U) & (TABLE_SLOTS - 1);
+
+	while (NULL != _formatSlots[slot].format) {
+		if (format == _formatSlots[slot].format) {
+			return _formatSlots[slot].id;
+		}
+		slot = (slot + 1) & (TABLE_SLOTS - 1);
+	}
+
+	uintptr_t id = _formatCount;
+	if ((TABLE_ENTRIES == id) || !putRecord(env, &_records, VERBOSE_BINARY_RECORD_FORMAT, id, format, strlen(format))) {
+		return UDATA_MAX;
+	}
+	_formatSlots[slot].format = format;
+	_formatSlots[slot].id = id;
+	_formats[id] = format;
+	/* the entry must be complete before it is counted */
+	MM_AtomicOperations::storeSync();
+	_formatCount = id + 1;
+	return id;
+}
+
+/**
+ * Find the id of a string argument, defining it if this is its first use.
+ * @return the id, or UDATA_MAX if the table is full or the definition could not be buffered
+ */
+uintptr_t
+MM_VerboseBinaryEncoder::stringId(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261U;
+	for (uintptr_t i = 0; i < length; i++) {
+		hash = (hash ^ (uint8_t)string[i]) * 16777619U;
+	}
+	uintptr_t slot = hash & (TABLE_SLOTS - 1);
+
+	while (NULL != _stringSlots[slot].string) {
+		if ((hash == _stringSlots[slot].hash) && (0 == strcmp(string, _stringSlots[slot].string))) {
+			return _stringSlots[slot].id;
+		}
+		slot = (slot + 1) & (TABLE_SLOTS - 1);
+	}
+
+	uintptr_t id = _stringCount;
+	if ((TABLE_ENTRIES == id) || ((STRING_ARENA_SIZE - _stringArenaUsed) <= length)) {
+		return UDATA_MAX;
+	}
+	if (!putRecord(env, &_records, VERBOSE_BINARY_RECORD_STRING, id, string, length)) {
+		return UDATA_MAX;
+	}
+	char *copy = _stringArena + _stringArenaUsed;
+	memcpy(copy, string, length);
+	copy[length] = '\0';
+	_stringArenaUsed += length + 1;
+	_stringSlots[slot].string = copy;
+	_stringSlots[slot].hash = hash;
+	_stringSlots[slot].id = id;
+	_strings[id] = copy;
+	/* the entry must be complete before it is counted */
+	MM_AtomicOperations::storeSync();
+	_stringCount = id + 1;
+	return id;
+}
+
+/**
+ * Append the records of every definition made so far.
+ */
+bool
+MM_VerboseBinaryEncoder::putDefinitions(MM_EnvironmentBase *env, ByteBuffer *buffer)
+{
+	uintptr_t formatCount = _formatCount;
+	uintptr_t stringCount = _stringCount;
+	MM_AtomicOperations::loadSync();
+
+	for (uintptr_t id = 0; id < formatCount; id++) {
+		if (!putRecord(env, buffer, VERBOSE_BINARY_RECORD_FORMAT, id, _formats[id], strlen(_formats[id]))) {
+			return false;
+		}
+	}
+	for (uintptr_t id = 0; id < stringCount; id++) {
+		if (!putRecord(env, buffer, VERBOSE_BINARY_RECORD_STRING, id, _strings[id], strlen(_strings[id]))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool
+MM_VerboseBinaryEncoder::encodeLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	if (encodeFormattedLine(env, indent, format, argsCopy)) {
+		return true;
+	}
+
+	/* the line could not be encoded (table full or unknown conversion) so send it formatted */
+	COPY_VA_LIST(argsCopy, args);
+	uintptr_t formattedLength = omrstr_vprintf(NULL, 0, format, argsCopy);
+	uintptr_t indentLength = indent * (sizeof(VERBOSE_BINARY_INDENT) - 1);
+	_line.length = 0;
+	if (!ensureCapacity(env, &_line, indentLength + formattedLength + 2)) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < indent; i++) {
+		memcpy(_line.bytes + _line.length, VERBOSE_BINARY_INDENT, sizeof(VERBOSE_BINARY_INDENT) - 1);
+		_line.length += sizeof(VERBOSE_BINARY_INDENT) - 1;
+	}
+	COPY_VA_LIST(argsCopy, args);
+	_line.length += omrstr_vprintf((char *)_line.bytes + _line.length, formattedLength + 1, format, argsCopy);
+	_line.bytes[_line.length++] = '\n';
+	return putRecord(env, &_records, VERBOSE_BINARY_RECORD_TEXT, 0, (const char *)_line.bytes, _line.length);
+}
+
+/**
+ * Append a line record holding the format id and the argument values.
+ * @return true on success, false if the line has to be sent formatted instead
+ */
+bool
+MM_VerboseBinaryEncoder::encodeFormattedLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args)
+{
+	uintptr_t id = formatId(env, format);
+	if (UDATA_MAX == id) {
+		return false;
+	}
+
+	_line.length = 0;
+	if (!ensureCapacity(env, &_line, 1 + (2 * VERBOSE_BINARY_VARINT_MAXIMUM))) {
+		return false;
+	}
+	putByte(&_line, VERBOSE_BINARY_RECORD_LINE);
+	putVarint(&_line, id);
+	putVarint(&_line, indent);
+
+	for (const char *cursor = format; '\0' != *cursor; cursor++) {
+		if ('%' != *cursor) {
+			continue;
+		}
+		cursor += 1;
+		if ('%' == *cursor) {
+			continue;
+		}
+		/* room for a width, a precision and a value */
+		if (!ensureCapacity(env, &_line, 3 * VERBOSE_BINARY_VARINT_MAXIMUM)) {
+			return false;
+		}
+
+		while (('-' == *cursor) || ('+' == *cursor) || (' ' == *cursor) || ('#' == *cursor) || ('0' == *cursor)) {
+			cursor += 1;
+		}
+		if ('*' == *cursor) {
+			putSignedVarint(&_line, va_arg(args, int));
+			cursor += 1;
+		} else {
+			while (('0' <= *cursor) && ('9' >= *cursor)) {
+				cursor += 1;
+			}
+		}
+		if ('.' == *cursor) {
+			cursor += 1;
+			if ('*' == *cursor) {
+				putSignedVarint(&_line, va_arg(args, int));
+				cursor += 1;
+			} else {
+				while (('0' <= *cursor) && ('9' >= *cursor)) {
+					cursor += 1;
+				}
+			}
+		}
+
+		char size = '\0';
+		switch (*cursor) {
+		case 'h':
+			cursor += ('h' == cursor[1]) ? 2 : 1;
+			break;
+		case 'l':
+			if ('l' == cursor[1]) {
+				size = 'L';
+				cursor += 2;
+			} else {
+				size = 'l';
+				cursor += 1;
+			}
+			break;
+		case 'z':
+		case 'j':
+		case 't':
+			size = *cursor;
+			cursor += 1;
+			break;
+		default:
+			break;
+		}
+
+		switch (*cursor) {
+		case 'd':
+		case 'i':
+		case 'c':
+		{
+			int64_t value = 0;
+			switch (size) {
+			case 'l': value = va_arg(args, long); break;
+			case 'L': value = va_arg(args, long long); break;
+			case 'z': value = va_arg(args, intptr_t); break;
+			case 'j': value = va_arg(args, intmax_t); break;
+			case 't': value = va_arg(args, ptrdiff_t); break;
+			default: value = va_arg(args, int); break;
+			}
+			putSignedVarint(&_line, value);
+			break;
+		}
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+		{
+			uint64_t value = 0;
+			switch (size) {
+			case 'l': value = va_arg(args, unsigned long); break;
+			case 'L': value = va_arg(args, unsigned long long); break;
+			case 'z': value = va_arg(args, uintptr_t); break;
+			case 'j': value = va_arg(args, uintmax_t); break;
+			case 't': value = (uint64_t)va_arg(args, ptrdiff_t); break;
+			default: value = va_arg(args, unsigned int); break;
+			}
+			putVarint(&_line, value);
+			break;
+		}
+		case 'p':
+			putVarint(&_line, (uintptr_t)va_arg(args, void *));
+			break;
+		case 's':
+		{
+			const char *string = va_arg(args, const char *);
+			if (NULL == string) {
+				string = VERBOSE_BINARY_NULL_STRING;
+			}
+			uintptr_t length = strlen(string);
+			if (length <= STRING_LENGTH_LIMIT) {
+				uintptr_t stringIndex = stringId(env, string, length);
+				if (UDATA_MAX != stringIndex) {
+					putVarint(&_line, (stringIndex << 1) | 1);
+					break;
+				}
+			}
+			putVarint(&_line, length << 1);
+			if (!putBytes(env, &_line, string, length)) {
+				return false;
+			}
+			break;
+		}
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		{
+			double value = va_arg(args, double);
+			uint64_t bits = 0;
+			memcpy(&bits, &value, sizeof(bits));
+			for (uintptr_t i = 0; i < sizeof(bits); i++) {
+				putByte(&_line, (uint8_t)(bits >> (8 * i)));
+			}
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+
+	if (!ensureCapacity(env, &_records, VERBOSE_BINARY_VARINT_MAXIMUM + _line.length)) {
+		return false;
+	}
+	putVarint(&_records, _line.length);
+	memcpy(_records.bytes + _records.length, _line.bytes, _line.length);
+	_records.length += _line.length;
+	return true;
+}
+
+uint8_t *
+MM_VerboseBinaryEncoder::newPreamble(MM_EnvironmentBase *env, const char *header, uintptr_t *length)
+{
+	ByteBuffer preamble = { NULL, 0, 0 };
+
+	if (ensureCapacity(env, &preamble, VERBOSE_BINARY_PREAMBLE_LENGTH)) {
+		memcpy(preamble.bytes, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH);
+		preamble.length = VERBOSE_BINARY_MAGIC_LENGTH;
+		putByte(&preamble, VERBOSE_BINARY_VERSION);
+		putByte(&preamble, (uint8_t)sizeof(uintptr_t));
+		if (putRecord(env, &preamble, VERBOSE_BINARY_RECORD_TEXT, 0, header, strlen(header)) && putDefinitions(env, &preamble)) {
+			*length = preamble.length;
+			return preamble.bytes;
+		}
+	}
+
+	freeBytes(env, preamble.bytes);
+	return NULL;
+}
+
+uint8_t *
+MM_VerboseBinaryEncoder::newDefinitions(MM_EnvironmentBase *env, uintptr_t *length)
+{
+	ByteBuffer definitions = { NULL, 0, 0 };
+
+	if (putDefinitions(env, &definitions) && (0 != definitions.length)) {
+		*length = definitions.length;
+		return definitions.bytes;
+	}
+
+	freeBytes(env, definitions.bytes);
+	return NULL;
+}
+
+uint8_t *
+MM_VerboseBinaryEncoder::newTextRecord(MM_EnvironmentBase *env, const char *text, uintptr_t *length)
+{
+	ByteBuffer record = { NULL, 0, 0 };
+
+	if (putRecord(env, &record, VERBOSE_BINARY_RECORD_TEXT, 0, text, strlen(text))) {
+		*length = record.length;
+		return record.bytes;
+	}
+
+	freeBytes(env, record.bytes);
+	return NULL;
+}
+
+void
+MM_VerboseBinaryEncoder::freeBytes(MM_EnvironmentBase *env, uint8_t *bytes)
+{
+	if (NULL != bytes) {
+		env->getExtensions()->getForge()->free(bytes);
+	}
+}
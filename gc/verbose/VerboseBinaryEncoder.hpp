@@ -0,0 +1,168 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYENCODER_HPP_)
+#define VERBOSEBINARYENCODER_HPP_
+
+#include "omrcfg.h"
+#include "omrstdarg.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+
+/**
+ * Encodes verbose output lines into the binary verbose stream (see VerboseBinaryFormat.hpp).
+ * Rather than formatting a line, the encoder records the id of its format string and its raw argument
+ * values, so producing output costs a scan of the format and a few varints. Format strings are identified
+ * by address and must therefore be string literals. String arguments short enough to be names are kept
+ * in a string table and sent by id after their first use; longer ones, and all strings once the table
+ * is full, are sent inline.
+ *
+ * Like MM_VerboseBuffer, the encoder is only used by one thread at a time (under the writer chain), except
+ * that the tables may be read concurrently by newPreamble() and newDefinitions(): entries are never changed
+ * once they have been counted.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseBinaryEncoder : public MM_Base
+{
+/*
+ * Member data
+ */
+private:
+	enum {
+		TABLE_SLOTS = 1024, /**< hash slots of each table, a power of two */
+		TABLE_ENTRIES = TABLE_SLOTS / 2, /**< ids available in each table */
+		STRING_ARENA_SIZE = 16 * 1024, /**< bytes available for the copies of tabled strings */
+		STRING_LENGTH_LIMIT = 48 /**< longest string argument which is put in the string table */
+	};
+
+	struct FormatSlot {
+		const char *format; /**< format string, NULL if the slot is empty */
+		uintptr_t id; /**< id of the format */
+	};
+
+	struct StringSlot {
+		const char *string; /**< copy of the string in the arena, NULL if the slot is empty */
+		uintptr_t hash; /**< hash of the string */
+		uintptr_t id; /**< id of the string */
+	};
+
+	struct ByteBuffer {
+		uint8_t *bytes; /**< base of the buffer */
+		uintptr_t length; /**< bytes used */
+		uintptr_t capacity; /**< bytes allocated */
+	};
+
+	ByteBuffer _records; /**< records encoded since the last reset */
+	ByteBuffer _line; /**< body of the line record being encoded */
+	FormatSlot *_formatSlots; /**< format table, hashed by address */
+	const char **_formats; /**< formats by id */
+	volatile uintptr_t _formatCount; /**< number of format ids handed out */
+	StringSlot *_stringSlots; /**< string table, hashed by content */
+	const char **_strings; /**< strings by id */
+	volatile uintptr_t _stringCount; /**< number of string ids handed out */
+	char *_stringArena; /**< copies of the tabled strings */
+	uintptr_t _stringArenaUsed; /**< bytes of _stringArena used */
+protected:
+public:
+
+/*
+ * Member functions
+ */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	bool ensureCapacity(MM_EnvironmentBase *env, ByteBuffer *buffer, uintptr_t spaceNeeded);
+	MMINLINE void putByte(ByteBuffer *buffer, uint8_t value) { buffer->bytes[buffer->length++] = value; }
+	void putVarint(ByteBuffer *buffer, uint64_t value);
+	MMINLINE void putSignedVarint(ByteBuffer *buffer, int64_t value) { putVarint(buffer, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63)); }
+	bool putBytes(MM_EnvironmentBase *env, ByteBuffer *buffer, const void *bytes, uintptr_t length);
+	bool putRecord(MM_EnvironmentBase *env, ByteBuffer *buffer, uint8_t type, uintptr_t id, const char *bytes, uintptr_t length);
+
+	uintptr_t formatId(MM_EnvironmentBase *env, const char *format);
+	uintptr_t stringId(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+	bool putDefinitions(MM_EnvironmentBase *env, ByteBuffer *buffer);
+	bool encodeFormattedLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+protected:
+
+public:
+	static MM_VerboseBinaryEncoder *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Append a line record (or, if the format can not be encoded, a text record holding the formatted line).
+	 * @param env[in] the current thread
+	 * @param indent[in] indent level of the line
+	 * @param format[in] a string literal format; see omrstr_printf
+	 * @param args[in] a va_list describing the arguments to format
+	 * @return true on success, false if the line could not be buffered
+	 */
+	bool encodeLine(MM_EnvironmentBase *env, uintptr_t indent, const char *format, va_list args);
+
+	/**
+	 * Build the start of a new file: the magic, a text record holding the header, and every format and
+	 * string definition made so far. Free the result with freeBytes().
+	 * @param env[in] the current thread
+	 * @param header[in] text of the header
+	 * @param length[out] number of bytes returned
+	 * @return the bytes, or NULL if they could not be allocated
+	 */
+	uint8_t *newPreamble(MM_EnvironmentBase *env, const char *header, uintptr_t *length);
+
+	/**
+	 * Build the records of every format and string definition made so far, for a writer which has lost
+	 * output containing definitions. Free the result with freeBytes().
+	 */
+	uint8_t *newDefinitions(MM_EnvironmentBase *env, uintptr_t *length);
+
+	/**
+	 * Build a text record. Free the result with freeBytes().
+	 */
+	uint8_t *newTextRecord(MM_EnvironmentBase *env, const char *text, uintptr_t *length);
+
+	void freeBytes(MM_EnvironmentBase *env, uint8_t *bytes);
+
+	MMINLINE void reset() { _records.length = 0; }
+	MMINLINE uint8_t *contents() { return _records.bytes; }
+	MMINLINE uintptr_t currentSize() { return _records.length; }
+
+	MM_VerboseBinaryEncoder() :
+		MM_Base(),
+		_formatSlots(NULL),
+		_formats(NULL),
+		_formatCount(0),
+		_stringSlots(NULL),
+		_strings(NULL),
+		_stringCount(0),
+		_stringArena(NULL),
+		_stringArenaUsed(0)
+	{
+		_records.bytes = NULL;
+		_records.length = 0;
+		_records.capacity = 0;
+		_line.bytes = NULL;
+		_line.length = 0;
+		_line.capacity = 0;
+	}
+};
+
+#endif /* VERBOSEBINARYENCODER_HPP_ */
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+/**
+ * @file
+ * Layout of the binary verbose GC stream. This header is shared with the stand alone decoder
+ * (tools/verbosegcdecode) so it must not depend on anything else.
+ *
+ * A stream starts with VERBOSE_BINARY_MAGIC_LENGTH bytes of magic, one byte of format version and one
+ * byte holding sizeof(uintptr_t) of the producer. The rest of the stream is a sequence of records, each
+ * an unsigned varint body length followed by the body. The first byte of the body is the record type:
+ *
+ * VERBOSE_BINARY_RECORD_TEXT    text to be output verbatim (the XML header and footer, notes)
+ * VERBOSE_BINARY_RECORD_FORMAT  varint id, then the bytes of an output format string
+ * VERBOSE_BINARY_RECORD_STRING  varint id, then the bytes of a string argument which is expected to repeat
+ * VERBOSE_BINARY_RECORD_LINE    varint format id, varint indent, then one value per conversion of the format
+ *
+ * A line is output as its indent, the format applied to its values and a newline, exactly as the XML
+ * writers would have output it. Values are encoded by conversion:
+ *
+ * d i c                  zigzag varint
+ * u o x X                varint
+ * p                      varint of the pointer value
+ * s                      varint v: if v is odd, the string with id (v >> 1), otherwise (v >> 1) bytes of inline string
+ * f F e E g G            eight bytes of the IEEE double, least significant byte first
+ * '*' width/precision    zigzag varint, before the value it applies to
+ *
+ * Format and string ids are only defined once per file; a writer starting a new file repeats the
+ * definitions made so far. A definition may be repeated with the same content.
+ */
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_MAGIC_LENGTH 7
+#define VERBOSE_BINARY_VERSION 1
+#define VERBOSE_BINARY_PREAMBLE_LENGTH (VERBOSE_BINARY_MAGIC_LENGTH + 2)
+
+#define VERBOSE_BINARY_RECORD_TEXT 1
+#define VERBOSE_BINARY_RECORD_FORMAT 2
+#define VERBOSE_BINARY_RECORD_STRING 3
+#define VERBOSE_BINARY_RECORD_LINE 4
+
+/* Output written for each level of indent of a line, and for a NULL string argument */
+#define VERBOSE_BINARY_INDENT "  "
+#define VERBOSE_BINARY_NULL_STRING "<NULL>"
+
+/* Longest encoding of a 64 bit varint */
+#define VERBOSE_BINARY_VARINT_MAXIMUM 10
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
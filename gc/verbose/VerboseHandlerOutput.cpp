@@ -23,6 +23,11 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "CollectionStatistics.hpp"
+#include "Heap.hpp"
+#include "HeapDecommitter.hpp"
+#include "LargeObjectAllocateStats.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
@@ -258,6 +263,9 @@ MM_VerboseHandlerOutput::handleInitialized(J9HookInterface** hook, uintptr_t eve
 	writer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", event->heapPageType);
 	writer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", event->heapRequestedPageSize);
 	writer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", event->heapRequestedPageType);
+	if (_extensions->transparentHugePages) {
+		writer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePageSize\" value=\"0x%zx\" />", _extensions->transparentHugePageSize);
+	}
 	writer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", event->gcThreads);
 	writer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", event->numaNodes);
 
@@ -724,6 +732,20 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (0 != systemStats->_tlhMaxAllocationRate) {
+			/* only measured under adaptive TLH sizing */
+			writer->formatAndOutput(env, 1, "<tlh-allocation-rate max=\"%zu\" />", systemStats->_tlhMaxAllocationRate);
+		}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+		/* a global collection merges the stats of the tenure pools before it starts, and resets them as it sweeps */
+		MM_LargeObjectAllocateStats *largeObjectStats = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getLargeObjectAllocateStats();
+		if ((NULL != largeObjectStats) && (0 != largeObjectStats->getPageAlignedAllocateCount())) {
+			writer->formatAndOutput(env, 1, "<page-aligned-allocation count=\"%zu\" bytes=\"%zu\" discardedbytes=\"%zu\" />",
+					largeObjectStats->getPageAlignedAllocateCount(), largeObjectStats->getPageAlignedAllocateBytes(), largeObjectStats->getPageAlignedDiscardedBytes());
+		}
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -859,7 +881,19 @@ MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t
 
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
 
-	writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\" %s />", id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, tagTemplate);
+	/* attributes of the optional features which change how the heap is committed */
+	char featureAttributes[128] = "";
+	uintptr_t featureAttributesLength = 0;
+	if (_extensions->transparentHugePages) {
+		featureAttributesLength += omrstr_printf(featureAttributes + featureAttributesLength, sizeof(featureAttributes) - featureAttributesLength,
+				" hugepagebytes=\"%zu\"", _extensions->transparentHugePageCommittedBytes);
+	}
+	if (NULL != _extensions->heapDecommitter) {
+		featureAttributesLength += omrstr_printf(featureAttributes + featureAttributesLength, sizeof(featureAttributes) - featureAttributesLength,
+				" decommitqueued=\"%zu\" decommitreleased=\"%zu\"", _extensions->heapDecommitter->getQueuedBytes(), _extensions->heapDecommitter->getReleasedBytes());
+	}
+
+	writer->formatAndOutput(env, indent, "<heap-resize id=\"%zu\" type=\"%s\" space=\"%s\" amount=\"%zu\" count=\"%zu\" timems=\"%llu.%03llu\" reason=\"%s\"%s %s />", id, resizeTypeName, getSubSpaceType(subSpaceType), resizeAmount, resizeCount, timeInMicroSeconds / 1000, timeInMicroSeconds % 1000, reasonString, featureAttributes, tagTemplate);
 }
 
 void
@@ -112,6 +112,12 @@ public:
 	 */
 	virtual void closeStreams(MM_EnvironmentBase *env);
 
+	/**
+	 * Wait until all output mechanisms on the receiver have written the output passed to them so far.
+	 * @param env vm thread.
+	 */
+	virtual void waitForOutput(MM_EnvironmentBase *env);
+
 	MMINLINE MM_VerboseWriterChain* getWriterChain() { return _writerChain; }
 	
 	virtual void handleFileOpenError(MM_EnvironmentBase *env, char *fileName) {}
@@ -33,6 +33,7 @@
 
 MM_VerboseWriter::MM_VerboseWriter(WriterType type)
 	: MM_Base()
+	,_isBinary(false)
 	,_nextWriter(NULL)
 	,_header(NULL)
 	,_footer(NULL)
@@ -31,7 +31,8 @@ typedef enum {
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -45,6 +46,7 @@ class MM_VerboseWriter : public MM_Base
 	 */
 public:
 protected:
+	bool _isBinary; /**< true if the writer takes the binary verbose format rather than formatted text */
 private:
 	MM_VerboseWriter *_nextWriter;
 
@@ -65,14 +67,29 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string) = 0;
 
+	/**
+	 * Output records of the binary verbose format. Only called on writers for which isBinary() is true.
+	 * @param bytes[in] the encoded records
+	 * @param length[in] the number of bytes to output
+	 */
+	virtual void outputBytes(MM_EnvironmentBase *env, const uint8_t *bytes, uintptr_t length) {}
+
 	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
 	virtual void endOfCycle(MM_EnvironmentBase *env) = 0;
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Wait until all output passed to the writer so far has been written.
+	 * Only writers which write from a thread of their own need to do anything.
+	 */
+	virtual void waitForOutput(MM_EnvironmentBase *env) {}
+
 	MMINLINE WriterType getType(void) { return _type; }
 
+	MMINLINE bool isBinary(void) { return _isBinary; }
+
 	MMINLINE bool isActive(void) { return _isActive; }
 	MMINLINE void isActive(bool isActive) { _isActive = isActive; }
 
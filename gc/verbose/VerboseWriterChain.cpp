@@ -18,6 +18,7 @@
 
 #include "VerboseWriterChain.hpp"
 
+#include "VerboseBinaryEncoder.hpp"
 #include "VerboseBuffer.hpp"
 #include "VerboseWriter.hpp"
 
@@ -33,7 +34,10 @@
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
+	,_binaryEncoder(NULL)
 	,_writers(NULL)
+	,_textWriterCount(0)
+	,_binaryWriterCount(0)
 {}
 
 MM_VerboseWriterChain *
@@ -58,6 +62,13 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase *env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
+	if (0 != _binaryWriterCount) {
+		_binaryEncoder->encodeLine(env, indent, format, args);
+		if (0 == _textWriterCount) {
+			return;
+		}
+	}
+
 	for (uintptr_t i = 0; i < indent; ++i) {
 		_buffer->add(env, INDENT_SPACER);
 	}
@@ -81,10 +92,17 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (writer->isBinary()) {
+			writer->outputBytes(env, _binaryEncoder->contents(), _binaryEncoder->currentSize());
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
+	if (NULL != _binaryEncoder) {
+		_binaryEncoder->reset();
+	}
 }
 
 void
@@ -94,6 +112,10 @@ MM_VerboseWriterChain::tearDown(MM_EnvironmentBase* env)
 		_buffer->kill(env);
 		_buffer = NULL;
 	}
+	if (NULL != _binaryEncoder) {
+		_binaryEncoder->kill(env);
+		_binaryEncoder = NULL;
+	}
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
 		MM_VerboseWriter* nextWriter = writer->getNextWriter();
@@ -118,6 +140,13 @@ MM_VerboseWriterChain::initialize(MM_EnvironmentBase* env)
 	if(NULL == _buffer) {
 		result = false;
 	}
+
+	if (result && env->getExtensions()->verboseBinaryFormat) {
+		_binaryEncoder = MM_VerboseBinaryEncoder::newInstance(env);
+		if (NULL == _binaryEncoder) {
+			result = false;
+		}
+	}
 	
 	return result;
 }
@@ -125,8 +154,16 @@ MM_VerboseWriterChain::initialize(MM_EnvironmentBase* env)
 void
 MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 {
+	/* a binary writer can only be added if the encoder exists */
+	Assert_VGC_true(!writer->isBinary() || (NULL != _binaryEncoder));
+
 	writer->setNextWriter(_writers);
 	_writers = writer;
+	if (writer->isBinary()) {
+		_binaryWriterCount += 1;
+	} else {
+		_textWriterCount += 1;
+	}
 }
 
 void
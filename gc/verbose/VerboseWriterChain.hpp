@@ -27,6 +27,7 @@
 
 #include "EnvironmentBase.hpp"
 
+class MM_VerboseBinaryEncoder;
 class MM_VerboseBuffer;
 class MM_VerboseWriter;
 
@@ -40,7 +41,10 @@ public:
 protected:
 private:
 	MM_VerboseBuffer *_buffer;
+	MM_VerboseBinaryEncoder *_binaryEncoder; /**< encodes output for binary writers, NULL unless verboseBinaryFormat is set */
 	MM_VerboseWriter *_writers;
+	uintptr_t _textWriterCount; /**< number of writers taking formatted output */
+	uintptr_t _binaryWriterCount; /**< number of writers taking encoded output */
 
 public:
 	static MM_VerboseWriterChain *newInstance(MM_EnvironmentBase *env);
@@ -63,6 +67,12 @@ public:
 	 */
 	MM_VerboseWriter *getFirstWriter() { return _writers; }
 
+	/**
+	 * Fetch the encoder used for the binary verbose format.
+	 * @return the encoder, or NULL if the binary format is not enabled
+	 */
+	MM_VerboseBinaryEncoder *getBinaryEncoder() { return _binaryEncoder; }
+
 	/**
 	 * Notify each of the writers in the chain that a GC cycle has ended
 	 * @param env[in] the current thread 
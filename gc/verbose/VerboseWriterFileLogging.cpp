@@ -17,7 +17,9 @@
  *******************************************************************************/
 
 #include "modronapicore.hpp"
+#include "VerboseBinaryEncoder.hpp"
 #include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
 #include "VerboseWriterFileLogging.hpp"
 
 #include "GCExtensionsBase.hpp"
@@ -39,7 +41,7 @@ MM_VerboseWriterFileLogging::MM_VerboseWriterFileLogging(MM_EnvironmentBase *env
 	,_tokens(NULL)
  	,_manager(manager)
 {
-	/* No implementation */
+	_isBinary = env->getExtensions()->verboseBinaryFormat;
 }
 
 /**
@@ -320,3 +322,56 @@ MM_VerboseWriterFileLogging::reconfigure(MM_EnvironmentBase *env, const char *fi
 	return initialize(env, filename, numFiles, numCycles);
 }
 
+
+/**
+ * Build the start of a binary verbose file: the preamble, with the formatted header, and the definitions made so far.
+ * @param length[out] number of bytes returned
+ * @return the bytes, to be freed with freeBinaryBytes(), or NULL if they could not be built
+ */
+uint8_t *
+MM_VerboseWriterFileLogging::newBinaryHeader(MM_EnvironmentBase *env, uintptr_t *length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	MM_VerboseBinaryEncoder *encoder = _manager->getWriterChain()->getBinaryEncoder();
+	const char* version = omrgc_get_version(env->getOmrVM());
+	uint8_t *bytes = NULL;
+
+	uintptr_t headerLength = omrstr_printf(NULL, 0, getHeader(env), version);
+	char *header = (char *)extensions->getForge()->allocate(headerLength + 1, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != header) {
+		omrstr_printf(header, headerLength + 1, getHeader(env), version);
+		bytes = encoder->newPreamble(env, header, length);
+		extensions->getForge()->free(header);
+	}
+	return bytes;
+}
+
+/**
+ * Build the end of a binary verbose file: a text record holding the footer.
+ * @param length[out] number of bytes returned
+ * @return the bytes, to be freed with freeBinaryBytes(), or NULL if they could not be built
+ */
+uint8_t *
+MM_VerboseWriterFileLogging::newBinaryFooter(MM_EnvironmentBase *env, uintptr_t *length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	MM_VerboseBinaryEncoder *encoder = _manager->getWriterChain()->getBinaryEncoder();
+	uint8_t *bytes = NULL;
+
+	uintptr_t footerLength = strlen(getFooter(env)) + 1;
+	char *footer = (char *)extensions->getForge()->allocate(footerLength + 1, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != footer) {
+		omrstr_printf(footer, footerLength + 1, "%s\n", getFooter(env));
+		bytes = encoder->newTextRecord(env, footer, length);
+		extensions->getForge()->free(footer);
+	}
+	return bytes;
+}
+
+void
+MM_VerboseWriterFileLogging::freeBinaryBytes(MM_EnvironmentBase *env, uint8_t *bytes)
+{
+	_manager->getWriterChain()->getBinaryEncoder()->freeBytes(env, bytes);
+}
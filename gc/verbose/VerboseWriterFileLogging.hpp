@@ -73,6 +73,10 @@ protected:
 	bool initializeFilename(MM_EnvironmentBase *env, const char *filename);
 	bool initializeTokens(MM_EnvironmentBase *env);
 	char* expandFilename(MM_EnvironmentBase *env, uintptr_t currentFile);
+
+	uint8_t *newBinaryHeader(MM_EnvironmentBase *env, uintptr_t *length);
+	uint8_t *newBinaryFooter(MM_EnvironmentBase *env, uintptr_t *length);
+	void freeBinaryBytes(MM_EnvironmentBase *env, uint8_t *bytes);
 private:
 };
 
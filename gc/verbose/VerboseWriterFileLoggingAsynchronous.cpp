@@ -0,0 +1,529 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include "modronapicore.hpp"
+#include "omrutil.h"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBinaryEncoder.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
+
+#include <string.h>
+
+/* how long the drain thread sleeps when it has not been notified of new records */
+#define VERBOSE_DRAIN_INTERVAL_MILLIS 100
+/* how long to wait for a reserved record to be published */
+#define VERBOSE_PUBLISH_WAIT_MILLIS 1
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_logFileDescriptor(-1)
+	,_ring(NULL)
+	,_ringSize(0)
+	,_reserveCursor(0)
+	,_drainCursor(0)
+	,_droppedRecords(0)
+	,_reportedDroppedRecords(0)
+	,_drainMonitor(NULL)
+	,_drainThreadState(STATE_ERROR)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * The ring and the drain thread are kept when the writer is reconfigured.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL == _drainMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_drainMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous")) {
+			_drainMonitor = NULL;
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	if (NULL == _ring) {
+		/* a power of two, so that cursors can wrap around the address space */
+		_ringSize = sizeof(uintptr_t);
+		while (_ringSize < extensions->asynchronousLoggingBufferSize) {
+			_ringSize <<= 1;
+		}
+		_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, MM_AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+		memset(_ring, 0, _ringSize);
+
+		if (!startDrainThread(env)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Records still in the ring are written out before the drain thread exits.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (NULL != _drainMonitor) {
+		stopDrainThread(env);
+		closeFile(env);
+		omrthread_monitor_destroy(_drainMonitor);
+		_drainMonitor = NULL;
+	}
+
+	extensions->getForge()->free(_ring);
+	_ring = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Start the drain thread and wait for it to report that it is running.
+ * @return true if the thread is running, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startDrainThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		drainThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _drainThreadState) {
+			omrthread_monitor_wait(_drainMonitor);
+		}
+	} else {
+		_drainThreadState = STATE_ERROR;
+	}
+	bool result = (STATE_RUNNING == _drainThreadState);
+	omrthread_monitor_exit(_drainMonitor);
+
+	return result;
+}
+
+/**
+ * Ask the drain thread to write out the remaining records and wait for it to exit.
+ * If there is no drain thread the remaining records are written out by the caller.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopDrainThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	if ((STATE_ERROR == _drainThreadState) || (STATE_TERMINATED == _drainThreadState)) {
+		if (NULL != _ring) {
+			drainRecords(env);
+		}
+	} else {
+		while (STATE_TERMINATED != _drainThreadState) {
+			_drainThreadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_drainMonitor);
+			omrthread_monitor_wait(_drainMonitor);
+		}
+	}
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::drainThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->drainThreadEntryPoint();
+	return 0;
+}
+
+/**
+ * Body of the drain thread: write out records as they are published until asked to terminate.
+ * The thread holds the drain monitor except while waiting, so the file is only ever written by one thread.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::drainThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_drainMonitor);
+	_drainThreadState = STATE_RUNNING;
+	omrthread_monitor_notify_all(_drainMonitor);
+
+	while (STATE_RUNNING == _drainThreadState) {
+		bool unpublished = drainRecords(&env);
+		/* wake any thread waiting for output to be written */
+		omrthread_monitor_notify_all(_drainMonitor);
+		if (STATE_RUNNING == _drainThreadState) {
+			omrthread_monitor_wait_timed(_drainMonitor, unpublished ? VERBOSE_PUBLISH_WAIT_MILLIS : VERBOSE_DRAIN_INTERVAL_MILLIS, 0);
+		}
+	}
+
+	while (drainRecords(&env)) {
+		omrthread_monitor_wait_timed(_drainMonitor, VERBOSE_PUBLISH_WAIT_MILLIS, 0);
+	}
+
+	_drainThreadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_drainMonitor);
+	omrthread_exit(_drainMonitor);
+}
+
+/**
+ * Copy a record into the ring and publish it.
+ * Never blocks: if the record does not fit in the space the drain thread has freed it is dropped.
+ * @param kind the kind of record
+ * @param payload bytes to copy into the record (may be NULL if length is 0)
+ * @param length number of payload bytes
+ * @return true if the record was published, false if it was dropped
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::addRecord(uintptr_t kind, const char *payload, uintptr_t length)
+{
+	uintptr_t size = recordSize(length);
+	uintptr_t start = 0;
+
+	if (size > _ringSize) {
+		MM_AtomicOperations::add(&_droppedRecords, 1);
+		return false;
+	}
+
+	do {
+		/* read the drain cursor first so the used space computed below can only be overestimated */
+		uintptr_t drainCursor = _drainCursor;
+		MM_AtomicOperations::loadSync();
+		start = _reserveCursor;
+		if ((start + size - drainCursor) > _ringSize) {
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			return false;
+		}
+	} while (start != MM_AtomicOperations::lockCompareExchange(&_reserveCursor, start, start + size));
+
+	uintptr_t mask = _ringSize - 1;
+	uintptr_t offset = start & mask;
+	if (0 != length) {
+		uintptr_t payloadOffset = (offset + sizeof(uintptr_t)) & mask;
+		uintptr_t firstLength = OMR_MIN(length, _ringSize - payloadOffset);
+		memcpy(_ring + payloadOffset, payload, firstLength);
+		memcpy(_ring, payload + firstLength, length - firstLength);
+	}
+
+	/* the payload must be visible before the header publishes it */
+	MM_AtomicOperations::storeSync();
+	*(volatile uintptr_t *)(_ring + offset) = (length << RECORD_LENGTH_SHIFT) | kind;
+
+	return true;
+}
+
+/**
+ * Write out the published records in ring order. Must be called with the drain monitor held.
+ * @return true if writing stopped at a record which has been reserved but not yet published
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::drainRecords(MM_EnvironmentBase *env)
+{
+	uintptr_t mask = _ringSize - 1;
+
+	while (_drainCursor != _reserveCursor) {
+		uintptr_t cursor = _drainCursor;
+		uintptr_t offset = cursor & mask;
+		uintptr_t header = *(volatile uintptr_t *)(_ring + offset);
+		if (0 == header) {
+			return true;
+		}
+		MM_AtomicOperations::loadSync();
+
+		uintptr_t length = header >> RECORD_LENGTH_SHIFT;
+		uintptr_t size = recordSize(length);
+		if (RECORD_OUTPUT == (header & RECORD_KIND_MASK)) {
+			uintptr_t droppedRecords = _droppedRecords;
+			if (droppedRecords != _reportedDroppedRecords) {
+				writeDroppedNote(env, droppedRecords - _reportedDroppedRecords);
+				_reportedDroppedRecords = droppedRecords;
+			}
+			uintptr_t payloadOffset = (offset + sizeof(uintptr_t)) & mask;
+			uintptr_t firstLength = OMR_MIN(length, _ringSize - payloadOffset);
+			writeOutput(env, (const char *)(_ring + payloadOffset), firstLength);
+			if (firstLength < length) {
+				writeOutput(env, (const char *)_ring, length - firstLength);
+			}
+		} else {
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+
+		/* clear the record so that its space reads as unpublished when it is reserved again */
+		uintptr_t firstSize = OMR_MIN(size, _ringSize - offset);
+		memset(_ring + offset, 0, firstSize);
+		memset(_ring, 0, size - firstSize);
+		MM_AtomicOperations::storeSync();
+		_drainCursor = cursor + size;
+	}
+
+	return false;
+}
+
+/**
+ * Write output (text, or binary records) to the log file, opening it if required. Must be called with the drain monitor held.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeOutput(MM_EnvironmentBase *env, const char *output, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if (_isBinary) {
+		/* binary records are of no use on the terminal, so they are dropped if the file can not be opened */
+		if(-1 != _logFileDescriptor){
+			omrfile_write(_logFileDescriptor, output, length);
+		}
+	} else if(-1 != _logFileDescriptor){
+		omrfile_write_text(_logFileDescriptor, output, length);
+	} else {
+		omrfile_write_text(OMRPORT_TTY_ERR, output, length);
+	}
+}
+
+/**
+ * Note in the output that records have been dropped. Must be called with the drain monitor held.
+ * In the binary format the dropped records may have held definitions, so all definitions are repeated.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeDroppedNote(MM_EnvironmentBase *env, uintptr_t droppedRecords)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	char note[64];
+	uintptr_t noteLength = omrstr_printf(note, sizeof(note), "<!-- %zu verbose records dropped -->\n", droppedRecords);
+
+	if (_isBinary) {
+		uintptr_t length = 0;
+		uint8_t *bytes = _manager->getWriterChain()->getBinaryEncoder()->newTextRecord(env, note, &length);
+		if (NULL != bytes) {
+			writeOutput(env, (const char *)bytes, length);
+			freeBinaryBytes(env, bytes);
+		}
+		bytes = _manager->getWriterChain()->getBinaryEncoder()->newDefinitions(env, &length);
+		if (NULL != bytes) {
+			writeOutput(env, (const char *)bytes, length);
+			freeBinaryBytes(env, bytes);
+		}
+	} else {
+		writeOutput(env, note, noteLength);
+	}
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	char *filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if(-1 == _logFileDescriptor) {
+		char *cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ( (cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL ) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileDescriptor = omrfile_open(filenameToOpen, EsOpenRead | EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	if (_isBinary) {
+		uintptr_t length = 0;
+		uint8_t *header = newBinaryHeader(env, &length);
+		if (NULL != header) {
+			omrfile_write(_logFileDescriptor, header, length);
+			freeBinaryBytes(env, header);
+		}
+	} else {
+		omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 != _logFileDescriptor) {
+		if (_isBinary) {
+			uintptr_t length = 0;
+			uint8_t *footer = newBinaryFooter(env, &length);
+			if (NULL != footer) {
+				omrfile_write(_logFileDescriptor, footer, length);
+				freeBinaryBytes(env, footer);
+			}
+		} else {
+			omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+			omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		}
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+/**
+ * Queue output for the drain thread. The drain thread is woken if its monitor is free;
+ * otherwise it is busy writing and will find the record before it next waits.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::queueOutput(const char *output, uintptr_t length)
+{
+	if (addRecord(RECORD_OUTPUT, output, length)) {
+		if (0 == omrthread_monitor_try_enter(_drainMonitor)) {
+			omrthread_monitor_notify_all(_drainMonitor);
+			omrthread_monitor_exit(_drainMonitor);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	queueOutput(string, strlen(string));
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputBytes(MM_EnvironmentBase *env, const uint8_t *bytes, uintptr_t length)
+{
+	queueOutput((const char *)bytes, length);
+}
+
+/**
+ * Queue an end of cycle marker, so that files are rotated after the output of the cycle has been written.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	addRecord(RECORD_END_OF_CYCLE, NULL, 0);
+}
+
+/**
+ * Write out all records queued so far on the calling thread, rather than waiting for the drain thread.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::waitForOutput(MM_EnvironmentBase *env)
+{
+	uintptr_t target = _reserveCursor;
+
+	omrthread_monitor_enter(_drainMonitor);
+	/* the drain cursor is behind the target while their (modular) distance is within the ring */
+	while ((0 != (target - _drainCursor)) && ((target - _drainCursor) <= _ringSize)) {
+		if (drainRecords(env)) {
+			omrthread_monitor_wait_timed(_drainMonitor, VERBOSE_PUBLISH_WAIT_MILLIS, 0);
+		}
+	}
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+/**
+ * Closes the agent's output stream once the queued output has been written.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	waitForOutput(env);
+	closeFile(env);
+	omrthread_monitor_exit(_drainMonitor);
+}
+
+/**
+ * Reconfigures the agent once the queued output has been written to the current file.
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	omrthread_monitor_enter(_drainMonitor);
+	waitForOutput(env);
+	bool result = MM_VerboseWriterFileLogging::reconfigure(env, filename, numFiles, numCycles);
+	omrthread_monitor_exit(_drainMonitor);
+	return result;
+}
@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "Math.hpp"
+#include "VerboseWriterFileLogging.hpp"
+
+/**
+ * Output agent which directs verbosegc output to file from a background thread.
+ * Output is copied into a ring buffer of records and written out by a drain thread, so the
+ * thread producing the output (typically the master GC thread, inside the pause) never waits on
+ * the file system. Records are added without locking: space is reserved by advancing the reserve
+ * cursor, the record is copied in and then published by storing its header word. Records which do
+ * not fit in the space left in the ring are dropped and counted rather than waited for.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	/**
+	 * Kind of a record, held in the low bits of its header word. The payload length is held above them.
+	 * A zero header marks a record which has been reserved but not yet published.
+	 */
+	enum {
+		RECORD_OUTPUT = 1, /**< payload is output text, or binary records if the writer is binary */
+		RECORD_END_OF_CYCLE = 2, /**< no payload, marks the end of a cycle for file rotation */
+		RECORD_KIND_MASK = 3,
+		RECORD_LENGTH_SHIFT = 2
+	};
+
+	enum DrainThreadState {
+		STATE_ERROR = 0, /**< the drain thread failed to start */
+		STATE_STARTING, /**< the drain thread is being started */
+		STATE_RUNNING, /**< the drain thread is writing out records as they are published */
+		STATE_TERMINATION_REQUESTED, /**< the drain thread is to write out the remaining records and exit */
+		STATE_TERMINATED /**< the drain thread has exited */
+	};
+
+	OMR_VM *_omrVM; /**< the VM the drain thread builds its environment from */
+	intptr_t _logFileDescriptor; /**< the file being written to, only touched while holding _drainMonitor */
+	uint8_t *_ring; /**< records waiting to be written */
+	uintptr_t _ringSize; /**< size of _ring in bytes, a power of two */
+	volatile uintptr_t _reserveCursor; /**< ring offset (modulo _ringSize) of the end of the last reserved record */
+	volatile uintptr_t _drainCursor; /**< ring offset (modulo _ringSize) of the next record to write */
+	volatile uintptr_t _droppedRecords; /**< number of records dropped because the ring was full */
+	uintptr_t _reportedDroppedRecords; /**< number of dropped records already noted in the output */
+	omrthread_monitor_t _drainMonitor; /**< held by the drain thread while writing; waited on for new records */
+	volatile DrainThreadState _drainThreadState; /**< drain thread life cycle state, updated under _drainMonitor */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+
+	virtual void outputBytes(MM_EnvironmentBase *env, const uint8_t *bytes, uintptr_t length);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	virtual void waitForOutput(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the number of records dropped because the background thread had fallen too far behind
+	 */
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool openFile(MM_EnvironmentBase *env);
+	void closeFile(MM_EnvironmentBase *env);
+
+	bool startDrainThread(MM_EnvironmentBase *env);
+	void stopDrainThread(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC drainThreadProc(void *info);
+	void drainThreadEntryPoint();
+
+	bool addRecord(uintptr_t kind, const char *payload, uintptr_t length);
+	void queueOutput(const char *output, uintptr_t length);
+	bool drainRecords(MM_EnvironmentBase *env);
+	void writeOutput(MM_EnvironmentBase *env, const char *output, uintptr_t length);
+	void writeDroppedNote(MM_EnvironmentBase *env, uintptr_t droppedRecords);
+
+	/**
+	 * @return ring bytes taken by a record with the given payload length, including its header
+	 */
+	MMINLINE uintptr_t
+	recordSize(uintptr_t length)
+	{
+		return MM_Math::roundToCeiling(sizeof(uintptr_t), sizeof(uintptr_t) + length);
+	}
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
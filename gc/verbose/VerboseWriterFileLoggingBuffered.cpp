@@ -112,7 +112,16 @@ MM_VerboseWriterFileLoggingBuffered::openFile(MM_EnvironmentBase *env)
 
 	extensions->getForge()->free(filenameToOpen);
 	
-	omrfilestream_printf(_logFileStream, getHeader(env), version);
+	if (_isBinary) {
+		uintptr_t length = 0;
+		uint8_t *header = newBinaryHeader(env, &length);
+		if (NULL != header) {
+			omrfilestream_write(_logFileStream, header, length);
+			freeBinaryBytes(env, header);
+		}
+	} else {
+		omrfilestream_printf(_logFileStream, getHeader(env), version);
+	}
 	
 	return true;
 }
@@ -126,8 +135,17 @@ MM_VerboseWriterFileLoggingBuffered::closeFile(MM_EnvironmentBase *env)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	
 	if(NULL != _logFileStream) {
-		omrfilestream_write_text(_logFileStream, getFooter(env), strlen(getFooter(env)), J9STR_CODE_PLATFORM_RAW);
-		omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		if (_isBinary) {
+			uintptr_t length = 0;
+			uint8_t *footer = newBinaryFooter(env, &length);
+			if (NULL != footer) {
+				omrfilestream_write(_logFileStream, footer, length);
+				freeBinaryBytes(env, footer);
+			}
+		} else {
+			omrfilestream_write_text(_logFileStream, getFooter(env), strlen(getFooter(env)), J9STR_CODE_PLATFORM_RAW);
+			omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		}
 		omrfilestream_close(_logFileStream);
 		_logFileStream = NULL;
 	}
@@ -148,3 +166,19 @@ MM_VerboseWriterFileLoggingBuffered::outputString(MM_EnvironmentBase *env, const
 		omrfilestream_write_text(OMRPORT_STREAM_ERR, string, strlen(string), J9STR_CODE_PLATFORM_RAW);
 	}
 }
+
+void
+MM_VerboseWriterFileLoggingBuffered::outputBytes(MM_EnvironmentBase *env, const uint8_t *bytes, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(NULL == _logFileStream) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	/* binary records are of no use on the terminal, so they are dropped if the file can not be opened */
+	if(NULL != _logFileStream){
+		omrfilestream_write(_logFileStream, bytes, length);
+	}
+}
@@ -44,6 +44,8 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string);
 
+	virtual void outputBytes(MM_EnvironmentBase *env, const uint8_t *bytes, uintptr_t length);
+
 protected:
 	MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase *env, MM_VerboseManager *manager);
 
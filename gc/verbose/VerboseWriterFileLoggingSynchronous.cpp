@@ -112,7 +112,16 @@ MM_VerboseWriterFileLoggingSynchronous::openFile(MM_EnvironmentBase *env)
 
 	extensions->getForge()->free(filenameToOpen);
 	
-	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	if (_isBinary) {
+		uintptr_t length = 0;
+		uint8_t *header = newBinaryHeader(env, &length);
+		if (NULL != header) {
+			omrfile_write(_logFileDescriptor, header, length);
+			freeBinaryBytes(env, header);
+		}
+	} else {
+		omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	}
 	
 	return true;
 }
@@ -126,8 +135,17 @@ MM_VerboseWriterFileLoggingSynchronous::closeFile(MM_EnvironmentBase *env)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	
 	if(-1 != _logFileDescriptor) {
-		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
-		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		if (_isBinary) {
+			uintptr_t length = 0;
+			uint8_t *footer = newBinaryFooter(env, &length);
+			if (NULL != footer) {
+				omrfile_write(_logFileDescriptor, footer, length);
+				freeBinaryBytes(env, footer);
+			}
+		} else {
+			omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+			omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		}
 		omrfile_close(_logFileDescriptor);
 		_logFileDescriptor = -1;
 	}
@@ -149,3 +167,19 @@ MM_VerboseWriterFileLoggingSynchronous::outputString(MM_EnvironmentBase *env, co
 		omrfile_write_text(OMRPORT_TTY_ERR, string, strlen(string));
 	}
 }
+
+void
+MM_VerboseWriterFileLoggingSynchronous::outputBytes(MM_EnvironmentBase *env, const uint8_t *bytes, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(-1 == _logFileDescriptor) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	/* binary records are of no use on the terminal, so they are dropped if the file can not be opened */
+	if(-1 != _logFileDescriptor){
+		omrfile_write(_logFileDescriptor, bytes, length);
+	}
+}
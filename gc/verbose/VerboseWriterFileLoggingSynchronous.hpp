@@ -44,6 +44,8 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase *env, const char* string);
 
+	virtual void outputBytes(MM_EnvironmentBase *env, const uint8_t *bytes, uintptr_t length);
+
 protected:
 	MM_VerboseWriterFileLoggingSynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
 	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
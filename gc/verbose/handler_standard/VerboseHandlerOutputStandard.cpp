@@ -282,8 +282,18 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "mark", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
-			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (0 != extensions->markingPrefetchDistance) {
+		writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" prefetchcount=\"%zu\" />",
+				markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned, markStats->_objectsPrefetched);
+	} else {
+		writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
+				markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	}
+	if (extensions->workStealingPackets) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<packet-deque-info pushcount=\"%zu\" popcount=\"%zu\" stealcount=\"%zu\" />",
+				workPacketStats->_packetsPushed, workPacketStats->_packetsPopped, workPacketStats->_packetsStolen);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -309,9 +319,35 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
-
-	handleSweepEndInternal(env, eventData);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->isSegregatedHeap() && extensions->segregatedLazySweep) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		/* the swept counts are for the regions the previous collection left unswept */
+		writer->formatAndOutput(env, 1, "<lazy-sweep unswept=\"%zu\" sweptByAllocation=\"%zu\" sweptInBackground=\"%zu\" sweptByCollector=\"%zu\" />",
+				sweepStats->unsweptRegions, sweepStats->lazySweptRegionsByAllocation, sweepStats->lazySweptRegionsInBackground, sweepStats->lazySweptRegionsByCollector);
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+	} else
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+	if ((0 != sweepStats->connectChunks) || (0 != sweepStats->connectSerialFallbacks)) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		if (0 != sweepStats->connectSerialFallbacks) {
+			writer->formatAndOutput(env, 1, "<warning details=\"parallel sweep connect is not supported by the memory pools, the free lists were connected serially\" />");
+		} else if (sweepStats->connectVerified) {
+			writer->formatAndOutput(env, 1, "<sweep-connect segments=\"%zu\" chunks=\"%zu\" freebytes=\"%zu\" freeentries=\"%zu\" serialfreebytes=\"%zu\" serialfreeentries=\"%zu\" />",
+					sweepStats->connectSegments, sweepStats->connectChunks, sweepStats->connectFreeBytes, sweepStats->connectFreeEntryCount,
+					sweepStats->serialConnectFreeBytes, sweepStats->serialConnectFreeEntryCount);
+		} else {
+			writer->formatAndOutput(env, 1, "<sweep-connect segments=\"%zu\" chunks=\"%zu\" />", sweepStats->connectSegments, sweepStats->connectChunks);
+		}
+		handleSweepEndInternal(env, eventData);
+		handleGCOPOuterStanzaEnd(env);
+	} else {
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		handleSweepEndInternal(env, eventData);
+	}
 	exitAtomicReportingBlock();
 }
 
@@ -357,8 +393,16 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	handleGCOPOuterStanzaStart(env, "compact", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
-		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
-				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_windowBytes) {
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" fixupcount=\"%zu\" windowbytes=\"%zu\" reason=\"%s\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, compactStats->_fixupObjects, compactStats->_windowBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		} else {
+			writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" fixupcount=\"%zu\" reason=\"%s\" />",
+					compactStats->_movedObjects, compactStats->_movedBytes, compactStats->_fixupObjects, getCompactionReasonAsString(compactStats->_compactReason));
+		}
+		if (0 != compactStats->_remappedObjects) {
+			writer->formatAndOutput(env, 1, "<compact-remap count=\"%zu\" bytes=\"%zu\" />", compactStats->_remappedObjects, compactStats->_remappedBytes);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -396,7 +440,11 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "scavenge", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
-	writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />", scavengerStats->_tenureAge, scavengerStats->getFlipHistory(0)->_tenureMask, scavengerStats->_tiltRatio);
+	if (0 != scavengerStats->_gcThreadCount) {
+		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" threads=\"%zu\" />", scavengerStats->_tenureAge, scavengerStats->getFlipHistory(0)->_tenureMask, scavengerStats->_tiltRatio, scavengerStats->_gcThreadCount);
+	} else {
+		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />", scavengerStats->_tenureAge, scavengerStats->getFlipHistory(0)->_tenureMask, scavengerStats->_tiltRatio);
+	}
 
 	if (0 != scavengerStats->_flipCount) {
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
@@ -406,6 +454,11 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	for (uintptr_t node = 0; node < scavengerStats->_nodeStatsCount; node++) {
+		MM_ScavengerStats::NodeStats *nodeStats = &scavengerStats->_nodeStats[node];
+		writer->formatAndOutput(env, 1, "<scavenge-node index=\"%zu\" copybytes=\"%zu\" remotecopybytes=\"%zu\" scancount=\"%zu\" stealcount=\"%zu\" />",
+				node, nodeStats->_copyBytes, nodeStats->_remoteCopyBytes, nodeStats->_scanCount, nodeStats->_stealCount);
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -414,6 +467,12 @@ MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintp
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != scavengerStats->_hotFieldCopyCount) {
+		writer->formatAndOutput(env, 1, "<hot-field-copy objects=\"%llu\" />", scavengerStats->_hotFieldCopyCount);
+	}
+	if (0 != scavengerStats->_rememberedSetOverflowCardsScanned) {
+		writer->formatAndOutput(env, 1, "<remembered-set-overflow cards=\"%zu\" />", scavengerStats->_rememberedSetOverflowCardsScanned);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -704,8 +763,8 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCollectionStart(J9HookInterface
 	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
 	writer->formatAndOutput(env, 0, "<concurrent-collection-start %s intervalms=\"%llu.%03llu\" >",
 		tagTemplate, deltaTime / 1000, deltaTime % 1000);
-	writer->formatAndOutput(env, 1, "<concurrent-trace-info reason=\"%s\" tracedByMutators=\"%zu\" tracedByHelpers=\"%zu\" cardsCleaned=\"%zu\" workStackOverflowCount=\"%zu\" />",
-		cardCleaningReasonString, event->tracedByMutators, event->tracedByHelpers, event->cardsCleaned, event->workStackOverflowCount);
+	writer->formatAndOutput(env, 1, "<concurrent-trace-info reason=\"%s\" tracedByMutators=\"%zu\" tracedByHelpers=\"%zu\" cardsCleaned=\"%zu\" cardChunksReleased=\"%zu\" workStackOverflowCount=\"%zu\" />",
+		cardCleaningReasonString, event->tracedByMutators, event->tracedByHelpers, event->cardsCleaned, event->cardChunksReleased, event->workStackOverflowCount);
   	writer->formatAndOutput(env, 0, "</concurrent-collection-start>");
 
 	writer->flush(env);
@@ -818,7 +877,7 @@ MM_VerboseHandlerOutputStandard::outputMemType(MM_EnvironmentBase* env, uintptr_
 		bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos," macro-fragmented=\"%zu\"", (size_t) macroFragment);
 	}
 	bufPos += omrstr_printf(memInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " />");
-	writer->formatAndOutput(env, indent, memInfoBuffer);
+	writer->formatAndOutput(env, indent, "%s", memInfoBuffer);
 }
 
 void
@@ -852,7 +911,7 @@ MM_VerboseHandlerOutputStandard::outputMemoryInfoInnerStanza(MM_EnvironmentBase
 			bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, " macro-fragmented=\"%zu\"", (size_t) stats->_macroFragmentedSize);
 		}
 		bufPos += omrstr_printf(tenureMemInfoBuffer + bufPos, INITIAL_BUFFER_SIZE - bufPos, ">");
-		writer->formatAndOutput(env, indent, tenureMemInfoBuffer);
+		writer->formatAndOutput(env, indent, "%s", tenureMemInfoBuffer);
 
 		outputMemType(env, indent + 1, "soa", (stats->_totalFreeTenureHeapSize - stats->_totalFreeLOAHeapSize), (stats->_totalTenureHeapSize - stats->_totalLOAHeapSize));
 		outputMemType(env, indent + 1, "loa", stats->_totalFreeLOAHeapSize, stats->_totalLOAHeapSize);
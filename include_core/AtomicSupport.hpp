@@ -170,6 +170,23 @@ public:
 #endif /* !defined(ATOMIC_SUPPORT_STUB) */
 	}
 
+	/**
+	 * Hint to the processor that the cache line containing the given address will be read soon.
+	 * The hint never faults, so the address does not need to be mapped.
+	 * @param address The memory location to prefetch
+	 */
+	VMINLINE static void
+	prefetch(const void *address)
+	{
+#if !defined(ATOMIC_SUPPORT_STUB)
+#if defined(_MSC_VER)
+		_mm_prefetch((const char *)address, _MM_HINT_T0);
+#elif defined(__GNUC__)
+		__builtin_prefetch(address);
+#endif /* defined(_MSC_VER) */
+#endif /* !defined(ATOMIC_SUPPORT_STUB) */
+	}
+
 	/**
 	 * Creates a memory barrier.
 	 * On a given processor, any load or store instructions ahead
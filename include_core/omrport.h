@@ -217,6 +217,7 @@
 #define OMRPORT_VMEM_MEMORY_MODE_VIRTUAL 0x00000010
 #define OMRPORT_VMEM_ALLOCATE_TOP_DOWN 0x00000020
 #define OMRPORT_VMEM_ALLOCATE_PERSIST 0x00000040
+#define OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES 0x00000080
 /** @} */
 
 /**
@@ -320,6 +321,10 @@ typedef struct J9PortVmemParams {
 	 * \arg OMRPORT_VMEM_MEMORY_MODE_VIRTUAL used only on z/OS
 	 *			- used to allocate memory in 4K pages using system macros instead of malloc() or __malloc31() routines
 	 *			- on 64-bit, this mode rounds up byteAmount to be aligned to 1M boundary.*
+	 * \arg OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES used only on Linux
+	 *			- advises the OS to back committed memory with transparent huge pages
+	 *			- cleared from the mode of the identifier if the OS refuses the advice, so later commits are not advised
+	 *			- decommit leaves partially covered huge pages committed rather than splitting them
 	 */
 	uintptr_t mode;
 
@@ -1237,6 +1242,10 @@ typedef struct OMRPortLibrary {
 	int32_t (*vmem_get_available_physical_memory)(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 	/** see @ref omrvmem.c::omrvmem_get_process_memory_size "omrvmem_get_process_memory_size"*/
 	int32_t (*vmem_get_process_memory_size)(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+	/** see @ref omrvmem.c::omrvmem_remap_memory "omrvmem_remap_memory"*/
+	intptr_t (*vmem_remap_memory)(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier) ;
+	/** see @ref omrvmem.c::omrvmem_get_transparent_huge_page_size "omrvmem_get_transparent_huge_page_size"*/
+	uintptr_t (*vmem_get_transparent_huge_page_size)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_startup "omrstr_startup"*/
 	int32_t (*str_startup)(struct OMRPortLibrary *portLibrary) ;
 	/** see @ref omrstr.c::omrstr_shutdown "omrstr_shutdown"*/
@@ -1749,6 +1758,8 @@ extern J9_CFUNC int32_t omrport_getVersion(struct OMRPortLibrary *portLibrary);
 #define omrvmem_numa_get_node_details(param1,param2) privateOmrPortLibrary->vmem_numa_get_node_details(privateOmrPortLibrary, (param1), (param2))
 #define omrvmem_get_available_physical_memory(param1) privateOmrPortLibrary->vmem_get_available_physical_memory(privateOmrPortLibrary, (param1))
 #define omrvmem_get_process_memory_size(param1,param2) privateOmrPortLibrary->vmem_get_process_memory_size(privateOmrPortLibrary, (param1), (param2))
+#define omrvmem_remap_memory(param1,param2,param3,param4) privateOmrPortLibrary->vmem_remap_memory(privateOmrPortLibrary, (param1), (param2), (param3), (param4))
+#define omrvmem_get_transparent_huge_page_size() privateOmrPortLibrary->vmem_get_transparent_huge_page_size(privateOmrPortLibrary)
 #define omrstr_startup() privateOmrPortLibrary->str_startup(privateOmrPortLibrary)
 #define omrstr_shutdown() privateOmrPortLibrary->str_shutdown(privateOmrPortLibrary)
 #define omrstr_printf(...) privateOmrPortLibrary->str_printf(privateOmrPortLibrary, __VA_ARGS__)
@@ -211,6 +211,8 @@
 #define OMRPORT_ERROR_VMEM_INSUFFICENT_RESOURCES (OMRPORT_ERROR_VMEM_BASE -1)
 #define OMRPORT_ERROR_VMEM_INVALID_PARAMS (OMRPORT_ERROR_VMEM_BASE -2)
 #define OMRPORT_ERROR_VMEM_NOT_SUPPORTED (OMRPORT_ERROR_VMEM_BASE -3)
+/** The contents were moved to the target, but the source range could not be mapped again and is no longer accessible */
+#define OMRPORT_ERROR_VMEM_REMAP_SOURCE_UNMAPPED (OMRPORT_ERROR_VMEM_BASE -4)
 
 /** @} */
 
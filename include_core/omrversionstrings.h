@@ -0,0 +1,30 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2015
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+/*
+ * include_core/omrversionstrings.h.  Generated from omrversionstrings.h.in by configure.
+ */
+
+#ifndef OMRVERSIONSTRINGS_H
+#define OMRVERSIONSTRINGS_H
+
+#define OMR_VERSION_STRING "<Unknown>"
+
+#define OMR_JIT_VERSION_STRING "<Unknown>"
+
+#endif /* OMRVERSIONSTRINGS_H */
@@ -0,0 +1,430 @@
+../../objs/compilertest_prod/compiler/codegen/CodeGenPrep.o: \
+ ../../compiler/codegen/CodeGenPrep.cpp \
+ ../../compiler/x/amd64/codegen/OMRCodeGenerator.hpp \
+ ../../compiler/x/codegen/OMRCodeGenerator.hpp \
+ ../../compiler/codegen/OMRCodeGenerator.hpp \
+ ../../compiler/codegen/CodeGenPhase.hpp \
+ ../../compiler/infra/Annotations.hpp \
+ ../../compiler/codegen/OMRCodeGenPhase.hpp \
+ ../../compiler/codegen/CodeGenPhaseEnum.hpp \
+ ../../compiler/codegen/OMRCodeGenPhaseEnum.hpp \
+ ../../compiler/codegen/FrontEnd.hpp ../../compiler/infra/List.hpp \
+ ../../compiler/env/TRMemory.hpp ../../compiler/cs2/allocator.h \
+ ../../compiler/cs2/cs2.h ../../compiler/env/TypedAllocator.hpp \
+ ../../compiler/cs2/bitvectr.h ../../compiler/cs2/bitmanip.h \
+ ../../compiler/cs2/sparsrbit.h ../../compiler/cs2/timer.h \
+ ../../compiler/cs2/listof.h ../../compiler/cs2/arrayof.h \
+ ../../compiler/cs2/hashtab.h ../../compiler/env/FilePointerDecl.hpp \
+ ../../compiler/env/PersistentAllocator.hpp \
+ ../../compiler/env/RawAllocator.hpp \
+ ../../compiler/env/PersistentAllocatorKit.hpp \
+ ../../compiler/env/PersistentInfo.hpp \
+ ../../compiler/env/OMRPersistentInfo.hpp \
+ ../../compiler/codegen/TableOfConstants.hpp ../../compiler/env/defines.h \
+ ../../compiler/infra/Assert.hpp \
+ ../../compiler/compile/CompilationException.hpp \
+ ../../compiler/infra/ReferenceWrapper.hpp ../../compiler/env/Region.hpp \
+ ../../compiler/env/MemorySegment.hpp ../../compiler/cs2/llistof.h \
+ ../../compiler/env/jittypes.h ../../compiler/infra/Random.hpp \
+ ../../compiler/env/KnownObjectTable.hpp \
+ ../../compiler/env/OMRKnownObjectTable.hpp \
+ ../../compiler/codegen/Snippet.hpp \
+ ../../compiler/x/codegen/OMRSnippet.hpp \
+ ../../compiler/codegen/OMRSnippet.hpp ../../compiler/infra/Flags.hpp \
+ ../../compiler/codegen/SnippetGCMap.hpp \
+ ../../compiler/codegen/OMRSnippetGCMap.hpp \
+ ../../compiler/env/CompilerEnv.hpp ../../compiler/env/OMRCompilerEnv.hpp \
+ ../../compiler/env/Environment.hpp ../../compiler/env/OMREnvironment.hpp \
+ ../../compiler/env/CPU.hpp ../../compiler/x/env/OMRCPU.hpp \
+ ../../compiler/env/OMRCPU.hpp ../../compiler/env/Processors.hpp \
+ ../../compiler/arm/env/ARMProcessorEnum.hpp \
+ ../../compiler/p/env/PPCProcessorEnum.hpp \
+ ../../compiler/z/env/S390ProcessorEnum.hpp \
+ ../../compiler/x/env/X86ProcessorEnum.hpp \
+ ../../compiler/env/DebugEnv.hpp ../../compiler/x/env/OMRDebugEnv.hpp \
+ ../../compiler/env/OMRDebugEnv.hpp ../../compiler/env/ClassEnv.hpp \
+ ../../compiler/env/OMRClassEnv.hpp \
+ ../../fvtest/compilertest/env/ObjectModel.hpp \
+ ../../fvtest/compilertest/env/TestObjectModel.hpp \
+ ../../compiler/env/OMRObjectModel.hpp ../../compiler/env/ArithEnv.hpp \
+ ../../compiler/env/OMRArithEnv.hpp ../../compiler/env/VMEnv.hpp \
+ ../../compiler/env/OMRVMEnv.hpp \
+ ../../compiler/compile/CompilationTypes.hpp \
+ ../../compiler/infra/Link.hpp ../../compiler/infra/Stack.hpp \
+ ../../compiler/infra/Array.hpp \
+ ../../compiler/optimizer/Optimizations.hpp \
+ ../../compiler/optimizer/Optimizations.enum \
+ ../../compiler/optimizer/OptimizationGroups.enum \
+ ../../compiler/env/ProcessorInfo.hpp ../../compiler/il/DataTypes.hpp \
+ ../../compiler/il/OMRDataTypes.hpp ../../compiler/il/ILOpCodes.hpp \
+ ../../compiler/il/ILOpCodesEnum.hpp \
+ ../../compiler/il/OMRILOpCodesEnum.hpp \
+ ../../compiler/il/DataTypesEnum.hpp ../../compiler/il/ILOps.hpp \
+ ../../compiler/il/OMRILOps.hpp ../../compiler/il/ILHelpers.hpp \
+ ../../compiler/il/ILProps.hpp \
+ ../../compiler/optimizer/OptimizationStrategies.hpp \
+ ../../compiler/runtime/Runtime.hpp \
+ ../../compiler/codegen/LinkageConventionsEnum.hpp \
+ ../../compiler/codegen/LinkageConventions.enum \
+ ../../compiler/runtime/Helpers.inc ../../compiler/env/VerboseLog.hpp \
+ ../../compiler/codegen/RecognizedMethods.hpp \
+ ../../compiler/codegen/OMRRecognizedMethodsEnum.hpp \
+ ../../compiler/codegen/RegisterConstants.hpp \
+ ../../compiler/codegen/StorageInfo.hpp \
+ ../../compiler/codegen/TreeEvaluator.hpp \
+ ../../compiler/x/amd64/codegen/OMRTreeEvaluator.hpp \
+ ../../compiler/x/codegen/OMRTreeEvaluator.hpp \
+ ../../compiler/codegen/OMRTreeEvaluator.hpp ../../compiler/il/Node.hpp \
+ ../../compiler/il/OMRNode.hpp ../../compiler/il/NodeUnions.hpp \
+ ../../compiler/il/NodeUtils.hpp ../../compiler/il/NodeExtension.hpp \
+ ../../compiler/x/codegen/X86Ops.hpp ../../compiler/x/codegen/X86Ops.ins \
+ ../../compiler/compile/Compilation.hpp \
+ ../../compiler/compile/OMRCompilation.hpp \
+ ../../compiler/compile/OSRData.hpp \
+ ../../fvtest/compilertest/compile/Method.hpp \
+ ../../compiler/compile/OMRMethod.hpp \
+ ../../compiler/compile/InlineBlock.hpp \
+ ../../compiler/compile/ResolvedMethod.hpp \
+ ../../compiler/compile/TLSCompilationManager.hpp \
+ ../../compiler/control/OptimizationPlan.hpp \
+ ../../fvtest/compilertest/optimizer/Optimizer.hpp \
+ ../../fvtest/compilertest/optimizer/TestOptimizer.hpp \
+ ../../compiler/optimizer/OMROptimizer.hpp ../../compiler/il/TreeTop.hpp \
+ ../../compiler/il/OMRTreeTop.hpp ../../compiler/il/TreeTop_inlines.hpp \
+ ../../compiler/il/OMRTreeTop_inlines.hpp \
+ ../../compiler/control/Options.hpp ../../compiler/control/OMROptions.hpp \
+ ../../compiler/control/OptionsUtil.hpp \
+ ../../compiler/infra/SimpleRegex.hpp ../../compiler/ras/DebugCounter.hpp \
+ ../../compiler/ras/Debug.hpp ../../compiler/codegen/Machine.hpp \
+ ../../compiler/x/amd64/codegen/OMRMachine.hpp \
+ ../../compiler/x/codegen/OMRMachine.hpp \
+ ../../compiler/codegen/OMRMachine.hpp \
+ ../../compiler/x/codegen/RealRegister.hpp \
+ ../../compiler/x/amd64/codegen/OMRRealRegister.hpp \
+ ../../compiler/x/codegen/OMRRealRegister.hpp \
+ ../../compiler/codegen/OMRRealRegister.hpp \
+ ../../compiler/codegen/Register.hpp \
+ ../../compiler/x/codegen/OMRRegister.hpp \
+ ../../compiler/codegen/OMRRegister.hpp \
+ ../../compiler/x/amd64/codegen/RealRegisterEnum.hpp \
+ ../../compiler/x/amd64/codegen/RealRegisterMaskEnum.hpp \
+ ../../compiler/x/codegen/X86Register.hpp ../../compiler/infra/TRlist.hpp \
+ ../../compiler/compile/VirtualGuard.hpp \
+ ../../compiler/infra/BitVector.hpp ../../compiler/infra/TRCfgNode.hpp \
+ ../../compiler/infra/TRCfgEdge.hpp \
+ ../../compiler/codegen/RegisterRematerializationInfo.hpp \
+ ../../compiler/infra/Monitor.hpp ../../compiler/infra/OMRMonitor.hpp \
+ ../../include_core/omrmutex.h ../../include_core/omrcomp.h \
+ ../../include_core/omrcfg.h ../../include_core/unix/omrmutex.h \
+ ../../compiler/control/Options_inlines.hpp \
+ ../../compiler/control/OMROptions_inlines.hpp ../../compiler/il/IL.hpp \
+ ../../compiler/il/OMRIL.hpp ../../compiler/infra/ThreadLocal.h \
+ ../../include_core/omr.h ../../include_core/omrport.h \
+ ../../include_core/omrthread.h ../../include_core/omrthread_generated.h \
+ ../../include_core/thread_api.h ../../include_core/omrmemcategories.h \
+ ../../include_core/omrporterror.h \
+ ../../compiler/il/symbol/ResolvedMethodSymbol.hpp \
+ ../../compiler/il/symbol/OMRResolvedMethodSymbol.hpp \
+ ../../compiler/il/symbol/MethodSymbol.hpp \
+ ../../compiler/il/symbol/OMRMethodSymbol.hpp \
+ ../../compiler/il/Symbol.hpp ../../compiler/il/symbol/OMRSymbol.hpp \
+ ../../compiler/infra/HashTab.hpp ../../compiler/infra/Bit.hpp \
+ ../../compiler/optimizer/Dominators.hpp ../../compiler/cs2/tableof.h \
+ ../../compiler/il/Block.hpp ../../compiler/il/OMRBlock.hpp \
+ ../../compiler/infra/Cfg.hpp ../../compiler/infra/OMRCfg.hpp \
+ ../../compiler/infra/deque.hpp \
+ ../../compiler/codegen/RegisterPressureSimulatorInner.hpp \
+ ../../compiler/codegen/RegisterIterator.hpp \
+ ../../compiler/x/codegen/OMRRegisterIterator.hpp \
+ ../../compiler/codegen/OMRRegisterIterator.hpp \
+ ../../compiler/codegen/ScratchRegisterManager.hpp \
+ ../../compiler/il/SymbolReference.hpp \
+ ../../compiler/il/OMRSymbolReference.hpp \
+ ../../compiler/compile/SymbolReferenceTable.hpp \
+ ../../compiler/compile/OMRSymbolReferenceTable.hpp \
+ ../../compiler/compile/AliasBuilder.hpp \
+ ../../compiler/compile/OMRAliasBuilder.hpp \
+ ../../compiler/il/symbol/RegisterMappedSymbol.hpp \
+ ../../compiler/il/symbol/OMRRegisterMappedSymbol.hpp \
+ ../../compiler/il/symbol/AutomaticSymbol.hpp \
+ ../../compiler/il/symbol/OMRAutomaticSymbol.hpp \
+ ../../compiler/x/codegen/Instruction.hpp \
+ ../../compiler/x/codegen/OMRInstruction.hpp \
+ ../../compiler/codegen/OMRInstruction.hpp \
+ ../../compiler/x/codegen/InstOpCode.hpp \
+ ../../compiler/codegen/InstructionKindEnum.hpp \
+ ../../compiler/x/codegen/OMRInstructionKindEnum.hpp \
+ ../../compiler/codegen/InstructionFlagEnum.hpp \
+ ../../compiler/codegen/OMRInstructionFlagEnum.hpp \
+ ../../compiler/codegen/OMRInstruction_inlines.hpp \
+ ../../compiler/il/symbol/LabelSymbol.hpp \
+ ../../compiler/il/symbol/OMRLabelSymbol.hpp \
+ ../../compiler/il/symbol/StaticSymbol.hpp \
+ ../../compiler/il/symbol/OMRStaticSymbol.hpp \
+ ../../compiler/x/codegen/OutlinedInstructions.hpp \
+ ../../compiler/codegen/GCStackMap.hpp \
+ ../../compiler/codegen/GCRegisterMap.hpp \
+ ../../compiler/codegen/OMRGCRegisterMap.hpp \
+ ../../compiler/codegen/GCStackAtlas.hpp \
+ ../../compiler/codegen/OMRGCStackAtlas.hpp \
+ ../../fvtest/compilertest/codegen/CodeGenerator.hpp \
+ ../../fvtest/compilertest/codegen/TestCodeGenerator.hpp \
+ ../../compiler/codegen/CodeGenerator_inlines.hpp \
+ ../../compiler/codegen/OMRCodeGenerator_inlines.hpp \
+ ../../compiler/x/codegen/Linkage.hpp \
+ ../../compiler/x/codegen/OMRLinkage.hpp \
+ ../../compiler/codegen/OMRLinkage.hpp \
+ ../../compiler/il/symbol/ParameterSymbol.hpp \
+ ../../compiler/il/symbol/OMRParameterSymbol.hpp \
+ ../../compiler/control/Recompilation.hpp \
+ ../../compiler/control/OMRRecompilation.hpp \
+ ../../compiler/il/AliasSetInterface.hpp \
+ ../../compiler/env/StackMemoryRegion.hpp \
+ ../../compiler/il/Node_inlines.hpp ../../compiler/il/OMRNode_inlines.hpp \
+ ../../compiler/env/IO.hpp ../../compiler/env/OMRIO.hpp \
+ ../../compiler/env/FilePointer.hpp ../../compiler/infra/IGNode.hpp \
+ ../../compiler/infra/InterferenceGraph.hpp \
+ ../../compiler/infra/IGBase.hpp ../../compiler/optimizer/Structure.hpp \
+ ../../compiler/optimizer/VPConstraint.hpp \
+ ../../compiler/ras/Delimiter.hpp
+../../compiler/x/amd64/codegen/OMRCodeGenerator.hpp:
+../../compiler/x/codegen/OMRCodeGenerator.hpp:
+../../compiler/codegen/OMRCodeGenerator.hpp:
+../../compiler/codegen/CodeGenPhase.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/codegen/OMRCodeGenPhase.hpp:
+../../compiler/codegen/CodeGenPhaseEnum.hpp:
+../../compiler/codegen/OMRCodeGenPhaseEnum.hpp:
+../../compiler/codegen/FrontEnd.hpp:
+../../compiler/infra/List.hpp:
+../../compiler/env/TRMemory.hpp:
+../../compiler/cs2/allocator.h:
+../../compiler/cs2/cs2.h:
+../../compiler/env/TypedAllocator.hpp:
+../../compiler/cs2/bitvectr.h:
+../../compiler/cs2/bitmanip.h:
+../../compiler/cs2/sparsrbit.h:
+../../compiler/cs2/timer.h:
+../../compiler/cs2/listof.h:
+../../compiler/cs2/arrayof.h:
+../../compiler/cs2/hashtab.h:
+../../compiler/env/FilePointerDecl.hpp:
+../../compiler/env/PersistentAllocator.hpp:
+../../compiler/env/RawAllocator.hpp:
+../../compiler/env/PersistentAllocatorKit.hpp:
+../../compiler/env/PersistentInfo.hpp:
+../../compiler/env/OMRPersistentInfo.hpp:
+../../compiler/codegen/TableOfConstants.hpp:
+../../compiler/env/defines.h:
+../../compiler/infra/Assert.hpp:
+../../compiler/compile/CompilationException.hpp:
+../../compiler/infra/ReferenceWrapper.hpp:
+../../compiler/env/Region.hpp:
+../../compiler/env/MemorySegment.hpp:
+../../compiler/cs2/llistof.h:
+../../compiler/env/jittypes.h:
+../../compiler/infra/Random.hpp:
+../../compiler/env/KnownObjectTable.hpp:
+../../compiler/env/OMRKnownObjectTable.hpp:
+../../compiler/codegen/Snippet.hpp:
+../../compiler/x/codegen/OMRSnippet.hpp:
+../../compiler/codegen/OMRSnippet.hpp:
+../../compiler/infra/Flags.hpp:
+../../compiler/codegen/SnippetGCMap.hpp:
+../../compiler/codegen/OMRSnippetGCMap.hpp:
+../../compiler/env/CompilerEnv.hpp:
+../../compiler/env/OMRCompilerEnv.hpp:
+../../compiler/env/Environment.hpp:
+../../compiler/env/OMREnvironment.hpp:
+../../compiler/env/CPU.hpp:
+../../compiler/x/env/OMRCPU.hpp:
+../../compiler/env/OMRCPU.hpp:
+../../compiler/env/Processors.hpp:
+../../compiler/arm/env/ARMProcessorEnum.hpp:
+../../compiler/p/env/PPCProcessorEnum.hpp:
+../../compiler/z/env/S390ProcessorEnum.hpp:
+../../compiler/x/env/X86ProcessorEnum.hpp:
+../../compiler/env/DebugEnv.hpp:
+../../compiler/x/env/OMRDebugEnv.hpp:
+../../compiler/env/OMRDebugEnv.hpp:
+../../compiler/env/ClassEnv.hpp:
+../../compiler/env/OMRClassEnv.hpp:
+../../fvtest/compilertest/env/ObjectModel.hpp:
+../../fvtest/compilertest/env/TestObjectModel.hpp:
+../../compiler/env/OMRObjectModel.hpp:
+../../compiler/env/ArithEnv.hpp:
+../../compiler/env/OMRArithEnv.hpp:
+../../compiler/env/VMEnv.hpp:
+../../compiler/env/OMRVMEnv.hpp:
+../../compiler/compile/CompilationTypes.hpp:
+../../compiler/infra/Link.hpp:
+../../compiler/infra/Stack.hpp:
+../../compiler/infra/Array.hpp:
+../../compiler/optimizer/Optimizations.hpp:
+../../compiler/optimizer/Optimizations.enum:
+../../compiler/optimizer/OptimizationGroups.enum:
+../../compiler/env/ProcessorInfo.hpp:
+../../compiler/il/DataTypes.hpp:
+../../compiler/il/OMRDataTypes.hpp:
+../../compiler/il/ILOpCodes.hpp:
+../../compiler/il/ILOpCodesEnum.hpp:
+../../compiler/il/OMRILOpCodesEnum.hpp:
+../../compiler/il/DataTypesEnum.hpp:
+../../compiler/il/ILOps.hpp:
+../../compiler/il/OMRILOps.hpp:
+../../compiler/il/ILHelpers.hpp:
+../../compiler/il/ILProps.hpp:
+../../compiler/optimizer/OptimizationStrategies.hpp:
+../../compiler/runtime/Runtime.hpp:
+../../compiler/codegen/LinkageConventionsEnum.hpp:
+../../compiler/codegen/LinkageConventions.enum:
+../../compiler/runtime/Helpers.inc:
+../../compiler/env/VerboseLog.hpp:
+../../compiler/codegen/RecognizedMethods.hpp:
+../../compiler/codegen/OMRRecognizedMethodsEnum.hpp:
+../../compiler/codegen/RegisterConstants.hpp:
+../../compiler/codegen/StorageInfo.hpp:
+../../compiler/codegen/TreeEvaluator.hpp:
+../../compiler/x/amd64/codegen/OMRTreeEvaluator.hpp:
+../../compiler/x/codegen/OMRTreeEvaluator.hpp:
+../../compiler/codegen/OMRTreeEvaluator.hpp:
+../../compiler/il/Node.hpp:
+../../compiler/il/OMRNode.hpp:
+../../compiler/il/NodeUnions.hpp:
+../../compiler/il/NodeUtils.hpp:
+../../compiler/il/NodeExtension.hpp:
+../../compiler/x/codegen/X86Ops.hpp:
+../../compiler/x/codegen/X86Ops.ins:
+../../compiler/compile/Compilation.hpp:
+../../compiler/compile/OMRCompilation.hpp:
+../../compiler/compile/OSRData.hpp:
+../../fvtest/compilertest/compile/Method.hpp:
+../../compiler/compile/OMRMethod.hpp:
+../../compiler/compile/InlineBlock.hpp:
+../../compiler/compile/ResolvedMethod.hpp:
+../../compiler/compile/TLSCompilationManager.hpp:
+../../compiler/control/OptimizationPlan.hpp:
+../../fvtest/compilertest/optimizer/Optimizer.hpp:
+../../fvtest/compilertest/optimizer/TestOptimizer.hpp:
+../../compiler/optimizer/OMROptimizer.hpp:
+../../compiler/il/TreeTop.hpp:
+../../compiler/il/OMRTreeTop.hpp:
+../../compiler/il/TreeTop_inlines.hpp:
+../../compiler/il/OMRTreeTop_inlines.hpp:
+../../compiler/control/Options.hpp:
+../../compiler/control/OMROptions.hpp:
+../../compiler/control/OptionsUtil.hpp:
+../../compiler/infra/SimpleRegex.hpp:
+../../compiler/ras/DebugCounter.hpp:
+../../compiler/ras/Debug.hpp:
+../../compiler/codegen/Machine.hpp:
+../../compiler/x/amd64/codegen/OMRMachine.hpp:
+../../compiler/x/codegen/OMRMachine.hpp:
+../../compiler/codegen/OMRMachine.hpp:
+../../compiler/x/codegen/RealRegister.hpp:
+../../compiler/x/amd64/codegen/OMRRealRegister.hpp:
+../../compiler/x/codegen/OMRRealRegister.hpp:
+../../compiler/codegen/OMRRealRegister.hpp:
+../../compiler/codegen/Register.hpp:
+../../compiler/x/codegen/OMRRegister.hpp:
+../../compiler/codegen/OMRRegister.hpp:
+../../compiler/x/amd64/codegen/RealRegisterEnum.hpp:
+../../compiler/x/amd64/codegen/RealRegisterMaskEnum.hpp:
+../../compiler/x/codegen/X86Register.hpp:
+../../compiler/infra/TRlist.hpp:
+../../compiler/compile/VirtualGuard.hpp:
+../../compiler/infra/BitVector.hpp:
+../../compiler/infra/TRCfgNode.hpp:
+../../compiler/infra/TRCfgEdge.hpp:
+../../compiler/codegen/RegisterRematerializationInfo.hpp:
+../../compiler/infra/Monitor.hpp:
+../../compiler/infra/OMRMonitor.hpp:
+../../include_core/omrmutex.h:
+../../include_core/omrcomp.h:
+../../include_core/omrcfg.h:
+../../include_core/unix/omrmutex.h:
+../../compiler/control/Options_inlines.hpp:
+../../compiler/control/OMROptions_inlines.hpp:
+../../compiler/il/IL.hpp:
+../../compiler/il/OMRIL.hpp:
+../../compiler/infra/ThreadLocal.h:
+../../include_core/omr.h:
+../../include_core/omrport.h:
+../../include_core/omrthread.h:
+../../include_core/omrthread_generated.h:
+../../include_core/thread_api.h:
+../../include_core/omrmemcategories.h:
+../../include_core/omrporterror.h:
+../../compiler/il/symbol/ResolvedMethodSymbol.hpp:
+../../compiler/il/symbol/OMRResolvedMethodSymbol.hpp:
+../../compiler/il/symbol/MethodSymbol.hpp:
+../../compiler/il/symbol/OMRMethodSymbol.hpp:
+../../compiler/il/Symbol.hpp:
+../../compiler/il/symbol/OMRSymbol.hpp:
+../../compiler/infra/HashTab.hpp:
+../../compiler/infra/Bit.hpp:
+../../compiler/optimizer/Dominators.hpp:
+../../compiler/cs2/tableof.h:
+../../compiler/il/Block.hpp:
+../../compiler/il/OMRBlock.hpp:
+../../compiler/infra/Cfg.hpp:
+../../compiler/infra/OMRCfg.hpp:
+../../compiler/infra/deque.hpp:
+../../compiler/codegen/RegisterPressureSimulatorInner.hpp:
+../../compiler/codegen/RegisterIterator.hpp:
+../../compiler/x/codegen/OMRRegisterIterator.hpp:
+../../compiler/codegen/OMRRegisterIterator.hpp:
+../../compiler/codegen/ScratchRegisterManager.hpp:
+../../compiler/il/SymbolReference.hpp:
+../../compiler/il/OMRSymbolReference.hpp:
+../../compiler/compile/SymbolReferenceTable.hpp:
+../../compiler/compile/OMRSymbolReferenceTable.hpp:
+../../compiler/compile/AliasBuilder.hpp:
+../../compiler/compile/OMRAliasBuilder.hpp:
+../../compiler/il/symbol/RegisterMappedSymbol.hpp:
+../../compiler/il/symbol/OMRRegisterMappedSymbol.hpp:
+../../compiler/il/symbol/AutomaticSymbol.hpp:
+../../compiler/il/symbol/OMRAutomaticSymbol.hpp:
+../../compiler/x/codegen/Instruction.hpp:
+../../compiler/x/codegen/OMRInstruction.hpp:
+../../compiler/codegen/OMRInstruction.hpp:
+../../compiler/x/codegen/InstOpCode.hpp:
+../../compiler/codegen/InstructionKindEnum.hpp:
+../../compiler/x/codegen/OMRInstructionKindEnum.hpp:
+../../compiler/codegen/InstructionFlagEnum.hpp:
+../../compiler/codegen/OMRInstructionFlagEnum.hpp:
+../../compiler/codegen/OMRInstruction_inlines.hpp:
+../../compiler/il/symbol/LabelSymbol.hpp:
+../../compiler/il/symbol/OMRLabelSymbol.hpp:
+../../compiler/il/symbol/StaticSymbol.hpp:
+../../compiler/il/symbol/OMRStaticSymbol.hpp:
+../../compiler/x/codegen/OutlinedInstructions.hpp:
+../../compiler/codegen/GCStackMap.hpp:
+../../compiler/codegen/GCRegisterMap.hpp:
+../../compiler/codegen/OMRGCRegisterMap.hpp:
+../../compiler/codegen/GCStackAtlas.hpp:
+../../compiler/codegen/OMRGCStackAtlas.hpp:
+../../fvtest/compilertest/codegen/CodeGenerator.hpp:
+../../fvtest/compilertest/codegen/TestCodeGenerator.hpp:
+../../compiler/codegen/CodeGenerator_inlines.hpp:
+../../compiler/codegen/OMRCodeGenerator_inlines.hpp:
+../../compiler/x/codegen/Linkage.hpp:
+../../compiler/x/codegen/OMRLinkage.hpp:
+../../compiler/codegen/OMRLinkage.hpp:
+../../compiler/il/symbol/ParameterSymbol.hpp:
+../../compiler/il/symbol/OMRParameterSymbol.hpp:
+../../compiler/control/Recompilation.hpp:
+../../compiler/control/OMRRecompilation.hpp:
+../../compiler/il/AliasSetInterface.hpp:
+../../compiler/env/StackMemoryRegion.hpp:
+../../compiler/il/Node_inlines.hpp:
+../../compiler/il/OMRNode_inlines.hpp:
+../../compiler/env/IO.hpp:
+../../compiler/env/OMRIO.hpp:
+../../compiler/env/FilePointer.hpp:
+../../compiler/infra/IGNode.hpp:
+../../compiler/infra/InterferenceGraph.hpp:
+../../compiler/infra/IGBase.hpp:
+../../compiler/optimizer/Structure.hpp:
+../../compiler/optimizer/VPConstraint.hpp:
+../../compiler/ras/Delimiter.hpp:
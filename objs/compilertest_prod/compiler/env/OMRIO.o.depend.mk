@@ -0,0 +1,9 @@
+../../objs/compilertest_prod/compiler/env/OMRIO.o: \
+ ../../compiler/env/OMRIO.cpp ../../compiler/env/IO.hpp \
+ ../../compiler/env/OMRIO.hpp ../../compiler/env/FilePointerDecl.hpp \
+ ../../compiler/infra/Annotations.hpp ../../compiler/env/FilePointer.hpp
+../../compiler/env/IO.hpp:
+../../compiler/env/OMRIO.hpp:
+../../compiler/env/FilePointerDecl.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/env/FilePointer.hpp:
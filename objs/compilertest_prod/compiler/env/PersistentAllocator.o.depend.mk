@@ -0,0 +1,8 @@
+../../objs/compilertest_prod/compiler/env/PersistentAllocator.o: \
+ ../../compiler/env/PersistentAllocator.cpp \
+ ../../compiler/env/PersistentAllocator.hpp \
+ ../../compiler/env/RawAllocator.hpp \
+ ../../compiler/env/PersistentAllocatorKit.hpp
+../../compiler/env/PersistentAllocator.hpp:
+../../compiler/env/RawAllocator.hpp:
+../../compiler/env/PersistentAllocatorKit.hpp:
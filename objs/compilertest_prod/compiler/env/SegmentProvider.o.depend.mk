@@ -0,0 +1,4 @@
+../../objs/compilertest_prod/compiler/env/SegmentProvider.o: \
+ ../../compiler/env/SegmentProvider.cpp \
+ ../../compiler/env/SegmentProvider.hpp
+../../compiler/env/SegmentProvider.hpp:
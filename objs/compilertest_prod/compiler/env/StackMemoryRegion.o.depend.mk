@@ -0,0 +1,48 @@
+../../objs/compilertest_prod/compiler/env/StackMemoryRegion.o: \
+ ../../compiler/env/StackMemoryRegion.cpp \
+ ../../compiler/env/StackMemoryRegion.hpp ../../compiler/env/Region.hpp \
+ ../../compiler/infra/ReferenceWrapper.hpp \
+ ../../compiler/env/TypedAllocator.hpp \
+ ../../compiler/env/MemorySegment.hpp ../../compiler/env/RawAllocator.hpp \
+ ../../compiler/infra/Assert.hpp ../../compiler/infra/Annotations.hpp \
+ ../../compiler/compile/CompilationException.hpp \
+ ../../compiler/env/TRMemory.hpp ../../compiler/cs2/allocator.h \
+ ../../compiler/cs2/cs2.h ../../compiler/cs2/bitvectr.h \
+ ../../compiler/cs2/bitmanip.h ../../compiler/cs2/sparsrbit.h \
+ ../../compiler/cs2/timer.h ../../compiler/cs2/listof.h \
+ ../../compiler/cs2/arrayof.h ../../compiler/cs2/hashtab.h \
+ ../../compiler/env/FilePointerDecl.hpp \
+ ../../compiler/env/PersistentAllocator.hpp \
+ ../../compiler/env/PersistentAllocatorKit.hpp \
+ ../../compiler/env/PersistentInfo.hpp \
+ ../../compiler/env/OMRPersistentInfo.hpp \
+ ../../compiler/codegen/TableOfConstants.hpp ../../compiler/env/defines.h \
+ ../../compiler/cs2/llistof.h ../../compiler/env/jittypes.h
+../../compiler/env/StackMemoryRegion.hpp:
+../../compiler/env/Region.hpp:
+../../compiler/infra/ReferenceWrapper.hpp:
+../../compiler/env/TypedAllocator.hpp:
+../../compiler/env/MemorySegment.hpp:
+../../compiler/env/RawAllocator.hpp:
+../../compiler/infra/Assert.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/compile/CompilationException.hpp:
+../../compiler/env/TRMemory.hpp:
+../../compiler/cs2/allocator.h:
+../../compiler/cs2/cs2.h:
+../../compiler/cs2/bitvectr.h:
+../../compiler/cs2/bitmanip.h:
+../../compiler/cs2/sparsrbit.h:
+../../compiler/cs2/timer.h:
+../../compiler/cs2/listof.h:
+../../compiler/cs2/arrayof.h:
+../../compiler/cs2/hashtab.h:
+../../compiler/env/FilePointerDecl.hpp:
+../../compiler/env/PersistentAllocator.hpp:
+../../compiler/env/PersistentAllocatorKit.hpp:
+../../compiler/env/PersistentInfo.hpp:
+../../compiler/env/OMRPersistentInfo.hpp:
+../../compiler/codegen/TableOfConstants.hpp:
+../../compiler/env/defines.h:
+../../compiler/cs2/llistof.h:
+../../compiler/env/jittypes.h:
@@ -0,0 +1,4 @@
+#include "control/OMROptions.hpp"
+
+const char TR_BUILD_NAME[] = "tr.open.test_20261016_0629_";
+
@@ -0,0 +1,8 @@
+../../objs/compilertest_prod/compiler/env/VerboseLog.o: \
+ ../../compiler/env/VerboseLog.cpp ../../compiler/env/VerboseLog.hpp \
+ ../../compiler/infra/Assert.hpp ../../compiler/infra/Annotations.hpp \
+ ../../compiler/compile/CompilationException.hpp
+../../compiler/env/VerboseLog.hpp:
+../../compiler/infra/Assert.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/compile/CompilationException.hpp:
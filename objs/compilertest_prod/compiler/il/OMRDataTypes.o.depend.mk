@@ -0,0 +1,18 @@
+../../objs/compilertest_prod/compiler/il/OMRDataTypes.o: \
+ ../../compiler/il/OMRDataTypes.cpp ../../compiler/il/OMRDataTypes.hpp \
+ ../../compiler/il/ILOpCodes.hpp ../../compiler/il/ILOpCodesEnum.hpp \
+ ../../compiler/il/OMRILOpCodesEnum.hpp \
+ ../../compiler/il/DataTypesEnum.hpp ../../compiler/env/jittypes.h \
+ ../../compiler/il/DataTypes.hpp ../../compiler/infra/Assert.hpp \
+ ../../compiler/infra/Annotations.hpp \
+ ../../compiler/compile/CompilationException.hpp
+../../compiler/il/OMRDataTypes.hpp:
+../../compiler/il/ILOpCodes.hpp:
+../../compiler/il/ILOpCodesEnum.hpp:
+../../compiler/il/OMRILOpCodesEnum.hpp:
+../../compiler/il/DataTypesEnum.hpp:
+../../compiler/env/jittypes.h:
+../../compiler/il/DataTypes.hpp:
+../../compiler/infra/Assert.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/compile/CompilationException.hpp:
@@ -0,0 +1,19 @@
+../../objs/compilertest_prod/compiler/il/OMRIL.o: \
+ ../../compiler/il/OMRIL.cpp ../../compiler/il/IL.hpp \
+ ../../compiler/il/OMRIL.hpp ../../compiler/infra/Annotations.hpp \
+ ../../compiler/il/ILOpCodes.hpp ../../compiler/il/ILOpCodesEnum.hpp \
+ ../../compiler/il/OMRILOpCodesEnum.hpp ../../compiler/il/DataTypes.hpp \
+ ../../compiler/il/OMRDataTypes.hpp ../../compiler/il/DataTypesEnum.hpp \
+ ../../compiler/infra/Assert.hpp \
+ ../../compiler/compile/CompilationException.hpp
+../../compiler/il/IL.hpp:
+../../compiler/il/OMRIL.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/il/ILOpCodes.hpp:
+../../compiler/il/ILOpCodesEnum.hpp:
+../../compiler/il/OMRILOpCodesEnum.hpp:
+../../compiler/il/DataTypes.hpp:
+../../compiler/il/OMRDataTypes.hpp:
+../../compiler/il/DataTypesEnum.hpp:
+../../compiler/infra/Assert.hpp:
+../../compiler/compile/CompilationException.hpp:
@@ -0,0 +1,11 @@
+../../objs/compilertest_prod/compiler/infra/OMRMonitorTable.o: \
+ ../../compiler/infra/OMRMonitorTable.cpp \
+ ../../compiler/infra/MonitorTable.hpp \
+ ../../compiler/infra/OMRMonitorTable.hpp \
+ ../../compiler/infra/Annotations.hpp ../../compiler/infra/Assert.hpp \
+ ../../compiler/compile/CompilationException.hpp
+../../compiler/infra/MonitorTable.hpp:
+../../compiler/infra/OMRMonitorTable.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/infra/Assert.hpp:
+../../compiler/compile/CompilationException.hpp:
@@ -0,0 +1,2 @@
+../../objs/compilertest_prod/compiler/optimizer/DominatorVerifier.o: \
+ ../../compiler/optimizer/DominatorVerifier.cpp
@@ -0,0 +1,2 @@
+../../objs/compilertest_prod/compiler/optimizer/DominatorsChk.o: \
+ ../../compiler/optimizer/DominatorsChk.cpp
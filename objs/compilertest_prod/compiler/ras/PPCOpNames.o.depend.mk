@@ -0,0 +1,2 @@
+../../objs/compilertest_prod/compiler/ras/PPCOpNames.o: \
+ ../../compiler/ras/PPCOpNames.cpp
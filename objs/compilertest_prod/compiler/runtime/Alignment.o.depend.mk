@@ -0,0 +1,2 @@
+../../objs/compilertest_prod/compiler/runtime/Alignment.o: \
+ ../../compiler/runtime/Alignment.cpp
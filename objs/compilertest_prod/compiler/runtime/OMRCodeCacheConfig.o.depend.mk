@@ -0,0 +1,8 @@
+../../objs/compilertest_prod/compiler/runtime/OMRCodeCacheConfig.o: \
+ ../../compiler/runtime/OMRCodeCacheConfig.cpp \
+ ../../compiler/runtime/CodeCacheConfig.hpp \
+ ../../compiler/runtime/OMRCodeCacheConfig.hpp \
+ ../../compiler/infra/Annotations.hpp
+../../compiler/runtime/CodeCacheConfig.hpp:
+../../compiler/runtime/OMRCodeCacheConfig.hpp:
+../../compiler/infra/Annotations.hpp:
@@ -0,0 +1,11 @@
+../../objs/compilertest_prod/compiler/x/codegen/OpBinary.o: \
+ ../../compiler/x/codegen/OpBinary.cpp \
+ ../../compiler/x/codegen/X86Ops.hpp ../../compiler/infra/Assert.hpp \
+ ../../compiler/infra/Annotations.hpp \
+ ../../compiler/compile/CompilationException.hpp \
+ ../../compiler/x/codegen/X86Ops.ins
+../../compiler/x/codegen/X86Ops.hpp:
+../../compiler/infra/Assert.hpp:
+../../compiler/infra/Annotations.hpp:
+../../compiler/compile/CompilationException.hpp:
+../../compiler/x/codegen/X86Ops.ins:
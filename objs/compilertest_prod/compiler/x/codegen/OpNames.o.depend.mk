@@ -0,0 +1,2 @@
+../../objs/compilertest_prod/compiler/x/codegen/OpNames.o: \
+ ../../compiler/x/codegen/OpNames.cpp
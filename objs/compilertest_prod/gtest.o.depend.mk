@@ -0,0 +1,56 @@
+../../objs/compilertest_prod/gtest.o: \
+ ../../third_party/gtest-1.7.0/src/gtest-all.cc \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-internal.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-port.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest-message.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-string.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-filepath.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-type-util.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest-death-test.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-death-test-internal.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest-param-test.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-param-util.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-linked_ptr.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest-printers.h \
+ ../../third_party/gtest-1.7.0/include/gtest/internal/gtest-param-util-generated.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest_prod.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest-test-part.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest-typed-test.h \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest_pred_impl.h \
+ ../../third_party/gtest-1.7.0/src/gtest.cc \
+ ../../third_party/gtest-1.7.0/include/gtest/gtest-spi.h \
+ ../../third_party/gtest-1.7.0/src/gtest-internal-inl.h \
+ ../../third_party/gtest-1.7.0/src/gtest-death-test.cc \
+ ../../third_party/gtest-1.7.0/src/gtest-filepath.cc \
+ ../../third_party/gtest-1.7.0/src/gtest-port.cc \
+ ../../third_party/gtest-1.7.0/src/gtest-printers.cc \
+ ../../third_party/gtest-1.7.0/src/gtest-test-part.cc \
+ ../../third_party/gtest-1.7.0/src/gtest-typed-test.cc
+../../third_party/gtest-1.7.0/include/gtest/gtest.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-internal.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-port.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest-message.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-string.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-filepath.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-type-util.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest-death-test.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-death-test-internal.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest-param-test.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-param-util.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-linked_ptr.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest-printers.h:
+../../third_party/gtest-1.7.0/include/gtest/internal/gtest-param-util-generated.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest_prod.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest-test-part.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest-typed-test.h:
+../../third_party/gtest-1.7.0/include/gtest/gtest_pred_impl.h:
+../../third_party/gtest-1.7.0/src/gtest.cc:
+../../third_party/gtest-1.7.0/include/gtest/gtest-spi.h:
+../../third_party/gtest-1.7.0/src/gtest-internal-inl.h:
+../../third_party/gtest-1.7.0/src/gtest-death-test.cc:
+../../third_party/gtest-1.7.0/src/gtest-filepath.cc:
+../../third_party/gtest-1.7.0/src/gtest-port.cc:
+../../third_party/gtest-1.7.0/src/gtest-printers.cc:
+../../third_party/gtest-1.7.0/src/gtest-test-part.cc:
+../../third_party/gtest-1.7.0/src/gtest-typed-test.cc:
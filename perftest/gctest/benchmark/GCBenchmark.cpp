@@ -0,0 +1,587 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <ctype.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#if defined(LINUX)
+#include <sys/resource.h>
+#endif /* defined(LINUX) */
+
+#include "CollectorLanguageInterface.hpp"
+#include "Configuration.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCBenchmark.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "mmomrhook.h"
+#include "mmprivatehook.h"
+#include "ObjectAllocationModel.hpp"
+#include "ObjectModel.hpp"
+#include "omrgc.h"
+
+bool
+GCBenchmark::initialize()
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(_omrVMThread);
+	_extensions = env->getExtensions();
+	_cli = _extensions->collectorLanguageInterface;
+
+	if (NULL != _options->traceFile) {
+		if (!loadTrace(_options->traceFile)) {
+			return false;
+		}
+	} else {
+		if ((0 == _options->liveObjects) || (0 == _options->breadth)) {
+			fprintf(stderr, "liveObjects and breadth must be greater than 0\n");
+			return false;
+		}
+		_slotCount = _options->liveObjects + _options->window;
+	}
+
+	if (!allocateHolders()) {
+		return false;
+	}
+
+	/* hook the collector last so that allocating the holders is not measured */
+	registerHooks();
+	return true;
+}
+
+void
+GCBenchmark::tearDown()
+{
+	unregisterHooks();
+
+	OMRPORT_ACCESS_FROM_OMRVM(_exampleVM->_omrVM);
+	if (NULL != _holderNames) {
+		for (uintptr_t i = 0; i < _holderCount; i++) {
+			RootEntry searchEntry;
+			searchEntry.name = _holderNames + (i * 32);
+			hashTableRemove(_exampleVM->rootTable, &searchEntry);
+		}
+		omrmem_free_memory(_holderNames);
+		_holderNames = NULL;
+	}
+	if (NULL != _holders) {
+		omrmem_free_memory(_holders);
+		_holders = NULL;
+	}
+}
+
+bool
+GCBenchmark::run()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_exampleVM->_omrVM);
+	bool result = true;
+
+	_startTime = omrtime_hires_clock();
+	if (NULL != _options->traceFile) {
+		for (uintptr_t i = 0; result && (i < _options->repeat); i++) {
+			for (std::vector<GCBenchmarkEvent>::iterator event = _trace.begin(); result && (event != _trace.end()); ++event) {
+				result = replay(&*event);
+			}
+		}
+	} else {
+		result = generate();
+	}
+	_endTime = omrtime_hires_clock();
+
+	return result;
+}
+
+void
+GCBenchmark::report(FILE *out)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_exampleVM->_omrVM);
+
+	uint64_t elapsedMicros = omrtime_hires_delta(_startTime, _endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	double elapsedSeconds = (0 == elapsedMicros) ? 1e-6 : (double)elapsedMicros / 1e6;
+
+	std::vector<uint64_t> sorted;
+	uint64_t totalPauseMicros = 0;
+	for (std::vector<uint64_t>::iterator pause = _pauses.begin(); pause != _pauses.end(); ++pause) {
+		uint64_t pauseMicros = omrtime_hires_delta(0, *pause, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		sorted.push_back(pauseMicros);
+		totalPauseMicros += pauseMicros;
+	}
+	std::sort(sorted.begin(), sorted.end());
+	uint64_t maxPauseMicros = sorted.empty() ? 0 : sorted.back();
+
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t heapSize = heap->getActiveMemorySize();
+	uintptr_t heapFree = heap->getApproximateFreeMemorySize();
+
+	fprintf(out, "{\"benchmark\":\"%s\",\"gcPolicy\":\"%s\",\"elapsedMs\":%.3f,\"allocatedObjects\":%llu,\"allocatedBytes\":%llu,"
+			"\"throughputMBps\":%.2f,\"throughputObjectsPerSecond\":%.0f,\"localCollections\":%llu,\"globalCollections\":%llu,"
+			"\"pauses\":%llu,\"pauseTotalMs\":%.3f,\"pauseP50Ms\":%.3f,\"pauseP99Ms\":%.3f,\"pauseMaxMs\":%.3f,\"gcTimePercent\":%.2f,"
+			"\"heapMaxBytes\":%llu,\"heapCommittedBytes\":%llu,\"heapCommittedPeakBytes\":%llu,\"heapFreeBytes\":%llu,"
+			"\"heapUsedAfterGCPeakBytes\":%llu,\"residentPeakKB\":%llu}\n",
+			_options->name,
+			_extensions->configuration->getBaseVirtualTypeId(),
+			(double)elapsedMicros / 1000.0,
+			(unsigned long long)_allocatedObjects,
+			(unsigned long long)_allocatedBytes,
+			((double)_allocatedBytes / (1024.0 * 1024.0)) / elapsedSeconds,
+			(double)_allocatedObjects / elapsedSeconds,
+			(unsigned long long)_localCollections,
+			(unsigned long long)_globalCollections,
+			(unsigned long long)sorted.size(),
+			(double)totalPauseMicros / 1000.0,
+			(double)percentile(&sorted, 50) / 1000.0,
+			(double)percentile(&sorted, 99) / 1000.0,
+			(double)maxPauseMicros / 1000.0,
+			(0 == elapsedMicros) ? 0.0 : ((double)totalPauseMicros * 100.0) / (double)elapsedMicros,
+			(unsigned long long)heap->getMaximumMemorySize(),
+			(unsigned long long)heapSize,
+			(unsigned long long)OMR_MAX(_peakHeapSize, heapSize),
+			(unsigned long long)heapFree,
+			(unsigned long long)_peakHeapUsed,
+			(unsigned long long)peakResidentKilobytes());
+	fflush(out);
+}
+
+/**
+ * Load an allocation trace. A trace is a text file with one event per line:
+ *
+ *   a <id> <size>              allocate an object of size bytes and keep it live as object id
+ *   s <id> <field> <id>|-      store a reference to the second object (or NULL) in a field of the first
+ *   d <id>                     drop object id; it stays alive only while it is referenced from another object
+ *   g                          request a system collection
+ *
+ * Blank lines and lines starting with '#' are ignored. An id may be reused after it has been dropped.
+ * Ids are mapped to root slots here, reusing the slots of dropped objects, so replaying the trace needs
+ * only as many slots as there are objects live at the same time.
+ */
+bool
+GCBenchmark::loadTrace(const char *fileName)
+{
+	FILE *traceFile = fopen(fileName, "r");
+	if (NULL == traceFile) {
+		fprintf(stderr, "Failed to open trace file %s\n", fileName);
+		return false;
+	}
+
+	std::map<unsigned long long, uintptr_t> liveIds;
+	std::vector<uintptr_t> freeSlots;
+	uintptr_t line = 0;
+	bool result = true;
+	char buffer[256];
+
+	while (result && (NULL != fgets(buffer, sizeof(buffer), traceFile))) {
+		line += 1;
+		char *cursor = buffer;
+		while (isspace((unsigned char)*cursor)) {
+			cursor += 1;
+		}
+		if (('\0' == *cursor) || ('#' == *cursor)) {
+			continue;
+		}
+
+		GCBenchmarkEvent event;
+		event.type = *cursor;
+		event.line = line;
+		event.slot = NO_SLOT;
+		event.value = 0;
+		event.child = NO_SLOT;
+
+		unsigned long long id = 0;
+		unsigned long long value = 0;
+		char childId[32];
+		std::map<unsigned long long, uintptr_t>::iterator entry;
+
+		switch (event.type) {
+		case EVENT_ALLOCATE:
+			if ((2 != sscanf(cursor + 1, "%llu %llu", &id, &value)) || (0 == value)) {
+				result = false;
+			} else if (liveIds.end() != liveIds.find(id)) {
+				fprintf(stderr, "%s:%llu: object %llu is already live\n", fileName, (unsigned long long)line, id);
+				result = false;
+			} else {
+				if (freeSlots.empty()) {
+					event.slot = _slotCount;
+					_slotCount += 1;
+				} else {
+					event.slot = freeSlots.back();
+					freeSlots.pop_back();
+				}
+				event.value = (uintptr_t)value;
+				liveIds[id] = event.slot;
+			}
+			break;
+		case EVENT_STORE:
+			if (3 != sscanf(cursor + 1, "%llu %llu %31s", &id, &value, childId)) {
+				result = false;
+			} else {
+				entry = liveIds.find(id);
+				if (liveIds.end() == entry) {
+					fprintf(stderr, "%s:%llu: object %llu is not live\n", fileName, (unsigned long long)line, id);
+					result = false;
+				} else {
+					event.slot = entry->second;
+					event.value = (uintptr_t)value;
+					if (0 != strcmp(childId, "-")) {
+						unsigned long long child = strtoull(childId, NULL, 10);
+						entry = liveIds.find(child);
+						if (liveIds.end() == entry) {
+							fprintf(stderr, "%s:%llu: object %llu is not live\n", fileName, (unsigned long long)line, child);
+							result = false;
+						} else {
+							event.child = entry->second;
+						}
+					}
+				}
+			}
+			break;
+		case EVENT_DROP:
+			if (1 != sscanf(cursor + 1, "%llu", &id)) {
+				result = false;
+			} else {
+				entry = liveIds.find(id);
+				if (liveIds.end() == entry) {
+					fprintf(stderr, "%s:%llu: object %llu is not live\n", fileName, (unsigned long long)line, id);
+					result = false;
+				} else {
+					event.slot = entry->second;
+					freeSlots.push_back(entry->second);
+					liveIds.erase(entry);
+				}
+			}
+			break;
+		case EVENT_COLLECT:
+			break;
+		default:
+			result = false;
+			break;
+		}
+
+		if (result) {
+			_trace.push_back(event);
+		} else {
+			fprintf(stderr, "%s:%llu: invalid trace event: %s", fileName, (unsigned long long)line, buffer);
+		}
+	}
+
+	fclose(traceFile);
+	return result;
+}
+
+bool
+GCBenchmark::allocateHolders()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_exampleVM->_omrVM);
+
+	_holderCount = (_slotCount + SLOTS_PER_HOLDER - 1) / SLOTS_PER_HOLDER;
+	if (0 == _holderCount) {
+		return true;
+	}
+
+	_holderNames = (char *)omrmem_allocate_memory(_holderCount * 32, OMRMEM_CATEGORY_MM);
+	_holders = (RootEntry **)omrmem_allocate_memory(_holderCount * sizeof(RootEntry *), OMRMEM_CATEGORY_MM);
+	if ((NULL == _holderNames) || (NULL == _holders)) {
+		fprintf(stderr, "Failed to allocate %llu root slot holders\n", (unsigned long long)_holderCount);
+		return false;
+	}
+
+	uintptr_t holderSize = (SLOTS_PER_HOLDER + 1) * sizeof(fomrobject_t);
+	for (uintptr_t i = 0; i < _holderCount; i++) {
+		RootEntry rootEntry;
+		rootEntry.name = _holderNames + (i * 32);
+		omrstr_printf((char *)rootEntry.name, 32, "benchmarkHolder%zu", i);
+		rootEntry.rootPtr = allocateObject(holderSize);
+		if (NULL == rootEntry.rootPtr) {
+			return false;
+		}
+		if (NULL == hashTableAdd(_exampleVM->rootTable, &rootEntry)) {
+			fprintf(stderr, "Failed to add %s to the root table\n", rootEntry.name);
+			return false;
+		}
+	}
+
+	/* Root table entries may move while entries are being added, so find them once they are all in place */
+	for (uintptr_t i = 0; i < _holderCount; i++) {
+		RootEntry searchEntry;
+		searchEntry.name = _holderNames + (i * 32);
+		_holders[i] = (RootEntry *)hashTableFind(_exampleVM->rootTable, &searchEntry);
+	}
+
+	/* the holders are not part of the workload */
+	_allocatedObjects = 0;
+	_allocatedBytes = 0;
+	return true;
+}
+
+void
+GCBenchmark::registerHooks()
+{
+	J9HookInterface **mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+
+	(*mmPrivateHooks)->J9HookRegister(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, hookExclusiveAccessAcquire, (void *)this);
+	(*mmPrivateHooks)->J9HookRegister(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, hookExclusiveAccessRelease, (void *)this);
+	(*mmOmrHooks)->J9HookRegister(mmOmrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, hookLocalGCEnd, (void *)this);
+	(*mmOmrHooks)->J9HookRegister(mmOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, hookGlobalGCEnd, (void *)this);
+}
+
+void
+GCBenchmark::unregisterHooks()
+{
+	if (NULL == _extensions) {
+		return;
+	}
+
+	J9HookInterface **mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	J9HookInterface **mmOmrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+
+	(*mmPrivateHooks)->J9HookUnregister(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, hookExclusiveAccessAcquire, (void *)this);
+	(*mmPrivateHooks)->J9HookUnregister(mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, hookExclusiveAccessRelease, (void *)this);
+	(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, hookLocalGCEnd, (void *)this);
+	(*mmOmrHooks)->J9HookUnregister(mmOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, hookGlobalGCEnd, (void *)this);
+}
+
+bool
+GCBenchmark::replay(GCBenchmarkEvent *event)
+{
+	bool result = true;
+
+	switch (event->type) {
+	case EVENT_ALLOCATE:
+		result = allocateSlot(event->slot, event->value);
+		break;
+	case EVENT_STORE:
+		result = storeField(event->slot, event->value, event->child, event->line);
+		break;
+	case EVENT_DROP:
+		storeSlot(event->slot, NULL);
+		break;
+	case EVENT_COLLECT:
+		result = (OMR_ERROR_NONE == OMR_GC_SystemCollect(_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC));
+		break;
+	default:
+		result = false;
+		break;
+	}
+
+	if (!result) {
+		fprintf(stderr, "Trace event '%c' at line %llu failed\n", event->type, (unsigned long long)event->line);
+	}
+	return result;
+}
+
+/**
+ * Generate the fixed size workload. A tree of liveObjects objects with the given breadth is built first,
+ * with node i held in slot i and linked from field (i - 1) % breadth of its parent (i - 1) / breadth. The
+ * tree is then churned until allocateMegabytes have been allocated: most allocations replace the oldest
+ * of window short lived objects, and one in replaceRate allocations replaces a tree node, relinking the
+ * node's parent and children to the new object so that the live set stays the same size.
+ */
+bool
+GCBenchmark::generate()
+{
+	uintptr_t liveObjects = _options->liveObjects;
+	uintptr_t breadth = _options->breadth;
+	uintptr_t size = _options->objectSize;
+
+	for (uintptr_t node = 0; node < liveObjects; node++) {
+		if (!allocateSlot(node, size)) {
+			return false;
+		}
+		if ((0 != node) && !storeField((node - 1) / breadth, (node - 1) % breadth, node, 0)) {
+			return false;
+		}
+	}
+
+	uint64_t random = (uint64_t)_options->seed;
+	uint64_t allocateBytes = (uint64_t)_options->allocateMegabytes * 1024 * 1024;
+	uintptr_t nextShortLived = 0;
+
+	while ((uint64_t)_allocatedBytes < allocateBytes) {
+		random = (random * 6364136223846793005ULL) + 1442695040888963407ULL;
+		uintptr_t draw = (uintptr_t)(random >> 33);
+
+		if ((0 != _options->replaceRate) && (0 == (draw % _options->replaceRate))) {
+			uintptr_t node = (draw / _options->replaceRate) % liveObjects;
+			if (!allocateSlot(node, size)) {
+				return false;
+			}
+			if ((0 != node) && !storeField((node - 1) / breadth, (node - 1) % breadth, node, 0)) {
+				return false;
+			}
+			for (uintptr_t field = 0; field < breadth; field++) {
+				uintptr_t child = (node * breadth) + field + 1;
+				if (child >= liveObjects) {
+					break;
+				}
+				if (!storeField(node, field, child, 0)) {
+					return false;
+				}
+			}
+		} else if (0 != _options->window) {
+			if (!allocateSlot(liveObjects + nextShortLived, size)) {
+				return false;
+			}
+			nextShortLived = (nextShortLived + 1) % _options->window;
+		} else if (NULL == allocateObject(size)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+omrobjectptr_t
+GCBenchmark::allocateObject(uintptr_t size)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(_omrVMThread);
+	MM_ObjectAllocationModel allocationModel(env, size, 0);
+	omrobjectptr_t object = OMR_GC_AllocateObject(_omrVMThread, &allocationModel);
+
+	if (NULL == object) {
+		fprintf(stderr, "Failed to allocate %llu bytes after %llu objects (%llu bytes)\n",
+				(unsigned long long)size, (unsigned long long)_allocatedObjects, (unsigned long long)_allocatedBytes);
+	} else {
+		_allocatedObjects += 1;
+		_allocatedBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+	}
+	return object;
+}
+
+bool
+GCBenchmark::allocateSlot(uintptr_t slot, uintptr_t size)
+{
+	omrobjectptr_t object = allocateObject(size);
+	if (NULL != object) {
+		/* the allocation may have moved the holders, so the slot is located afterwards */
+		storeSlot(slot, object);
+	}
+	return NULL != object;
+}
+
+fomrobject_t *
+GCBenchmark::slotAddress(uintptr_t slot, omrobjectptr_t *holder)
+{
+	RootEntry *holderEntry = _holders[slot / SLOTS_PER_HOLDER];
+	*holder = _cli->readBarrierLoadRoot(_omrVMThread, &holderEntry->rootPtr);
+	return (fomrobject_t *)*holder + 1 + (slot % SLOTS_PER_HOLDER);
+}
+
+omrobjectptr_t
+GCBenchmark::loadSlot(uintptr_t slot)
+{
+	omrobjectptr_t holder = NULL;
+	return _cli->readBarrierLoad(_omrVMThread, slotAddress(slot, &holder));
+}
+
+void
+GCBenchmark::storeSlot(uintptr_t slot, omrobjectptr_t object)
+{
+	omrobjectptr_t holder = NULL;
+	fomrobject_t *holderSlot = slotAddress(slot, &holder);
+	_cli->writeBarrierStore(_omrVMThread, holder, holderSlot, object);
+}
+
+bool
+GCBenchmark::storeField(uintptr_t parentSlot, uintptr_t field, uintptr_t childSlot, uintptr_t line)
+{
+	omrobjectptr_t parent = loadSlot(parentSlot);
+	omrobjectptr_t child = (NO_SLOT == childSlot) ? NULL : loadSlot(childSlot);
+
+	if (NULL == parent) {
+		fprintf(stderr, "Line %llu: store into an object that is not live\n", (unsigned long long)line);
+		return false;
+	}
+
+	uintptr_t size = _extensions->objectModel.getConsumedSizeInBytesWithHeader(parent);
+	fomrobject_t *firstSlot = (fomrobject_t *)parent + 1;
+	fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parent + size);
+	if (field >= (uintptr_t)(endSlot - firstSlot)) {
+		fprintf(stderr, "Line %llu: field %llu is out of range for an object of %llu bytes\n",
+				(unsigned long long)line, (unsigned long long)field, (unsigned long long)size);
+		return false;
+	}
+
+	_cli->writeBarrierStore(_omrVMThread, parent, firstSlot + field, child);
+	return true;
+}
+
+/**
+ * Nearest rank percentile of an ascending sequence.
+ */
+uint64_t
+GCBenchmark::percentile(std::vector<uint64_t> *sorted, uintptr_t percent)
+{
+	if (sorted->empty()) {
+		return 0;
+	}
+	uintptr_t rank = ((sorted->size() * percent) + 99) / 100;
+	return (*sorted)[(0 == rank) ? 0 : rank - 1];
+}
+
+uintptr_t
+GCBenchmark::peakResidentKilobytes()
+{
+	uintptr_t peak = 0;
+#if defined(LINUX)
+	struct rusage usage;
+	if (0 == getrusage(RUSAGE_SELF, &usage)) {
+		peak = (uintptr_t)usage.ru_maxrss;
+	}
+#endif /* defined(LINUX) */
+	return peak;
+}
+
+void
+GCBenchmark::hookExclusiveAccessAcquire(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_ExclusiveAccessAcquireEvent *event = (MM_ExclusiveAccessAcquireEvent *)eventData;
+	GCBenchmark *benchmark = (GCBenchmark *)userData;
+
+	/* the pause starts when exclusive access was requested, so time to safe point is included */
+	benchmark->_pauseStartTime = event->timestamp - event->exclusiveAccessTime;
+}
+
+void
+GCBenchmark::hookExclusiveAccessRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_ExclusiveAccessReleaseEvent *event = (MM_ExclusiveAccessReleaseEvent *)eventData;
+	GCBenchmark *benchmark = (GCBenchmark *)userData;
+
+	if (0 != benchmark->_pauseStartTime) {
+		benchmark->_pauses.push_back(event->timestamp - benchmark->_pauseStartTime);
+		benchmark->_pauseStartTime = 0;
+	}
+
+	MM_Heap *heap = benchmark->_extensions->heap;
+	uintptr_t heapSize = heap->getActiveMemorySize();
+	uintptr_t heapUsed = heapSize - heap->getApproximateFreeMemorySize();
+	benchmark->_peakHeapSize = OMR_MAX(benchmark->_peakHeapSize, heapSize);
+	benchmark->_peakHeapUsed = OMR_MAX(benchmark->_peakHeapUsed, heapUsed);
+}
+
+void
+GCBenchmark::hookLocalGCEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((GCBenchmark *)userData)->_localCollections += 1;
+}
+
+void
+GCBenchmark::hookGlobalGCEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((GCBenchmark *)userData)->_globalCollections += 1;
+}
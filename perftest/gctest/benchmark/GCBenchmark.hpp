@@ -0,0 +1,185 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(GCBENCHMARK_HPP_)
+#define GCBENCHMARK_HPP_
+
+#include <stdio.h>
+#include <vector>
+
+#include "omr.h"
+#include "omrhookable.h"
+#include "omrExampleVM.hpp"
+
+class MM_CollectorLanguageInterface;
+class MM_GCExtensionsBase;
+
+/**
+ * Options for a benchmark run. A run either replays a recorded allocation trace (traceFile != NULL) or
+ * generates a fixed size object graph in the style of the GCConfigTest object tables and churns it.
+ * The generated workload is a deterministic function of these options, so two runs with the same
+ * options and the same OMR_GC_OPTIONS allocate the same objects in the same order.
+ */
+typedef struct GCBenchmarkOptions {
+	const char *name;				/**< name reported with the results */
+	const char *traceFile;			/**< allocation trace to replay, or NULL to generate the workload */
+	uintptr_t repeat;				/**< number of times the trace is replayed */
+	uintptr_t liveObjects;			/**< number of objects in the live tree */
+	uintptr_t objectSize;			/**< size in bytes of every generated object */
+	uintptr_t breadth;				/**< number of children of each interior node of the live tree */
+	uintptr_t window;				/**< number of short lived objects kept reachable at any time */
+	uintptr_t replaceRate;			/**< one in replaceRate allocations replaces a node of the live tree */
+	uintptr_t allocateMegabytes;	/**< total allocation volume of the generated workload */
+	uintptr_t seed;					/**< seed of the pseudo random sequence used by the generator */
+} GCBenchmarkOptions;
+
+/**
+ * A single mutator operation, either read from a trace or produced by the generator. Objects are
+ * identified by root slot; trace object ids are mapped to slots when the trace is loaded.
+ */
+typedef struct GCBenchmarkEvent {
+	char type;			/**< one of the GCBenchmark::EVENT_* characters */
+	uintptr_t line;		/**< trace line the event was read from, for error reporting */
+	uintptr_t slot;		/**< slot of the allocated, dropped or parent object */
+	uintptr_t value;	/**< size of an allocated object, or field index of a store */
+	uintptr_t child;	/**< slot of the stored object, or NO_SLOT to store NULL */
+} GCBenchmarkEvent;
+
+/**
+ * Drives the example VM with an allocation workload and measures collector throughput, stop-the-world
+ * pauses and memory footprint.
+ *
+ * Live objects are kept reachable from root slots held in a small number of holder objects, each
+ * registered in the example VM root table, so that the roots themselves live in the heap and stores
+ * into them go through the write barrier like any other old-to-young reference. All loads go through
+ * the read barrier.
+ *
+ * Pauses are measured from the exclusive access request to its release, using the GC private hooks,
+ * so time to safe point is included.
+ */
+class GCBenchmark
+{
+	/*
+	 * Data members
+	 */
+public:
+	static const char EVENT_ALLOCATE = 'a';
+	static const char EVENT_STORE = 's';
+	static const char EVENT_DROP = 'd';
+	static const char EVENT_COLLECT = 'g';
+	static const uintptr_t NO_SLOT = (uintptr_t)-1;
+
+private:
+	static const uintptr_t SLOTS_PER_HOLDER = 4096;
+
+	OMR_VM_Example *_exampleVM;
+	OMR_VMThread *_omrVMThread;
+	MM_GCExtensionsBase *_extensions;
+	MM_CollectorLanguageInterface *_cli;
+	GCBenchmarkOptions *_options;
+
+	uintptr_t _slotCount;
+	uintptr_t _holderCount;
+	char *_holderNames;
+	RootEntry **_holders;
+	std::vector<GCBenchmarkEvent> _trace;
+
+	/* mutator statistics */
+	uintptr_t _allocatedObjects;
+	uintptr_t _allocatedBytes;
+	uint64_t _startTime;
+	uint64_t _endTime;
+
+	/* collector statistics, updated from GC hooks */
+	std::vector<uint64_t> _pauses;
+	uint64_t _pauseStartTime;
+	uintptr_t _localCollections;
+	uintptr_t _globalCollections;
+	uintptr_t _peakHeapSize;
+	uintptr_t _peakHeapUsed;
+
+	/*
+	 * Function members
+	 */
+public:
+	/**
+	 * Prepare the run: load the trace (if any), size and allocate the root slot holders and hook the collector.
+	 * @return true on success, false if the trace could not be loaded or the holders could not be allocated
+	 */
+	bool initialize();
+	void tearDown();
+
+	/**
+	 * Execute the workload.
+	 * @return true if every event completed, false on the first failed allocation or invalid event
+	 */
+	bool run();
+
+	/**
+	 * Write the results of the run as a single line JSON object.
+	 */
+	void report(FILE *out);
+
+	GCBenchmark(OMR_VM_Example *exampleVM, OMR_VMThread *omrVMThread, GCBenchmarkOptions *options)
+		: _exampleVM(exampleVM)
+		, _omrVMThread(omrVMThread)
+		, _extensions(NULL)
+		, _cli(NULL)
+		, _options(options)
+		, _slotCount(0)
+		, _holderCount(0)
+		, _holderNames(NULL)
+		, _holders(NULL)
+		, _allocatedObjects(0)
+		, _allocatedBytes(0)
+		, _startTime(0)
+		, _endTime(0)
+		, _pauseStartTime(0)
+		, _localCollections(0)
+		, _globalCollections(0)
+		, _peakHeapSize(0)
+		, _peakHeapUsed(0)
+	{
+	}
+
+private:
+	bool loadTrace(const char *fileName);
+	bool allocateHolders();
+	void registerHooks();
+	void unregisterHooks();
+
+	bool replay(GCBenchmarkEvent *event);
+	bool generate();
+
+	omrobjectptr_t allocateObject(uintptr_t size);
+	bool allocateSlot(uintptr_t slot, uintptr_t size);
+	fomrobject_t *slotAddress(uintptr_t slot, omrobjectptr_t *holder);
+	omrobjectptr_t loadSlot(uintptr_t slot);
+	void storeSlot(uintptr_t slot, omrobjectptr_t object);
+	bool storeField(uintptr_t parentSlot, uintptr_t field, uintptr_t childSlot, uintptr_t line);
+
+	uint64_t percentile(std::vector<uint64_t> *sorted, uintptr_t percent);
+	uintptr_t peakResidentKilobytes();
+
+	static void hookExclusiveAccessAcquire(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	static void hookExclusiveAccessRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	static void hookLocalGCEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	static void hookGlobalGCEnd(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+};
+
+#endif /* GCBENCHMARK_HPP_ */
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdio.h>
+
+#include "StartupManagerBenchmark.hpp"
+#include "GCExtensionsBase.hpp"
+
+bool
+MM_StartupManagerBenchmark::parseLanguageOptions(MM_GCExtensionsBase *extensions)
+{
+	bool result = true;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (extensions->scavengerEnabled && (0 == extensions->maxNewSpaceSize)) {
+		if ((0 == _nurseryPercent) || (100 <= _nurseryPercent)) {
+			fprintf(stderr, "nurseryPercent must be between 1 and 99\n");
+			result = false;
+		} else {
+			extensions->maxNewSpaceSize = extensions->memoryMax / 100 * _nurseryPercent;
+			extensions->newSpaceSize = extensions->initialMemorySize / 100 * _nurseryPercent;
+			extensions->minNewSpaceSize = extensions->newSpaceSize;
+			extensions->maxOldSpaceSize = extensions->memoryMax - extensions->maxNewSpaceSize;
+			extensions->oldSpaceSize = extensions->initialMemorySize - extensions->newSpaceSize;
+			extensions->minOldSpaceSize = extensions->oldSpaceSize;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+	return result;
+}
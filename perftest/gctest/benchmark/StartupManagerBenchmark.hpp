@@ -0,0 +1,60 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(MM_STARTUPMANAGERBENCHMARK_HPP_)
+#define MM_STARTUPMANAGERBENCHMARK_HPP_
+
+#include "StartupManagerImpl.hpp"
+
+/**
+ * Startup manager of the GC benchmark. Collector options come from OMR_GC_OPTIONS as for the example VM;
+ * in addition, when -Xgcpolicy:gencon is given without explicit new space sizes, the heap is split so that
+ * new space takes nurseryPercent of it.
+ */
+class MM_StartupManagerBenchmark : public MM_StartupManagerImpl
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _nurseryPercent;
+protected:
+
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+	/**
+	 * Size new and old space once the GC options have been parsed.
+	 * @param extensions GCExtensions
+	 * @return true if the heap could be split, false otherwise
+	 */
+	virtual bool parseLanguageOptions(MM_GCExtensionsBase *extensions);
+
+public:
+	MM_StartupManagerBenchmark(OMR_VM *omrVM, uintptr_t nurseryPercent)
+		: MM_StartupManagerImpl(omrVM)
+		, _nurseryPercent(nurseryPercent)
+	{
+	}
+};
+
+#endif /* MM_STARTUPMANAGERBENCHMARK_HPP_ */
@@ -0,0 +1,211 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GCBenchmark.hpp"
+#include "omr.h"
+#include "omrExampleVM.hpp"
+#include "omrgcstartup.hpp"
+#include "omrport.h"
+#include "omrvm.h"
+#include "StartupManagerBenchmark.hpp"
+
+/*
+ * Usage: omrgcbenchmark [-trace=<file>] [-name=<name>] [-results=<file>]
+ *                       [-repeat=<n>] [-liveObjects=<n>] [-objectSize=<bytes>] [-breadth=<n>] [-window=<n>]
+ *                       [-replaceRate=<n>] [-allocateMB=<n>] [-seed=<n>] [-nurseryPercent=<n>]
+ *
+ * Collector options (policy, heap size, gc threads, ...) are taken from OMR_GC_OPTIONS, as for any other
+ * example VM. With -Xgcpolicy:gencon, new space takes nurseryPercent (default 25) of the heap.
+ * Results are written as one JSON object per run to stdout, or appended to the results file.
+ */
+
+static bool
+parseNumber(const char *arg, const char *option, uintptr_t *value)
+{
+	size_t length = strlen(option);
+	if ((0 == strncmp(arg, option, length)) && ('=' == arg[length])) {
+		*value = (uintptr_t)strtoull(arg + length + 1, NULL, 10);
+		return true;
+	}
+	return false;
+}
+
+static bool
+parseString(const char *arg, const char *option, const char **value)
+{
+	size_t length = strlen(option);
+	if ((0 == strncmp(arg, option, length)) && ('=' == arg[length])) {
+		*value = arg + length + 1;
+		return true;
+	}
+	return false;
+}
+
+static int
+runBenchmark(OMR_VM_Example *exampleVM, GCBenchmarkOptions *options, const char *resultsFile)
+{
+	int result = 1;
+	if (J9THREAD_RWMUTEX_OK != omrthread_rwmutex_init(&exampleVM->_vmAccessMutex, 0, "VM exclusive access")) {
+		fprintf(stderr, "Failed to initialize the VM access mutex\n");
+	} else {
+		exampleVM->rootTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				rootTableHashFn, rootTableHashEqualFn, NULL, NULL);
+		exampleVM->objectTable = hashTableNew(
+				exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(ObjectEntry), 0, 0, OMRMEM_CATEGORY_MM,
+				objectTableHashFn, objectTableHashEqualFn, NULL, NULL);
+
+		if ((NULL == exampleVM->rootTable) || (NULL == exampleVM->objectTable)) {
+			fprintf(stderr, "Failed to allocate the root and object tables\n");
+		} else {
+			GCBenchmark benchmark(exampleVM, exampleVM->_omrVMThread, options);
+			if (benchmark.initialize() && benchmark.run()) {
+				FILE *out = stdout;
+				if (NULL != resultsFile) {
+					out = fopen(resultsFile, "a");
+				}
+				if (NULL == out) {
+					fprintf(stderr, "Failed to open results file %s\n", resultsFile);
+				} else {
+					benchmark.report(out);
+					if (stdout != out) {
+						fclose(out);
+					}
+					result = 0;
+				}
+			}
+			benchmark.tearDown();
+		}
+
+		if (NULL != exampleVM->objectTable) {
+			hashTableForEachDo(exampleVM->objectTable, objectTableFreeFn, exampleVM);
+			hashTableFree(exampleVM->objectTable);
+			exampleVM->objectTable = NULL;
+		}
+		if (NULL != exampleVM->rootTable) {
+			hashTableFree(exampleVM->rootTable);
+			exampleVM->rootTable = NULL;
+		}
+		omrthread_rwmutex_destroy(exampleVM->_vmAccessMutex);
+		exampleVM->_vmAccessMutex = NULL;
+	}
+	return result;
+}
+
+extern "C" {
+
+int
+testMain(int argc, char **argv, char **envp)
+{
+	GCBenchmarkOptions options;
+	options.name = NULL;
+	options.traceFile = NULL;
+	options.repeat = 1;
+	options.liveObjects = 8192;
+	options.objectSize = 64;
+	options.breadth = 4;
+	options.window = 64;
+	options.replaceRate = 16;
+	options.allocateMegabytes = 64;
+	options.seed = 1;
+	uintptr_t nurseryPercent = 25;
+	const char *resultsFile = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		const char *arg = argv[i];
+		if (!(parseString(arg, "-trace", &options.traceFile)
+			|| parseString(arg, "-name", &options.name)
+			|| parseString(arg, "-results", &resultsFile)
+			|| parseNumber(arg, "-repeat", &options.repeat)
+			|| parseNumber(arg, "-liveObjects", &options.liveObjects)
+			|| parseNumber(arg, "-objectSize", &options.objectSize)
+			|| parseNumber(arg, "-breadth", &options.breadth)
+			|| parseNumber(arg, "-window", &options.window)
+			|| parseNumber(arg, "-replaceRate", &options.replaceRate)
+			|| parseNumber(arg, "-allocateMB", &options.allocateMegabytes)
+			|| parseNumber(arg, "-seed", &options.seed)
+			|| parseNumber(arg, "-nurseryPercent", &nurseryPercent))
+		) {
+			fprintf(stderr, "Unrecognized option %s\n", arg);
+			return 1;
+		}
+	}
+	if (NULL == options.name) {
+		options.name = (NULL != options.traceFile) ? options.traceFile : "generated";
+	}
+
+	OMR_VM_Example exampleVM;
+	exampleVM._omrVM = NULL;
+	exampleVM._omrVMThread = NULL;
+	exampleVM.rootTable = NULL;
+	exampleVM.objectTable = NULL;
+	exampleVM.self = NULL;
+	exampleVM._vmAccessMutex = NULL;
+	exampleVM._vmExclusiveAccessCount = 0;
+
+	/* Attach the main thread, as the collector is started outside of OMR_Initialize */
+	if (0 != omrthread_attach_ex(&exampleVM.self, J9THREAD_ATTR_DEFAULT)) {
+		fprintf(stderr, "omrthread_attach failed\n");
+		return 1;
+	}
+
+	/* Initialize the VM without the collector, which is started below with the benchmark startup manager */
+	omr_error_t rc = OMR_Initialize(&exampleVM, &exampleVM._omrVM);
+	if (OMR_ERROR_NONE != rc) {
+		fprintf(stderr, "OMR_Initialize failed, rc=%d\n", (int)rc);
+		return 1;
+	}
+
+	int result = 1;
+	{
+		/* The startup manager frees its options with the port library, so it must go before OMR_Shutdown */
+		MM_StartupManagerBenchmark startupManager(exampleVM._omrVM, nurseryPercent);
+		rc = OMR_GC_IntializeHeapAndCollector(exampleVM._omrVM, &startupManager);
+	}
+	if (OMR_ERROR_NONE != rc) {
+		fprintf(stderr, "OMR_GC_IntializeHeapAndCollector failed, rc=%d\n", (int)rc);
+	} else {
+		rc = OMR_Thread_Init(exampleVM._omrVM, NULL, &exampleVM._omrVMThread, "GCBenchmarkThread");
+		if (OMR_ERROR_NONE != rc) {
+			fprintf(stderr, "OMR_Thread_Init failed, rc=%d\n", (int)rc);
+		} else {
+			rc = OMR_GC_InitializeDispatcherThreads(exampleVM._omrVMThread);
+			if (OMR_ERROR_NONE != rc) {
+				fprintf(stderr, "OMR_GC_InitializeDispatcherThreads failed, rc=%d\n", (int)rc);
+			} else {
+				result = runBenchmark(&exampleVM, &options, resultsFile);
+				OMR_GC_ShutdownDispatcherThreads(exampleVM._omrVMThread);
+			}
+			OMR_GC_ShutdownCollector(exampleVM._omrVMThread);
+			OMR_Thread_Free(exampleVM._omrVMThread);
+			exampleVM._omrVMThread = NULL;
+		}
+		OMR_GC_ShutdownHeap(exampleVM._omrVM);
+	}
+
+	/* This destroys the port library and the omrthread library */
+	OMR_Shutdown(exampleVM._omrVM);
+
+	return result;
+}
+
+}
@@ -42,4 +42,11 @@ omr_perfgctest:
 	./omrgctest -configListFile=perftest/gctest/configuration/perfConfigListFile.txt -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+# Each run appends one JSON line of results to omrgcbenchmark.json
+omr_perfgcbenchmark:
+	OMR_GC_OPTIONS="-Xms64m -Xmx64m" ./omrgcbenchmark -allocateMB=512 -name=graph_flat -results=omrgcbenchmark.json
+	OMR_GC_OPTIONS="-Xgcpolicy:gencon -Xms64m -Xmx64m" ./omrgcbenchmark -nurseryPercent=25 -allocateMB=512 -name=graph_gencon -results=omrgcbenchmark.json
+	OMR_GC_OPTIONS="-Xms64m -Xmx64m" ./omrgcbenchmark -trace=perftest/gctest/configuration/sampleServer.trace -repeat=200 -name=sampleServer_flat -results=omrgcbenchmark.json
+	OMR_GC_OPTIONS="-Xgcpolicy:gencon -Xms64m -Xmx64m" ./omrgcbenchmark -nurseryPercent=25 -trace=perftest/gctest/configuration/sampleServer.trace -repeat=200 -name=sampleServer_gencon -results=omrgcbenchmark.json
+
+.PHONY: all test omr_perfgctest omr_perfgcbenchmark 
@@ -368,3 +368,45 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 {
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
+
+/**
+* Move the pages backing a range of committed memory to another range of the same reservation, without
+* copying their contents. Once moved, the target range holds the contents the source range had, and the
+* source range remains committed but is filled with zeros.
+*
+* Both ranges must be committed, must not overlap and must lie within the memory described by the identifier.
+* The addresses and byteAmount must be multiples of the page size of the identifier. Callers are expected to
+* fall back to copying the memory if the move is not supported or failed. The one exception is
+* OMRPORT_ERROR_VMEM_REMAP_SOURCE_UNMAPPED: the contents did move to the target, but the source range is
+* left unmapped, and accessing it faults.
+*
+* @param portLibrary The port library.
+* @param source The page aligned starting address of the memory to move.
+* @param target The page aligned starting address the memory is moved to.
+* @param byteAmount The number of bytes to move (must be a multiple of page size).
+* @param identifier Descriptor for virtual memory block.
+*
+* @return 0 on success, OMRPORT_ERROR_VMEM_INVALID_PARAMS if the ranges are not valid, OMRPORT_ERROR_VMEM_OPFAILED
+* if an error occurred and nothing was moved, OMRPORT_ERROR_VMEM_REMAP_SOURCE_UNMAPPED if the contents were moved
+* but the source range could not be mapped again, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+*/
+intptr_t
+omrvmem_remap_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+/**
+* Get the size of the transparent huge pages which the OS backs memory reserved with
+* OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES with. Memory which is to be backed by them should be
+* aligned to, and committed and decommitted in multiples of, this size.
+*
+* @param portLibrary The port library.
+*
+* @return the size in bytes, or 0 if transparent huge pages are not supported or can not be requested.
+*/
+uintptr_t
+omrvmem_get_transparent_huge_page_size(struct OMRPortLibrary *portLibrary)
+{
+	return 0;
+}
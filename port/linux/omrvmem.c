@@ -68,6 +68,9 @@
 #define VMEM_MEMINFO_SIZE_MAX	2048
 #define VMEM_PROC_MEMINFO_FNAME	"/proc/meminfo"
 #define VMEM_PROC_MAPS_FNAME	"/proc/self/maps"
+#define VMEM_THP_ENABLED_FNAME	"/sys/kernel/mm/transparent_hugepage/enabled"
+#define VMEM_THP_PAGE_SIZE_FNAME	"/sys/kernel/mm/transparent_hugepage/hpage_pmd_size"
+#define VMEM_THP_SIZE_MAX	128
 
 typedef struct vmem_hugepage_info_t {
 	uintptr_t	enabled; /*!< boolean enabling j9 large page support */
@@ -102,6 +105,7 @@ static void port_numa_interleave_memory(struct OMRPortLibrary *portLibrary, void
 #endif /* OMR_PORT_NUMA_SUPPORT */
 void update_vmemIdentifier(J9PortVmemIdentifier *identifier, void *address, void *handle, uintptr_t byteAmount, uintptr_t mode, uintptr_t pageSize, uintptr_t pageFlags, uintptr_t allocator, OMRMemCategory *category);
 static uintptr_t get_hugepages_info(struct OMRPortLibrary *portLibrary, vmem_hugepage_info_t *page_info);
+static uintptr_t get_transparent_hugepage_size(struct OMRPortLibrary *portLibrary, vmem_hugepage_info_t *page_info);
 int get_protectionBits(uintptr_t mode);
 
 #if defined(OMR_PORT_NUMA_SUPPORT)
@@ -512,6 +516,9 @@ omrvmem_startup(struct OMRPortLibrary *portLibrary)
 		PPG_vmem_pageFlags[1] = OMRPORT_VMEM_PAGE_FLAG_NOT_USED;
 	}
 
+	PPG_vmem_transparentHugePageSize = get_transparent_hugepage_size(portLibrary, &vmem_page_info);
+	Trc_PRT_vmem_transparent_huge_page_size(PPG_vmem_transparentHugePageSize);
+
 #if defined(OMR_PORT_NUMA_SUPPORT)
 	if (0 == initializeNumaGlobals(portLibrary)) {
 		PPG_numa_platform_supports_numa = 1;
@@ -546,6 +553,15 @@ omrvmem_commit_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr
 				fflush(stdout);
 #endif
 				rc = address;
+#if defined(MADV_HUGEPAGE)
+				if ((0 != (identifier->mode & OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES)) && (0 != PPG_vmem_transparentHugePageSize)) {
+					/* the advice is only a hint, so the memory is still committed if it is not taken, but the mode no longer claims it */
+					if (0 != madvise(address, (size_t)byteAmount, MADV_HUGEPAGE)) {
+						Trc_PRT_vmem_omrvmem_commit_memory_madvise_failure(errno, address, byteAmount);
+						identifier->mode &= ~(uintptr_t)OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES;
+					}
+				}
+#endif /* defined(MADV_HUGEPAGE) */
 			} else {
 				Trc_PRT_vmem_omrvmem_commit_memory_mprotect_failure(errno);
 				portLibrary->error_set_last_error(portLibrary,  errno, OMRPORT_ERROR_VMEM_OPFAILED);
@@ -578,6 +594,24 @@ omrvmem_decommit_memory(struct OMRPortLibrary *portLibrary, void *address, uintp
 			ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(address, identifier->pageSize);
 			ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(byteAmount, identifier->pageSize);
 
+			if ((byteAmount > 0)
+				&& (0 != (identifier->mode & OMRPORT_VMEM_MEMORY_MODE_TRANSPARENT_HUGE_PAGES))
+				&& (0 != PPG_vmem_transparentHugePageSize)
+			) {
+				/* Releasing part of a huge page makes the OS split it into small pages, so only release whole huge pages */
+				uintptr_t hugePageSize = PPG_vmem_transparentHugePageSize;
+				uintptr_t base = ((uintptr_t)address + hugePageSize - 1) & ~(hugePageSize - 1);
+				uintptr_t top = ((uintptr_t)address + byteAmount) & ~(hugePageSize - 1);
+
+				if (base < top) {
+					address = (void *)base;
+					byteAmount = top - base;
+				} else {
+					Trc_PRT_vmem_decommit_memory_within_huge_page(address, byteAmount, hugePageSize);
+					byteAmount = 0;
+				}
+			}
+
 			if (byteAmount > 0) {
 				if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP) {
 					result  = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
@@ -894,6 +928,64 @@ get_hugepages_info(struct OMRPortLibrary *portLibrary, vmem_hugepage_info_t *pag
 
 	return 1;
 }
+/**
+ * @internal
+ * Determine the size of the transparent huge pages which memory can be advised to use.
+ *
+ * @param[in] portLibrary The port library
+ * @param[in] page_info The hugetlbfs page info, whose page size is used if the kernel does not report the transparent huge page size
+ *
+ * @return the size in bytes, or 0 if transparent huge pages are disabled or not supported
+ */
+static uintptr_t
+get_transparent_hugepage_size(struct OMRPortLibrary *portLibrary, vmem_hugepage_info_t *page_info)
+{
+	uintptr_t pageSize = 0;
+#if defined(MADV_HUGEPAGE)
+	char read_buf[VMEM_THP_SIZE_MAX];
+	int bytes_read = 0;
+	int fd = omrfile_open(portLibrary, VMEM_THP_ENABLED_FNAME, EsOpenRead, 0);
+
+	if (fd < 0) {
+		return 0;
+	}
+	bytes_read = omrfile_read(portLibrary, fd, read_buf, VMEM_THP_SIZE_MAX - 1);
+	omrfile_close(portLibrary, fd);
+	if (bytes_read <= 0) {
+		return 0;
+	}
+	read_buf[bytes_read] = 0;
+
+	/* the selected mode is bracketed, e.g. "always [madvise] never" */
+	if (NULL != strstr(read_buf, "[never]")) {
+		return 0;
+	}
+
+	fd = omrfile_open(portLibrary, VMEM_THP_PAGE_SIZE_FNAME, EsOpenRead, 0);
+	if (fd >= 0) {
+		bytes_read = omrfile_read(portLibrary, fd, read_buf, VMEM_THP_SIZE_MAX - 1);
+		omrfile_close(portLibrary, fd);
+		if (bytes_read > 0) {
+			read_buf[bytes_read] = 0;
+			if (1 != sscanf(read_buf, "%" SCNuPTR, &pageSize)) {
+				pageSize = 0;
+			}
+		}
+	}
+
+	if (0 == pageSize) {
+		/* older kernels do not report it, but it is the PMD size which is also the default hugetlbfs page size */
+		pageSize = page_info->page_size;
+	}
+
+	/* a huge page must be a power of two multiple of the default page size */
+	if ((pageSize <= PPG_vmem_pageSize[0]) || (0 != (pageSize & (pageSize - 1)))) {
+		pageSize = 0;
+	}
+#endif /* defined(MADV_HUGEPAGE) */
+	return pageSize;
+}
+
 void *
 default_pageSize_reserve_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t mode, uintptr_t pageSize, OMRMemCategory *category)
 {
@@ -1671,3 +1763,52 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	Trc_PRT_vmem_get_process_memory_exit(result, *memorySize);
 	return result;
 }
+
+intptr_t
+omrvmem_remap_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	intptr_t result = 0;
+
+	Trc_PRT_vmem_omrvmem_remap_memory_Entry(source, target, byteAmount);
+
+	if (!rangeIsValid(identifier, source, byteAmount) || !rangeIsValid(identifier, target, byteAmount)
+		|| (((uintptr_t)source < ((uintptr_t)target + byteAmount)) && ((uintptr_t)target < ((uintptr_t)source + byteAmount)))
+	) {
+		result = OMRPORT_ERROR_VMEM_INVALID_PARAMS;
+	} else if (OMRPORT_VMEM_RESERVE_USED_MMAP != identifier->allocator) {
+		/* pages of shared memory segments can not be remapped */
+		result = OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+	} else if (byteAmount > 0) {
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(source, identifier->pageSize);
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(target, identifier->pageSize);
+		ASSERT_VALUE_IS_PAGE_SIZE_ALIGNED(byteAmount, identifier->pageSize);
+
+		void *moved = MAP_FAILED;
+#if defined(MREMAP_DONTUNMAP)
+		/* Where the kernel supports it, the source range keeps its mapping, now backed by zero pages, in the same call */
+		moved = mremap(source, (size_t)byteAmount, (size_t)byteAmount, MREMAP_MAYMOVE | MREMAP_FIXED | MREMAP_DONTUNMAP, target);
+#endif /* defined(MREMAP_DONTUNMAP) */
+		if (MAP_FAILED == moved) {
+			/* mremap() replaces the target mapping and leaves the source range unmapped, so map fresh
+			 * committed pages back in behind it to keep the reservation intact.
+			 */
+			if (MAP_FAILED == mremap(source, (size_t)byteAmount, (size_t)byteAmount, MREMAP_MAYMOVE | MREMAP_FIXED, target)) {
+				Trc_PRT_vmem_omrvmem_remap_memory_failure(errno, source, target, byteAmount);
+				result = OMRPORT_ERROR_VMEM_OPFAILED;
+			} else if (MAP_FAILED == mmap(source, (size_t)byteAmount, get_protectionBits(identifier->mode), MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0)) {
+				/* the contents have moved, so the caller must not copy them, but the source range is gone */
+				Trc_PRT_vmem_omrvmem_remap_memory_failure(errno, source, target, byteAmount);
+				result = OMRPORT_ERROR_VMEM_REMAP_SOURCE_UNMAPPED;
+			}
+		}
+	}
+
+	Trc_PRT_vmem_omrvmem_remap_memory_Exit(result);
+	return result;
+}
+
+uintptr_t
+omrvmem_get_transparent_huge_page_size(struct OMRPortLibrary *portLibrary)
+{
+	return PPG_vmem_transparentHugePageSize;
+}
@@ -645,6 +645,10 @@ extern J9_CFUNC int32_t
 omrvmem_get_available_physical_memory(struct OMRPortLibrary *portLibrary, uint64_t *freePhysicalMemorySize);
 extern J9_CFUNC int32_t
 omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize);
+extern J9_CFUNC intptr_t
+omrvmem_remap_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier);
+extern J9_CFUNC uintptr_t
+omrvmem_get_transparent_huge_page_size(struct OMRPortLibrary *portLibrary);
 
 /* J9SourcePort*/
 extern J9_CFUNC int32_t
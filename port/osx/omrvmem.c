@@ -779,3 +779,15 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	Trc_PRT_vmem_get_process_memory_exit(result, *memorySize);
 	return result;
 }
+
+intptr_t
+omrvmem_remap_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+uintptr_t
+omrvmem_get_transparent_huge_page_size(struct OMRPortLibrary *portLibrary)
+{
+	return 0;
+}
@@ -62,6 +62,9 @@ typedef struct OMRPortPlatformGlobals {
 	char *si_osVersion;
 	uintptr_t vmem_pageSize[OMRPORT_VMEM_PAGESIZE_COUNT]; /** <0 terminated array of supported page sizes */
 	uintptr_t vmem_pageFlags[OMRPORT_VMEM_PAGESIZE_COUNT]; /** <0 terminated array of flags describing type of the supported page sizes */
+#if defined(LINUX)
+	uintptr_t vmem_transparentHugePageSize; /** <size of a transparent huge page, 0 if they can not be requested by madvise */
+#endif
 #if defined(LINUX) && defined(S390)
 	int64_t last_clock_delta_update;  /** hw clock microsecond timestamp of last clock delta adjustment */
 	int64_t software_msec_clock_delta; /** signed difference between hw and sw clocks in milliseconds */
@@ -94,6 +97,9 @@ typedef struct OMRPortPlatformGlobals {
 #define PPG_si_osVersion (portLibrary->portGlobals->platformGlobals.si_osVersion)
 #define PPG_vmem_pageSize (portLibrary->portGlobals->platformGlobals.vmem_pageSize)
 #define PPG_vmem_pageFlags (portLibrary->portGlobals->platformGlobals.vmem_pageFlags)
+#if defined(LINUX)
+#define PPG_vmem_transparentHugePageSize (portLibrary->portGlobals->platformGlobals.vmem_transparentHugePageSize)
+#endif
 #if defined(LINUX) && defined(S390)
 #define PPG_last_clock_delta_update  (portLibrary->portGlobals->platformGlobals.last_clock_delta_update)
 #define PPG_software_msec_clock_delta (portLibrary->portGlobals->platformGlobals.software_msec_clock_delta)
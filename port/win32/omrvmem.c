@@ -1343,6 +1343,18 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return result;
 }
 
+intptr_t
+omrvmem_remap_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+uintptr_t
+omrvmem_get_transparent_huge_page_size(struct OMRPortLibrary *portLibrary)
+{
+	return 0;
+}
+
 static int32_t
 getProcessPrivateMemorySize(struct OMRPortLibrary *portLibrary, J9VMemMemoryQuery queryType, uint64_t *memorySize)
 {
@@ -1569,6 +1569,18 @@ omrvmem_get_process_memory_size(struct OMRPortLibrary *portLibrary, J9VMemMemory
 	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
 }
 
+intptr_t
+omrvmem_remap_memory(struct OMRPortLibrary *portLibrary, void *source, void *target, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier)
+{
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+}
+
+uintptr_t
+omrvmem_get_transparent_huge_page_size(struct OMRPortLibrary *portLibrary)
+{
+	return 0;
+}
+
 #if defined(OMR_ENV_DATA64)
 static BOOLEAN
 isRmode64Supported()
@@ -0,0 +1,741 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "VerboseGCDecoder.hpp"
+#include "VerboseBinaryFormat.hpp"
+
+/* ids above this are taken to be corruption rather than allocated */
+#define MAXIMUM_TABLE_ID (1 << 20)
+/* longest conversion specification rebuilt for snprintf */
+#define MAXIMUM_SPEC_LENGTH 64
+
+#define CSV_HEADER "record,depth,element,attribute,value\n"
+
+enum {
+	VARINT_INCOMPLETE = 0,
+	VARINT_OK,
+	VARINT_MALFORMED
+};
+
+static int
+readVarint(const uint8_t **cursor, const uint8_t *end, uint64_t *value)
+{
+	uint64_t result = 0;
+	unsigned int shift = 0;
+	const uint8_t *position = *cursor;
+
+	while (position < end) {
+		uint8_t byte = *position++;
+		result |= (uint64_t)(byte & 0x7F) << shift;
+		if (0 == (byte & 0x80)) {
+			*cursor = position;
+			*value = result;
+			return VARINT_OK;
+		}
+		shift += 7;
+		if (shift >= (7 * VERBOSE_BINARY_VARINT_MAXIMUM)) {
+			return VARINT_MALFORMED;
+		}
+	}
+	return VARINT_INCOMPLETE;
+}
+
+static int
+readSignedVarint(const uint8_t **cursor, const uint8_t *end, int64_t *value)
+{
+	uint64_t encoded = 0;
+	int rc = readVarint(cursor, end, &encoded);
+	*value = (int64_t)(encoded >> 1) ^ -(int64_t)(encoded & 1);
+	return rc;
+}
+
+static bool
+isSpace(char c)
+{
+	return (' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c);
+}
+
+VerboseGCDecoder::VerboseGCDecoder(OutputMode mode, OutputFunction output, void *userData)
+	: _mode(mode)
+	, _output(output)
+	, _userData(userData)
+	, _result(RESULT_OK)
+	, _preambleSeen(false)
+	, _pointerSize(sizeof(void *))
+	, _element(0)
+	, _depth(0)
+	, _csvHeaderWritten(false)
+{
+	Buffer empty = { NULL, 0, 0 };
+	Table emptyTable = { NULL, 0 };
+
+	_pending = empty;
+	_line = empty;
+	_argument = empty;
+	_markup = empty;
+	_row = empty;
+	_value = empty;
+	_formats = emptyTable;
+	_strings = emptyTable;
+}
+
+VerboseGCDecoder::~VerboseGCDecoder()
+{
+	Table *tables[] = { &_formats, &_strings };
+	for (size_t t = 0; t < sizeof(tables) / sizeof(tables[0]); t++) {
+		for (size_t i = 0; i < tables[t]->count; i++) {
+			free(tables[t]->entries[i]);
+		}
+		free(tables[t]->entries);
+	}
+
+	free(_pending.bytes);
+	free(_line.bytes);
+	free(_argument.bytes);
+	free(_markup.bytes);
+	free(_row.bytes);
+	free(_value.bytes);
+}
+
+const char *
+VerboseGCDecoder::describe(Result result)
+{
+	switch (result) {
+	case RESULT_OK:
+		return "success";
+	case RESULT_BAD_MAGIC:
+		return "input is not a binary verbose GC log";
+	case RESULT_BAD_VERSION:
+		return "unsupported binary verbose GC log version";
+	case RESULT_BAD_RECORD:
+		return "malformed record";
+	case RESULT_TRUNCATED:
+		return "input ends in the middle of a record";
+	case RESULT_NO_MEMORY:
+		return "out of memory";
+	case RESULT_OUTPUT_FAILED:
+		return "failed to write output";
+	}
+	return "unknown error";
+}
+
+bool
+VerboseGCDecoder::reserve(Buffer *buffer, size_t spaceNeeded)
+{
+	if ((buffer->capacity - buffer->length) < spaceNeeded) {
+		size_t newCapacity = buffer->length + spaceNeeded;
+		newCapacity += newCapacity / 2;
+		char *newBytes = (char *)realloc(buffer->bytes, newCapacity);
+		if (NULL == newBytes) {
+			return false;
+		}
+		buffer->bytes = newBytes;
+		buffer->capacity = newCapacity;
+	}
+	return true;
+}
+
+bool
+VerboseGCDecoder::append(Buffer *buffer, const char *bytes, size_t length)
+{
+	if (!reserve(buffer, length)) {
+		return false;
+	}
+	if (0 != length) {
+		memcpy(buffer->bytes + buffer->length, bytes, length);
+		buffer->length += length;
+	}
+	return true;
+}
+
+bool
+VerboseGCDecoder::appendFormatted(Buffer *buffer, const char *spec, ...)
+{
+	va_list args;
+
+	va_start(args, spec);
+	int length = vsnprintf(NULL, 0, spec, args);
+	va_end(args);
+	if ((length < 0) || !reserve(buffer, (size_t)length + 1)) {
+		return false;
+	}
+
+	va_start(args, spec);
+	vsnprintf(buffer->bytes + buffer->length, (size_t)length + 1, spec, args);
+	va_end(args);
+	buffer->length += (size_t)length;
+	return true;
+}
+
+VerboseGCDecoder::Result
+VerboseGCDecoder::define(Table *table, uint64_t id, const uint8_t *bytes, size_t length)
+{
+	if (id >= MAXIMUM_TABLE_ID) {
+		return RESULT_BAD_RECORD;
+	}
+
+	if (id >= table->count) {
+		size_t newCount = (size_t)id + 1;
+		char **newEntries = (char **)realloc(table->entries, newCount * sizeof(char *));
+		if (NULL == newEntries) {
+			return RESULT_NO_MEMORY;
+		}
+		memset(newEntries + table->count, 0, (newCount - table->count) * sizeof(char *));
+		table->entries = newEntries;
+		table->count = newCount;
+	}
+
+	char *entry = (char *)malloc(length + 1);
+	if (NULL == entry) {
+		return RESULT_NO_MEMORY;
+	}
+	memcpy(entry, bytes, length);
+	entry[length] = '\0';
+	free(table->entries[id]);
+	table->entries[id] = entry;
+	return RESULT_OK;
+}
+
+VerboseGCDecoder::Result
+VerboseGCDecoder::decode(const uint8_t *bytes, size_t length)
+{
+	if (RESULT_OK != _result) {
+		return _result;
+	}
+	if (!append(&_pending, (const char *)bytes, length)) {
+		return _result = RESULT_NO_MEMORY;
+	}
+	if (0 == _pending.length) {
+		return RESULT_OK;
+	}
+
+	const uint8_t *data = (const uint8_t *)_pending.bytes;
+	const uint8_t *end = data + _pending.length;
+	const uint8_t *consumed = data;
+
+	if (!_preambleSeen) {
+		size_t available = _pending.length;
+		size_t magicAvailable = (available < VERBOSE_BINARY_MAGIC_LENGTH) ? available : VERBOSE_BINARY_MAGIC_LENGTH;
+		if (0 != memcmp(data, VERBOSE_BINARY_MAGIC, magicAvailable)) {
+			return _result = RESULT_BAD_MAGIC;
+		}
+		if (available < VERBOSE_BINARY_PREAMBLE_LENGTH) {
+			return RESULT_OK;
+		}
+		if (VERBOSE_BINARY_VERSION != data[VERBOSE_BINARY_MAGIC_LENGTH]) {
+			return _result = RESULT_BAD_VERSION;
+		}
+		_pointerSize = data[VERBOSE_BINARY_MAGIC_LENGTH + 1];
+		_preambleSeen = true;
+		consumed += VERBOSE_BINARY_PREAMBLE_LENGTH;
+	}
+
+	while (consumed < end) {
+		const uint8_t *cursor = consumed;
+		uint64_t bodyLength = 0;
+		int rc = readVarint(&cursor, end, &bodyLength);
+		if (VARINT_MALFORMED == rc) {
+			return _result = RESULT_BAD_RECORD;
+		}
+		if ((VARINT_INCOMPLETE == rc) || (bodyLength > (uint64_t)(end - cursor))) {
+			break;
+		}
+		Result result = decodeRecord(cursor, (size_t)bodyLength);
+		if (RESULT_OK != result) {
+			return _result = result;
+		}
+		consumed = cursor + bodyLength;
+	}
+
+	_pending.length = end - consumed;
+	memmove(_pending.bytes, consumed, _pending.length);
+	return RESULT_OK;
+}
+
+VerboseGCDecoder::Result
+VerboseGCDecoder::finish()
+{
+	if ((RESULT_OK == _result) && (!_preambleSeen || (0 != _pending.length))) {
+		_result = RESULT_TRUNCATED;
+	}
+	return _result;
+}
+
+VerboseGCDecoder::Result
+VerboseGCDecoder::decodeRecord(const uint8_t *body, size_t length)
+{
+	if (0 == length) {
+		return RESULT_BAD_RECORD;
+	}
+
+	const uint8_t *cursor = body + 1;
+	const uint8_t *end = body + length;
+	uint64_t id = 0;
+
+	switch (body[0]) {
+	case VERBOSE_BINARY_RECORD_TEXT:
+		return emit((const char *)cursor, end - cursor);
+	case VERBOSE_BINARY_RECORD_FORMAT:
+		if (VARINT_OK != readVarint(&cursor, end, &id)) {
+			return RESULT_BAD_RECORD;
+		}
+		return define(&_formats, id, cursor, end - cursor);
+	case VERBOSE_BINARY_RECORD_STRING:
+		if (VARINT_OK != readVarint(&cursor, end, &id)) {
+			return RESULT_BAD_RECORD;
+		}
+		return define(&_strings, id, cursor, end - cursor);
+	case VERBOSE_BINARY_RECORD_LINE:
+		return decodeLine(cursor, end);
+	default:
+		return RESULT_BAD_RECORD;
+	}
+}
+
+/**
+ * Rebuild a line by applying its format to its values. Each conversion is passed to snprintf with the
+ * flags, width and precision of the original, and the length modifier matching the decoded value.
+ */
+VerboseGCDecoder::Result
+VerboseGCDecoder::decodeLine(const uint8_t *cursor, const uint8_t *end)
+{
+	uint64_t formatId = 0;
+	uint64_t indent = 0;
+
+	if ((VARINT_OK != readVarint(&cursor, end, &formatId)) || (VARINT_OK != readVarint(&cursor, end, &indent))) {
+		return RESULT_BAD_RECORD;
+	}
+	if ((formatId >= _formats.count) || (NULL == _formats.entries[formatId])) {
+		return RESULT_BAD_RECORD;
+	}
+
+	_line.length = 0;
+	for (uint64_t i = 0; i < indent; i++) {
+		if (!append(&_line, VERBOSE_BINARY_INDENT, sizeof(VERBOSE_BINARY_INDENT) - 1)) {
+			return RESULT_NO_MEMORY;
+		}
+	}
+
+	const char *format = _formats.entries[formatId];
+	while ('\0' != *format) {
+		const char *literal = format;
+		while (('\0' != *format) && ('%' != *format)) {
+			format += 1;
+		}
+		if (!append(&_line, literal, format - literal)) {
+			return RESULT_NO_MEMORY;
+		}
+		if ('\0' == *format) {
+			break;
+		}
+
+		format += 1;
+		if ('%' == *format) {
+			format += 1;
+			if (!append(&_line, "%", 1)) {
+				return RESULT_NO_MEMORY;
+			}
+			continue;
+		}
+
+		char spec[MAXIMUM_SPEC_LENGTH];
+		size_t specLength = 0;
+		spec[specLength++] = '%';
+		while (('\0' != *format) && (NULL != strchr("-+ #0", *format)) && (specLength < (MAXIMUM_SPEC_LENGTH / 4))) {
+			spec[specLength++] = *format++;
+		}
+		for (int part = 0; part < 2; part++) {
+			if (1 == part) {
+				if ('.' != *format) {
+					break;
+				}
+				spec[specLength++] = *format++;
+			}
+			if ('*' == *format) {
+				int64_t value = 0;
+				if (VARINT_OK != readSignedVarint(&cursor, end, &value)) {
+					return RESULT_BAD_RECORD;
+				}
+				specLength += snprintf(spec + specLength, MAXIMUM_SPEC_LENGTH / 4, "%d", (int)value);
+				format += 1;
+			} else {
+				while (('0' <= *format) && ('9' >= *format)) {
+					if (specLength >= (MAXIMUM_SPEC_LENGTH / 2)) {
+						return RESULT_BAD_RECORD;
+					}
+					spec[specLength++] = *format++;
+				}
+			}
+		}
+		while (('\0' != *format) && (NULL != strchr("hlzjtLq", *format))) {
+			format += 1;
+		}
+
+		char conversion = *format;
+		if ('\0' == conversion) {
+			return RESULT_BAD_RECORD;
+		}
+		format += 1;
+
+		bool appended = true;
+		switch (conversion) {
+		case 'd':
+		case 'i':
+		case 'c':
+		{
+			int64_t value = 0;
+			if (VARINT_OK != readSignedVarint(&cursor, end, &value)) {
+				return RESULT_BAD_RECORD;
+			}
+			if ('c' == conversion) {
+				strcpy(spec + specLength, "c");
+				appended = appendFormatted(&_line, spec, (int)value);
+			} else {
+				spec[specLength++] = 'l';
+				spec[specLength++] = 'l';
+				spec[specLength++] = conversion;
+				spec[specLength] = '\0';
+				appended = appendFormatted(&_line, spec, (long long)value);
+			}
+			break;
+		}
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+		{
+			uint64_t value = 0;
+			if (VARINT_OK != readVarint(&cursor, end, &value)) {
+				return RESULT_BAD_RECORD;
+			}
+			spec[specLength++] = 'l';
+			spec[specLength++] = 'l';
+			spec[specLength++] = conversion;
+			spec[specLength] = '\0';
+			appended = appendFormatted(&_line, spec, (unsigned long long)value);
+			break;
+		}
+		case 'p':
+		{
+			/* the port library prints pointers as fixed width upper case hex, without a prefix */
+			uint64_t value = 0;
+			if (VARINT_OK != readVarint(&cursor, end, &value)) {
+				return RESULT_BAD_RECORD;
+			}
+			appended = appendFormatted(&_line, "%0*llX", (int)(2 * _pointerSize), (unsigned long long)value);
+			break;
+		}
+		case 's':
+		{
+			uint64_t value = 0;
+			const char *string = NULL;
+			if (VARINT_OK != readVarint(&cursor, end, &value)) {
+				return RESULT_BAD_RECORD;
+			}
+			if (1 == (value & 1)) {
+				uint64_t stringId = value >> 1;
+				if ((stringId >= _strings.count) || (NULL == _strings.entries[stringId])) {
+					return RESULT_BAD_RECORD;
+				}
+				string = _strings.entries[stringId];
+			} else {
+				uint64_t stringLength = value >> 1;
+				if (stringLength > (uint64_t)(end - cursor)) {
+					return RESULT_BAD_RECORD;
+				}
+				_argument.length = 0;
+				if (!append(&_argument, (const char *)cursor, (size_t)stringLength) || !append(&_argument, "", 1)) {
+					return RESULT_NO_MEMORY;
+				}
+				cursor += stringLength;
+				string = _argument.bytes;
+			}
+			strcpy(spec + specLength, "s");
+			appended = appendFormatted(&_line, spec, string);
+			break;
+		}
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		{
+			uint64_t bits = 0;
+			double value = 0.0;
+			if ((end - cursor) < (ptrdiff_t)sizeof(bits)) {
+				return RESULT_BAD_RECORD;
+			}
+			for (size_t i = 0; i < sizeof(bits); i++) {
+				bits |= (uint64_t)cursor[i] << (8 * i);
+			}
+			cursor += sizeof(bits);
+			memcpy(&value, &bits, sizeof(value));
+			spec[specLength++] = conversion;
+			spec[specLength] = '\0';
+			appended = appendFormatted(&_line, spec, value);
+			break;
+		}
+		default:
+			return RESULT_BAD_RECORD;
+		}
+		if (!appended) {
+			return RESULT_NO_MEMORY;
+		}
+	}
+
+	if (cursor != end) {
+		return RESULT_BAD_RECORD;
+	}
+	if (!append(&_line, "\n", 1)) {
+		return RESULT_NO_MEMORY;
+	}
+	return emit(_line.bytes, _line.length);
+}
+
+VerboseGCDecoder::Result
+VerboseGCDecoder::emit(const char *text, size_t length)
+{
+	if (OUTPUT_XML == _mode) {
+		return _output(_userData, text, length) ? RESULT_OK : RESULT_OUTPUT_FAILED;
+	}
+	if (!append(&_markup, text, length)) {
+		return RESULT_NO_MEMORY;
+	}
+	return convertMarkup();
+}
+
+/**
+ * Convert the complete tags in the pending markup to CSV rows, keeping any incomplete tag for the next record.
+ * Character data between tags is not part of the verbose GC format and is skipped.
+ */
+VerboseGCDecoder::Result
+VerboseGCDecoder::convertMarkup()
+{
+	const char *data = _markup.bytes;
+	const char *end = data + _markup.length;
+	const char *consumed = data;
+
+	while (consumed < end) {
+		const char *start = (const char *)memchr(consumed, '<', end - consumed);
+		if (NULL == start) {
+			consumed = end;
+			break;
+		}
+
+		const char *close = NULL;
+		if (((end - start) >= 4) && (0 == memcmp(start, "<!--", 4))) {
+			for (const char *cursor = start + 4; (end - cursor) >= 3; cursor++) {
+				if (0 == memcmp(cursor, "-->", 3)) {
+					close = cursor + 2;
+					break;
+				}
+			}
+		} else {
+			char quote = '\0';
+			for (const char *cursor = start + 1; cursor < end; cursor++) {
+				if ('\0' != quote) {
+					if (quote == *cursor) {
+						quote = '\0';
+					}
+				} else if (('"' == *cursor) || ('\'' == *cursor)) {
+					quote = *cursor;
+				} else if ('>' == *cursor) {
+					close = cursor;
+					break;
+				}
+			}
+		}
+		if (NULL == close) {
+			consumed = start;
+			break;
+		}
+
+		Result result = convertTag(start + 1, close - start - 1);
+		if (RESULT_OK != result) {
+			return result;
+		}
+		consumed = close + 1;
+	}
+
+	_markup.length = end - consumed;
+	memmove(_markup.bytes, consumed, _markup.length);
+	return RESULT_OK;
+}
+
+/**
+ * Convert the text between the angle brackets of a tag to one CSV row per attribute (or a single
+ * row with no attribute if it has none). Processing instructions, comments and end tags produce no rows.
+ */
+VerboseGCDecoder::Result
+VerboseGCDecoder::convertTag(const char *tag, size_t length)
+{
+	if ((0 == length) || ('?' == tag[0]) || ('!' == tag[0])) {
+		return RESULT_OK;
+	}
+	if ('/' == tag[0]) {
+		if (0 != _depth) {
+			_depth -= 1;
+		}
+		return RESULT_OK;
+	}
+
+	const char *end = tag + length;
+	bool selfClosing = ('/' == end[-1]);
+	if (selfClosing) {
+		end -= 1;
+	}
+
+	const char *name = tag;
+	const char *cursor = tag;
+	while ((cursor < end) && !isSpace(*cursor)) {
+		cursor += 1;
+	}
+	size_t nameLength = cursor - name;
+	bool hasAttributes = false;
+
+	_element += 1;
+	while (cursor < end) {
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		const char *attribute = cursor;
+		while ((cursor < end) && ('=' != *cursor) && !isSpace(*cursor)) {
+			cursor += 1;
+		}
+		size_t attributeLength = cursor - attribute;
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ((0 == attributeLength) || (cursor >= end) || ('=' != *cursor)) {
+			break;
+		}
+		cursor += 1;
+		while ((cursor < end) && isSpace(*cursor)) {
+			cursor += 1;
+		}
+		if ((cursor >= end) || (('"' != *cursor) && ('\'' != *cursor))) {
+			break;
+		}
+		char quote = *cursor++;
+		const char *value = cursor;
+		while ((cursor < end) && (quote != *cursor)) {
+			cursor += 1;
+		}
+		Result result = writeRow(name, nameLength, attribute, attributeLength, value, cursor - value);
+		if (RESULT_OK != result) {
+			return result;
+		}
+		hasAttributes = true;
+		cursor += 1;
+	}
+
+	if (!hasAttributes) {
+		Result result = writeRow(name, nameLength, "", 0, "", 0);
+		if (RESULT_OK != result) {
+			return result;
+		}
+	}
+	if (!selfClosing) {
+		_depth += 1;
+	}
+	return RESULT_OK;
+}
+
+VerboseGCDecoder::Result
+VerboseGCDecoder::writeRow(const char *element, size_t elementLength, const char *attribute, size_t attributeLength, const char *value, size_t valueLength)
+{
+	static const struct {
+		const char *entity;
+		char replacement;
+	} entities[] = { { "&quot;", '"' }, { "&apos;", '\'' }, { "&lt;", '<' }, { "&gt;", '>' }, { "&amp;", '&' } };
+
+	if (!_csvHeaderWritten) {
+		if (!_output(_userData, CSV_HEADER, sizeof(CSV_HEADER) - 1)) {
+			return RESULT_OUTPUT_FAILED;
+		}
+		_csvHeaderWritten = true;
+	}
+
+	_value.length = 0;
+	for (size_t i = 0; i < valueLength; i++) {
+		char c = value[i];
+		if ('&' == c) {
+			for (size_t e = 0; e < sizeof(entities) / sizeof(entities[0]); e++) {
+				size_t entityLength = strlen(entities[e].entity);
+				if (((valueLength - i) >= entityLength) && (0 == memcmp(value + i, entities[e].entity, entityLength))) {
+					c = entities[e].replacement;
+					i += entityLength - 1;
+					break;
+				}
+			}
+		}
+		if (!append(&_value, &c, 1)) {
+			return RESULT_NO_MEMORY;
+		}
+	}
+
+	_row.length = 0;
+	if (!appendFormatted(&_row, "%lu,%lu,", (unsigned long)_element, (unsigned long)_depth)
+		|| !appendField(element, elementLength)
+		|| !append(&_row, ",", 1)
+		|| !appendField(attribute, attributeLength)
+		|| !append(&_row, ",", 1)
+		|| !appendField(_value.bytes, _value.length)
+		|| !append(&_row, "\n", 1)
+	) {
+		return RESULT_NO_MEMORY;
+	}
+	return _output(_userData, _row.bytes, _row.length) ? RESULT_OK : RESULT_OUTPUT_FAILED;
+}
+
+/**
+ * Append a CSV field, quoting it if it holds a separator, a quote or a line break.
+ */
+bool
+VerboseGCDecoder::appendField(const char *text, size_t length)
+{
+	bool quoted = false;
+	for (size_t i = 0; i < length; i++) {
+		if ((',' == text[i]) || ('"' == text[i]) || ('\n' == text[i]) || ('\r' == text[i])) {
+			quoted = true;
+			break;
+		}
+	}
+	if (!quoted) {
+		return append(&_row, text, length);
+	}
+
+	if (!append(&_row, "\"", 1)) {
+		return false;
+	}
+	for (size_t i = 0; i < length; i++) {
+		if (('"' == text[i]) && !append(&_row, "\"", 1)) {
+			return false;
+		}
+		if (!append(&_row, text + i, 1)) {
+			return false;
+		}
+	}
+	return append(&_row, "\"", 1);
+}
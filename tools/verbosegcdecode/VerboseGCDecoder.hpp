@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#if !defined(VERBOSEGCDECODER_HPP_)
+#define VERBOSEGCDECODER_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Streaming decoder for the binary verbose GC format (see gc/verbose/VerboseBinaryFormat.hpp).
+ * Bytes can be passed in chunks of any size as they are read; the decoded output is passed to the
+ * output function as soon as each record is complete. The output is either the XML which the text
+ * writers would have produced, or CSV with one row per element attribute.
+ */
+class VerboseGCDecoder
+{
+	/*
+	 * Data members
+	 */
+public:
+	enum OutputMode {
+		OUTPUT_XML = 0,
+		OUTPUT_CSV
+	};
+
+	enum Result {
+		RESULT_OK = 0,
+		RESULT_BAD_MAGIC, /**< the input is not a binary verbose GC stream */
+		RESULT_BAD_VERSION, /**< the stream was written by an unknown version of the format */
+		RESULT_BAD_RECORD, /**< a record is malformed or refers to an undefined format or string */
+		RESULT_TRUNCATED, /**< the stream ended in the middle of a record */
+		RESULT_NO_MEMORY,
+		RESULT_OUTPUT_FAILED /**< the output function returned false */
+	};
+
+	/**
+	 * Receives decoded output.
+	 * @return true to continue decoding, false to stop with RESULT_OUTPUT_FAILED
+	 */
+	typedef bool (*OutputFunction)(void *userData, const char *text, size_t length);
+
+private:
+	struct Buffer {
+		char *bytes;
+		size_t length;
+		size_t capacity;
+	};
+
+	struct Table {
+		char **entries;
+		size_t count;
+	};
+
+	OutputMode _mode;
+	OutputFunction _output;
+	void *_userData;
+	Result _result; /**< first error seen, decoding stops once this is set */
+
+	Buffer _pending; /**< input not yet decoded because it does not hold a complete record */
+	bool _preambleSeen;
+	unsigned int _pointerSize; /**< sizeof(uintptr_t) of the producer, for formatting %p */
+	Table _formats;
+	Table _strings;
+
+	Buffer _line; /**< text of the record being decoded */
+	Buffer _argument; /**< NUL terminated copy of an inline string argument */
+	Buffer _markup; /**< XML not yet converted to CSV because it does not hold a complete tag */
+	Buffer _row; /**< CSV row being built */
+	Buffer _value; /**< attribute value with its XML entities replaced */
+	size_t _element; /**< number of elements converted to CSV */
+	size_t _depth; /**< element nesting depth for CSV */
+	bool _csvHeaderWritten;
+
+	/*
+	 * Function members
+	 */
+public:
+	VerboseGCDecoder(OutputMode mode, OutputFunction output, void *userData);
+	~VerboseGCDecoder();
+
+	/**
+	 * Decode the next chunk of the stream.
+	 * @return RESULT_OK, or the first error seen; once an error is returned all further calls return it
+	 */
+	Result decode(const uint8_t *bytes, size_t length);
+
+	/**
+	 * Check that the stream ended on a record boundary.
+	 */
+	Result finish();
+
+	static const char *describe(Result result);
+
+private:
+	bool reserve(Buffer *buffer, size_t spaceNeeded);
+	bool append(Buffer *buffer, const char *bytes, size_t length);
+	bool appendFormatted(Buffer *buffer, const char *spec, ...);
+	Result define(Table *table, uint64_t id, const uint8_t *bytes, size_t length);
+
+	Result decodeRecord(const uint8_t *body, size_t length);
+	Result decodeLine(const uint8_t *cursor, const uint8_t *end);
+	Result emit(const char *text, size_t length);
+
+	Result convertMarkup();
+	Result convertTag(const char *tag, size_t length);
+	Result writeRow(const char *element, size_t elementLength, const char *attribute, size_t attributeLength, const char *value, size_t valueLength);
+	bool appendField(const char *text, size_t length);
+};
+
+#endif /* VERBOSEGCDECODER_HPP_ */
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *
+ * (c) Copyright IBM Corp. 2016
+ *
+ *  This program and the accompanying materials are made available
+ *  under the terms of the Eclipse Public License v1.0 and
+ *  Apache License v2.0 which accompanies this distribution.
+ *
+ *      The Eclipse Public License is available at
+ *      http://www.eclipse.org/legal/epl-v10.html
+ *
+ *      The Apache License v2.0 is available at
+ *      http://www.opensource.org/licenses/apache2.0.php
+ *
+ * Contributors:
+ *    Multiple authors (IBM Corp.) - initial implementation and documentation
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "VerboseGCDecoder.hpp"
+
+#define READ_CHUNK_SIZE (64 * 1024)
+
+static bool
+writeToFile(void *userData, const char *text, size_t length)
+{
+	return length == fwrite(text, 1, length, (FILE *)userData);
+}
+
+static void
+printUsage(const char *program)
+{
+	fprintf(stderr, "Usage: %s [-csv] <binary verbose GC log> [<output file>]\n", program);
+	fprintf(stderr, "Decode a verbose GC log written with -Xgc:verboseBinaryFormat to XML, or with -csv to\n");
+	fprintf(stderr, "one CSV row per element attribute. Output goes to standard output if no file is given.\n");
+}
+
+int
+main(int argc, char **argv)
+{
+	VerboseGCDecoder::OutputMode mode = VerboseGCDecoder::OUTPUT_XML;
+	const char *inputName = NULL;
+	const char *outputName = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (0 == strcmp(argv[i], "-csv")) {
+			mode = VerboseGCDecoder::OUTPUT_CSV;
+		} else if (NULL == inputName) {
+			inputName = argv[i];
+		} else if (NULL == outputName) {
+			outputName = argv[i];
+		} else {
+			printUsage(argv[0]);
+			return 1;
+		}
+	}
+	if (NULL == inputName) {
+		printUsage(argv[0]);
+		return 1;
+	}
+
+	FILE *input = fopen(inputName, "rb");
+	if (NULL == input) {
+		fprintf(stderr, "%s: failed to open %s\n", argv[0], inputName);
+		return 1;
+	}
+	FILE *output = stdout;
+	if (NULL != outputName) {
+		output = fopen(outputName, "wb");
+		if (NULL == output) {
+			fprintf(stderr, "%s: failed to open %s\n", argv[0], outputName);
+			fclose(input);
+			return 1;
+		}
+	}
+
+	VerboseGCDecoder decoder(mode, writeToFile, output);
+	VerboseGCDecoder::Result result = VerboseGCDecoder::RESULT_OK;
+	static unsigned char chunk[READ_CHUNK_SIZE];
+	size_t length = 0;
+	while ((VerboseGCDecoder::RESULT_OK == result) && (0 != (length = fread(chunk, 1, sizeof(chunk), input)))) {
+		result = decoder.decode(chunk, length);
+	}
+	if (VerboseGCDecoder::RESULT_OK == result) {
+		result = decoder.finish();
+	}
+
+	fclose(input);
+	if ((0 != fflush(output)) && (VerboseGCDecoder::RESULT_OK == result)) {
+		result = VerboseGCDecoder::RESULT_OUTPUT_FAILED;
+	}
+	if (stdout != output) {
+		fclose(output);
+	}
+
+	if (VerboseGCDecoder::RESULT_OK != result) {
+		fprintf(stderr, "%s: %s: %s\n", argv[0], inputName, VerboseGCDecoder::describe(result));
+		return 1;
+	}
+	return 0;
+}